@@ -80,8 +80,11 @@ LOCAL_C_INCLUDES := \
 
 LOCAL_SRC_FILES := \
         $(ARMNN_BACKEND_SOURCES) \
+        src/armnn/BackendCostModel.cpp \
         src/armnn/BackendHelper.cpp \
         src/armnn/BackendRegistry.cpp \
+        src/armnn/ChromeTracePrinter.cpp \
+        src/armnn/ConstTensorStore.cpp \
         src/armnn/Descriptors.cpp \
         src/armnn/Exceptions.cpp \
         src/armnn/Graph.cpp \
@@ -89,11 +92,14 @@ LOCAL_SRC_FILES := \
         src/armnn/JsonPrinter.cpp \
         src/armnn/Layer.cpp \
         src/armnn/LayerSupport.cpp \
+        src/armnn/LayerWorkEstimate.cpp \
+        src/armnn/LayerWorkInstrument.cpp \
         src/armnn/LoadedNetwork.cpp \
         src/armnn/Logging.cpp \
         src/armnn/Network.cpp \
         src/armnn/NetworkUtils.cpp \
         src/armnn/Observable.cpp \
+        src/armnn/OptimizedNetworkCache.cpp \
         src/armnn/Optimizer.cpp \
         src/armnn/optimizations/PermuteAndBatchToSpaceAsDepthToSpace.cpp \
         src/armnn/OutputHandler.cpp \
@@ -113,6 +119,7 @@ LOCAL_SRC_FILES := \
         src/armnnUtils/FloatingPointConverter.cpp \
         src/armnnUtils/HeapProfiling.cpp \
         src/armnnUtils/LeakChecking.cpp \
+        src/armnnUtils/MemoryMappedFile.cpp \
         src/armnnUtils/ParserHelper.cpp \
         src/armnnUtils/Permute.cpp \
         src/armnnUtils/TensorUtils.cpp \
@@ -129,7 +136,9 @@ LOCAL_SRC_FILES := \
         src/armnn/layers/ConcatLayer.cpp \
         src/armnn/layers/ConstantLayer.cpp \
         src/armnn/layers/Convolution2dLayer.cpp \
+        src/armnn/layers/ConvertBf16ToFp32Layer.cpp \
         src/armnn/layers/ConvertFp16ToFp32Layer.cpp \
+        src/armnn/layers/ConvertFp32ToBf16Layer.cpp \
         src/armnn/layers/ConvertFp32ToFp16Layer.cpp \
         src/armnn/layers/DebugLayer.cpp \
         src/armnn/layers/DepthToSpaceLayer.cpp \
@@ -177,7 +186,9 @@ LOCAL_SRC_FILES := \
         src/armnn/layers/SubtractionLayer.cpp \
         src/armnn/layers/SwitchLayer.cpp \
         src/armnn/layers/TransposeConvolution2dLayer.cpp \
+        src/profiling/BufferedFileWriter.cpp \
         src/profiling/BufferManager.cpp \
+        src/profiling/CaptureFile.cpp \
         src/profiling/CommandHandler.cpp \
         src/profiling/CommandHandlerFunctor.cpp \
         src/profiling/CommandHandlerKey.cpp \
@@ -188,6 +199,8 @@ LOCAL_SRC_FILES := \
         src/profiling/DirectoryCaptureCommandHandler.cpp \
         src/profiling/FileOnlyProfilingConnection.cpp \
         src/profiling/Holder.cpp \
+        src/profiling/InferenceSampler.cpp \
+        src/profiling/InferenceTimelineRecorder.cpp \
         src/profiling/LabelsAndEventClasses.cpp \
         src/profiling/PacketBuffer.cpp \
         src/profiling/PacketVersionResolver.cpp \
@@ -201,9 +214,11 @@ LOCAL_SRC_FILES := \
         src/profiling/ProfilingUtils.cpp \
         src/profiling/RegisterBackendCounters.cpp \
         src/profiling/RequestCounterDirectoryCommandHandler.cpp \
+        src/profiling/RingBufferManager.cpp \
         src/profiling/SendCounterPacket.cpp \
         src/profiling/SendThread.cpp \
         src/profiling/SendTimelinePacket.cpp \
+        src/profiling/ShardedCounterValues.cpp \
         src/profiling/SocketProfilingConnection.cpp \
         src/profiling/TimelinePacketWriterFactory.cpp \
         src/profiling/TimelineUtilityMethods.cpp \
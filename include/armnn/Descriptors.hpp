@@ -27,7 +27,7 @@ struct ActivationDescriptor
 
     bool operator ==(const ActivationDescriptor &rhs) const
     {
-        return m_Function == rhs.m_Function && m_A == rhs.m_B && m_B == rhs.m_B;
+        return m_Function == rhs.m_Function && m_A == rhs.m_A && m_B == rhs.m_B;
     }
 
     /// @brief The activation function to use
@@ -1071,6 +1071,12 @@ struct PreCompiledDescriptor
 
     ~PreCompiledDescriptor() = default;
 
+    bool operator ==(const PreCompiledDescriptor& rhs) const
+    {
+        return m_NumInputSlots  == rhs.m_NumInputSlots &&
+               m_NumOutputSlots == rhs.m_NumOutputSlots;
+    }
+
     unsigned int m_NumInputSlots;
     unsigned int m_NumOutputSlots;
 };
@@ -13,7 +13,9 @@
 #include <armnn/Types.hpp>
 #include <armnn/Deprecated.hpp>
 
+#include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace armnn
@@ -557,16 +559,29 @@ protected:
     ~IOptimizedNetwork() {}
 };
 
+/// Throughput of a backend, used by the cost model backend assignment to estimate the latency of the layers
+struct BackendThroughput
+{
+    double m_GigaFlopsPerSecond;
+    double m_GigaBytesPerSecond;
+    /// Fixed cost of dispatching a workload, in microseconds
+    double m_DispatchOverheadUs;
+};
+
 struct OptimizerOptions
 {
     OptimizerOptions()
         : m_ReduceFp32ToFp16(false)
         , m_Debug(false)
+        , m_ReduceFp32ToBf16(false)
+        , m_CostModelBackendAssignment(false)
     {}
 
-    OptimizerOptions(bool reduceFp32ToFp16, bool debug)
+    OptimizerOptions(bool reduceFp32ToFp16, bool debug, bool reduceFp32ToBf16 = false)
         : m_ReduceFp32ToFp16(reduceFp32ToFp16)
         , m_Debug(debug)
+        , m_ReduceFp32ToBf16(reduceFp32ToBf16)
+        , m_CostModelBackendAssignment(false)
     {}
 
     // Reduce Fp32 data to Fp16 for faster processing
@@ -574,6 +589,22 @@ struct OptimizerOptions
 
     // Add debug data for easier troubleshooting
     bool m_Debug;
+
+    // Run the Convolution2d and FullyConnected layers of an Fp32 network in Bf16, halving their weight
+    // storage and bandwidth, while the remaining layers stay in Fp32. Cannot be combined with m_ReduceFp32ToFp16
+    bool m_ReduceFp32ToBf16;
+
+    // Assign backends to minimise the estimated latency of the network, including the copies between
+    // backends, rather than using the first supported backend in the preference list
+    bool m_CostModelBackendAssignment;
+
+    // Measured execution times in microseconds, by layer name and backend, used by the cost model
+    // backend assignment in place of its static estimates
+    std::map<std::string, std::map<BackendId, double>> m_MeasuredLayerCostsUs;
+
+    // Throughputs of the backends used by the cost model backend assignment, in place of its conservative
+    // defaults for the backends shipped with Arm NN
+    std::map<BackendId, BackendThroughput> m_BackendThroughputs;
 };
 
 /// Create an optimized version of the network
@@ -590,4 +621,57 @@ IOptimizedNetworkPtr Optimize(const INetwork& network,
                               const IDeviceSpec& deviceSpec,
                               const OptimizerOptions& options = OptimizerOptions(),
                               Optional<std::vector<std::string>&> messages = EmptyOptional());
+
+class IOptimizedNetworkCache;
+using IOptimizedNetworkCachePtr = std::unique_ptr<IOptimizedNetworkCache, void(*)(IOptimizedNetworkCache* cache)>;
+
+/// Keeps the networks optimized through it, so that optimizing an equal network again with the same
+/// backend preferences, supported backends and options returns a copy of the optimized network
+/// instead of running the optimizer. Networks are equal if they have the same layers, descriptors,
+/// connections, tensor infos and constant tensor contents. The cache can be used from several threads.
+/// Optimized networks holding a pre-compiled layer whose backend cannot copy its compiled object are not
+/// cached, and are counted by GetNumRejected().
+class IOptimizedNetworkCache
+{
+public:
+    /// @param maxNumEntries The maximum number of optimized networks kept, the least recently used is
+    ///                      dropped first.
+    static IOptimizedNetworkCache* CreateRaw(size_t maxNumEntries = 8);
+    static IOptimizedNetworkCachePtr Create(size_t maxNumEntries = 8);
+    static void Destroy(IOptimizedNetworkCache* cache);
+
+    /// Number of optimizations answered from the cache
+    virtual size_t GetNumHits() const = 0;
+
+    /// Number of optimizations that ran the optimizer
+    virtual size_t GetNumMisses() const = 0;
+
+    /// Number of optimized networks which could not be copied into the cache
+    virtual size_t GetNumRejected() const = 0;
+
+    virtual size_t GetNumEntries() const = 0;
+
+    /// Drops all the cached networks, leaving the statistics unchanged
+    virtual void Clear() = 0;
+
+protected:
+    ~IOptimizedNetworkCache() {}
+};
+
+/// Create an optimized version of the network, or a copy of the optimized network found in the cache
+/// @param network INetwork description of the network to be optimized.
+/// @param backendPreferences The choice of the backend ordered by user preferences.
+/// @param deviceSpec DeviceSpec object as queried from the runtime. See IRuntime::GetDeviceSpec()
+/// @param cache The cache looked up first, to which the network is added once optimized
+/// @param options OptimizerOptions object with optimizer configuration options
+/// @param messages If there are failures or warnings a string describing same will be added to the vector.
+///                 The warnings of a cached network are added again when it is found in the cache
+/// @return An IOptimizedNetworkPtr interface to the optimized network, throws an exception derived from
+/// armnn::Exception if process fails.
+IOptimizedNetworkPtr Optimize(const INetwork& network,
+                              const std::vector<BackendId>& backendPreferences,
+                              const IDeviceSpec& deviceSpec,
+                              IOptimizedNetworkCache& cache,
+                              const OptimizerOptions& options = OptimizerOptions(),
+                              Optional<std::vector<std::string>&> messages = EmptyOptional());
 } //namespace armnn
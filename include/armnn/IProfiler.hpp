@@ -5,11 +5,34 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 
 namespace armnn
 {
 
+/// Selects the inferences to profile, so that profiling can be left on at a fraction of its overhead.
+/// An inference is profiled if it is one in every m_Interval inferences, starting with the first one, and then with
+/// the probability m_Probability. The default options profile every inference.
+struct InferenceSamplingOptions
+{
+    InferenceSamplingOptions()
+        : m_Interval(1)
+        , m_Probability(1.0f)
+    {}
+
+    InferenceSamplingOptions(uint32_t interval, float probability = 1.0f)
+        : m_Interval(interval)
+        , m_Probability(probability)
+    {}
+
+    /// Profile one inference in every given number of inferences, at least 1.
+    uint32_t m_Interval;
+    /// Profile the inferences with the given probability, greater than 0 and at most 1.
+    float m_Probability;
+};
+
 class IProfiler
 {
 public:
@@ -22,6 +45,18 @@ public:
     /// @return true if profiling is enabled, false otherwise.
     virtual bool IsProfilingEnabled() = 0;
 
+    /// Bounds the memory used by the profiler to the given number of events.
+    /// Once the limit is reached, the events of the oldest inference are added to the event stats, and their storage
+    /// is reused for new events. The detailed results then only cover the most recent inferences.
+    /// @param [in] maxEventCount The maximum number of events to keep, or 0 to keep every event (the default).
+    virtual void SetMaxEventCount(size_t maxEventCount) = 0;
+
+    /// Profiles only a sample of the inferences: the events of the others are not recorded. The totals and counts of
+    /// the event stats of the inferences are then scaled up by the ratio of the inferences run to the ones profiled.
+    /// Throws an InvalidArgumentException if the options are invalid.
+    /// @param [in] sampling Which inferences to profile.
+    virtual void SetInferenceSampling(const InferenceSamplingOptions& sampling) = 0;
+
     /// Analyzes the tracked events and writes the results to the given output stream.
     /// Please refer to the configuration variables in Profiling.cpp to customize the information written.
     /// @param [out] outStream The stream where to write the profiling results to.
@@ -31,6 +66,17 @@ public:
     /// @param [out] outStream The stream where to write the profiling results to.
     virtual void Print(std::ostream& outStream) const = 0;
 
+    /// Print the tracked events in the Chrome trace event format to the given output stream, to be displayed on a
+    /// timeline per thread by trace viewers such as chrome://tracing or Perfetto.
+    /// @param [out] outStream The stream where to write the trace to.
+    virtual void PrintChromeTrace(std::ostream& outStream) const = 0;
+
+    /// Streams each event to the given output stream in the Chrome trace event format as soon as it ends, rather
+    /// than waiting for the events to be printed. The trace is closed when another stream is set, when nullptr is
+    /// set, or when the profiler is destroyed, and the stream must remain valid until then.
+    /// @param [out] outStream The stream where to write the trace to, or nullptr to stop streaming.
+    virtual void SetChromeTraceStream(std::ostream* outStream) = 0;
+
 protected:
     ~IProfiler() {}
 };
@@ -65,6 +65,8 @@ public:
                 , m_IncomingCaptureFile("")
                 , m_FileOnly(false)
                 , m_CapturePeriod(LOWEST_CAPTURE_PERIOD)
+                , m_CompressOutgoingCaptureFile(false)
+                , m_TimelineSampling()
             {}
 
             bool        m_EnableProfiling;
@@ -72,6 +74,10 @@ public:
             std::string m_IncomingCaptureFile;
             bool        m_FileOnly;
             uint32_t    m_CapturePeriod;
+            /// Compresses the outgoing capture file, which the profiling tools decompress as they read it
+            bool        m_CompressOutgoingCaptureFile;
+            /// Records the timeline of only a sample of the inferences, to leave timeline profiling on in production
+            InferenceSamplingOptions m_TimelineSampling;
         };
         ExternalProfilingOptions m_ProfilingOptions;
 
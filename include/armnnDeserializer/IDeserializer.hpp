@@ -37,6 +37,20 @@ public:
     /// Create an input network from a binary input stream
     virtual armnn::INetworkPtr CreateNetworkFromBinary(std::istream& binaryContent) = 0;
 
+    /// Create the network from a binary file on disk. The file is mapped into memory and the constant tensors
+    /// of the network reference the mapped data instead of copying it, so the file stays mapped for as long as
+    /// the network, or a network optimized from it, uses them.
+    virtual armnn::INetworkPtr CreateNetworkFromBinaryFile(const char* graphFile) = 0;
+
+    /// Create an optimized network, ready to be passed to IRuntime::LoadNetwork, from the binary contents
+    /// of a network serialized after Optimize(). Throws if the file was written by another version of Arm NN,
+    /// or uses a backend that is not available.
+    virtual armnn::IOptimizedNetworkPtr CreateOptimizedNetworkFromBinary(
+        const std::vector<uint8_t>& binaryContent) = 0;
+
+    /// Create an optimized network from a binary input stream of a network serialized after Optimize()
+    virtual armnn::IOptimizedNetworkPtr CreateOptimizedNetworkFromBinary(std::istream& binaryContent) = 0;
+
     /// Retrieve binding info (layer id and tensor info) for the network input identified by
     /// the given layer name and layers id
     virtual BindingPointInfo GetNetworkInputBindingInfo(unsigned int layerId,
@@ -11,6 +11,27 @@
 namespace armnnSerializer
 {
 
+struct SerializerOptions
+{
+    SerializerOptions()
+        : m_ExternalConstantData(false)
+        , m_ExternalDataAlignment(64)
+        , m_ExternalDataMinimumSize(1024)
+    {}
+
+    /// Writes the payloads of large constant tensors to a data section after the SerializedGraph instead of
+    /// storing them in it. The payloads are then streamed from the network by SaveSerializedToStream, so the
+    /// serialized network must be kept alive until it has been called, but no copy of them is held in memory.
+    bool m_ExternalConstantData;
+
+    /// Alignment in bytes of the payloads in the data section, relative to the start of the file.
+    /// Allows a memory mapped file to be used in place.
+    unsigned int m_ExternalDataAlignment;
+
+    /// Payloads smaller than this number of bytes are still stored in the SerializedGraph.
+    unsigned int m_ExternalDataMinimumSize;
+};
+
 class ISerializer;
 using ISerializerPtr = std::unique_ptr<ISerializer, void(*)(ISerializer* serializer)>;
 
@@ -18,13 +39,23 @@ class ISerializer
 {
 public:
     static ISerializer* CreateRaw();
+    static ISerializer* CreateRaw(const SerializerOptions& options);
     static ISerializerPtr Create();
+    static ISerializerPtr Create(const SerializerOptions& options);
     static void Destroy(ISerializer* serializer);
 
     /// Serializes the network to ArmNN SerializedGraph.
     /// @param [in] inNetwork The network to be serialized.
     virtual void Serialize(const armnn::INetwork& inNetwork) = 0;
 
+    /// Serializes the optimized network to ArmNN SerializedGraph, including the backend assigned to each layer,
+    /// the memory strategy of each connection and the layers and constants added by Optimize().
+    /// It can be loaded with IDeserializer::CreateOptimizedNetworkFromBinary by the same version of Arm NN.
+    /// Throws an InvalidArgumentException if the network contains PreCompiled layers, whose state is backend specific,
+    /// or Debug layers, inserted when it is optimized with OptimizerOptions::m_Debug.
+    /// @param [in] inNetwork The optimized network to be serialized.
+    virtual void Serialize(const armnn::IOptimizedNetwork& inNetwork) = 0;
+
     /// Serializes the SerializedGraph to the stream.
     /// @param [stream] the stream to save to
     /// @return true if graph is Serialized to the Stream, false otherwise
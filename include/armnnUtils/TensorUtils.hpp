@@ -38,4 +38,8 @@ unsigned int GetNumElementsAfter(const armnn::TensorShape& shape, unsigned int a
 
 std::pair<unsigned int, std::vector<float>> GetPerAxisParams(const armnn::TensorInfo& info);
 
+/// Returns a hash of the info and the contents of a tensor, so tensors with equal contents can be found
+/// without comparing all of them. Tensors with equal hashes still need to be compared to be known equal.
+size_t GetTensorContentHash(const armnn::TensorInfo& info, const void* data);
+
 } // namespace armnnUtils
@@ -0,0 +1,80 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "BackendCostModel.hpp"
+
+#include "Layer.hpp"
+#include "LayerWorkEstimate.hpp"
+
+#include <algorithm>
+
+namespace armnn
+{
+
+BackendCostModel::BackendCostModel()
+    : m_DefaultThroughput{ 8.0, 8.0, 5.0 }
+    , m_CopyGigaBytesPerSecond(4.0)
+    , m_CopyOverheadUs(20.0)
+{
+    // Conservative defaults for the backends shipped with Arm NN, measured profiles take precedence
+    m_Throughputs[Compute::CpuRef] = BackendThroughput{ 1.0, 4.0, 1.0 };
+    m_Throughputs[Compute::CpuAcc] = BackendThroughput{ 16.0, 8.0, 2.0 };
+    m_Throughputs[Compute::GpuAcc] = BackendThroughput{ 64.0, 16.0, 30.0 };
+}
+
+void BackendCostModel::SetBackendThroughput(const BackendId& backend, const BackendThroughput& throughput)
+{
+    m_Throughputs[backend] = throughput;
+}
+
+void BackendCostModel::SetMeasuredLayerCost(const std::string& layerName, const BackendId& backend, double costUs)
+{
+    m_MeasuredCosts[std::make_pair(layerName, backend)] = costUs;
+}
+
+void BackendCostModel::SetCopyCost(double gigaBytesPerSecond, double overheadUs)
+{
+    m_CopyGigaBytesPerSecond = gigaBytesPerSecond;
+    m_CopyOverheadUs         = overheadUs;
+}
+
+const BackendCostModel::BackendThroughput& BackendCostModel::GetBackendThroughput(const BackendId& backend) const
+{
+    auto it = m_Throughputs.find(backend);
+    return it != m_Throughputs.end() ? it->second : m_DefaultThroughput;
+}
+
+double BackendCostModel::GetLayerCost(const Layer& layer, const BackendId& backend) const
+{
+    auto measured = m_MeasuredCosts.find(std::make_pair(layer.GetNameStr(), backend));
+    if (measured != m_MeasuredCosts.end())
+    {
+        return measured->second;
+    }
+
+    const LayerWorkEstimate work = EstimateLayerWork(layer);
+    const BackendThroughput& throughput = GetBackendThroughput(backend);
+
+    // Roofline estimate: the layer is bound by either its arithmetic or its memory traffic.
+    // 1 GFLOP/s == 1000 FLOP/us and 1 GB/s == 1000 bytes/us.
+    const double computeUs = static_cast<double>(work.m_Flops) / (throughput.m_GigaFlopsPerSecond * 1000.0);
+    const double memoryUs  = static_cast<double>(work.m_BytesRead + work.m_BytesWritten) /
+                             (throughput.m_GigaBytesPerSecond * 1000.0);
+
+    return throughput.m_DispatchOverheadUs + std::max(computeUs, memoryUs);
+}
+
+double BackendCostModel::GetCopyCost(const OutputSlot& slot, const BackendId& source, const BackendId& destination) const
+{
+    if (source == destination)
+    {
+        return 0.0;
+    }
+
+    const double numBytes = static_cast<double>(slot.GetTensorInfo().GetNumBytes());
+    return m_CopyOverheadUs + numBytes / (m_CopyGigaBytesPerSecond * 1000.0);
+}
+
+} // namespace armnn
@@ -0,0 +1,53 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/BackendId.hpp>
+#include <armnn/INetwork.hpp>
+
+#include <map>
+#include <string>
+#include <utility>
+
+namespace armnn
+{
+
+class Layer;
+class OutputSlot;
+
+/// Latency model used to assign backends to layers. The cost of a layer on a backend is derived from its
+/// analytical work estimate and the throughput of the backend, unless a measured cost has been provided.
+class BackendCostModel
+{
+public:
+    using BackendThroughput = armnn::BackendThroughput;
+
+    BackendCostModel();
+
+    void SetBackendThroughput(const BackendId& backend, const BackendThroughput& throughput);
+
+    /// Overrides the static estimate with a measured execution time, in microseconds.
+    void SetMeasuredLayerCost(const std::string& layerName, const BackendId& backend, double costUs);
+
+    /// Sets the bandwidth and the fixed overhead of the copies inserted between layers on different backends.
+    void SetCopyCost(double gigaBytesPerSecond, double overheadUs);
+
+    /// Estimated execution time of the layer on the given backend, in microseconds.
+    double GetLayerCost(const Layer& layer, const BackendId& backend) const;
+
+    /// Estimated time to move the tensor of the given output slot between two backends, in microseconds.
+    double GetCopyCost(const OutputSlot& slot, const BackendId& source, const BackendId& destination) const;
+
+private:
+    const BackendThroughput& GetBackendThroughput(const BackendId& backend) const;
+
+    std::map<BackendId, BackendThroughput> m_Throughputs;
+    std::map<std::pair<std::string, BackendId>, double> m_MeasuredCosts;
+    BackendThroughput m_DefaultThroughput;
+    double m_CopyGigaBytesPerSecond;
+    double m_CopyOverheadUs;
+};
+
+} // namespace armnn
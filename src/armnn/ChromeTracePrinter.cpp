@@ -0,0 +1,169 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ChromeTracePrinter.hpp"
+#include "WallClockTimer.hpp"
+
+#include <cstdio>
+#include <ios>
+
+namespace armnn
+{
+
+namespace
+{
+
+// All the events are printed as events of a single process
+constexpr unsigned int g_ChromeTraceProcessId = 0;
+
+} // anonymous namespace
+
+void ChromeTracePrinter::PrintEvent(const Event& event)
+{
+    const std::vector<Measurement> measurements = event.GetMeasurements();
+
+    // The timeline position of an event comes from its wall clock timer, without which it can not be placed
+    const Measurement* start = nullptr;
+    const Measurement* duration = nullptr;
+    for (const Measurement& measurement : measurements)
+    {
+        if (measurement.m_Name == WallClockTimer::WALL_CLOCK_TIME_START)
+        {
+            start = &measurement;
+        }
+        else if (measurement.m_Name == WallClockTimer::WALL_CLOCK_TIME)
+        {
+            duration = &measurement;
+        }
+    }
+    if (start == nullptr || duration == nullptr)
+    {
+        return;
+    }
+
+    const unsigned int threadIndex = GetThreadIndex(event.GetThreadId());
+
+    // Makes sure timestamps are output with 3 decimals (nanoseconds), and save old settings.
+    std::streamsize oldPrecision = m_OutputStream.precision();
+    m_OutputStream.precision(3);
+    std::ios_base::fmtflags oldFlags = m_OutputStream.flags();
+    m_OutputStream.setf(std::ios::fixed);
+
+    PrintSeparator();
+    m_OutputStream << R"({"name": ")" << Escape(event.GetName())
+                   << R"(", "cat": ")" << Escape(event.GetBackendId().Get())
+                   << R"(", "ph": "X", "pid": )" << g_ChromeTraceProcessId
+                   << R"(, "tid": )" << threadIndex
+                   << R"(, "ts": )" << start->m_Value
+                   << R"(, "dur": )" << duration->m_Value
+                   << R"(, "args": {)";
+
+    bool firstArgument = true;
+    for (const Measurement& measurement : measurements)
+    {
+        if (&measurement == duration ||
+            measurement.m_Name == WallClockTimer::WALL_CLOCK_TIME_START ||
+            measurement.m_Name == WallClockTimer::WALL_CLOCK_TIME_STOP)
+        {
+            continue;
+        }
+        m_OutputStream << (firstArgument ? "" : ", ") << "\"" << Escape(measurement.m_Name) << " ("
+                       << Measurement::ToString(measurement.m_Unit) << ")\": " << measurement.m_Value;
+        firstArgument = false;
+    }
+    m_OutputStream << "}}";
+
+    // Restores previous precision settings.
+    m_OutputStream.flags(oldFlags);
+    m_OutputStream.precision(oldPrecision);
+}
+
+void ChromeTracePrinter::PrintFooter()
+{
+    PrintHeader();
+    m_OutputStream << std::endl << "]" << std::endl;
+    m_HeaderPrinted = false;
+    m_ThreadIndices.clear();
+}
+
+void ChromeTracePrinter::PrintHeader()
+{
+    if (!m_HeaderPrinted)
+    {
+        m_OutputStream << "[";
+        m_HeaderPrinted = true;
+    }
+}
+
+void ChromeTracePrinter::PrintSeparator()
+{
+    if (m_HeaderPrinted)
+    {
+        m_OutputStream << ",";
+    }
+    else
+    {
+        PrintHeader();
+    }
+    m_OutputStream << std::endl;
+}
+
+unsigned int ChromeTracePrinter::GetThreadIndex(std::thread::id threadId)
+{
+    auto it = m_ThreadIndices.find(threadId);
+    if (it != m_ThreadIndices.end())
+    {
+        return it->second;
+    }
+
+    const unsigned int threadIndex = static_cast<unsigned int>(m_ThreadIndices.size());
+    m_ThreadIndices.emplace(threadId, threadIndex);
+
+    // Names the thread with its index, in order of appearance
+    PrintSeparator();
+    m_OutputStream << R"({"name": "thread_name", "ph": "M", "pid": )" << g_ChromeTraceProcessId
+                   << R"(, "tid": )" << threadIndex
+                   << R"(, "args": {"name": "Thread )" << threadIndex << R"("}})";
+    return threadIndex;
+}
+
+std::string ChromeTracePrinter::Escape(const std::string& text)
+{
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (char c : text)
+    {
+        switch (c)
+        {
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            case '\t':
+                escaped += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    char code[7];
+                    snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned int>(c));
+                    escaped += code;
+                }
+                else
+                {
+                    escaped += c;
+                }
+                break;
+        }
+    }
+    return escaped;
+}
+
+} // namespace armnn
@@ -0,0 +1,50 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "ProfilingEvent.hpp"
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <thread>
+
+namespace armnn
+{
+
+/// Prints profiling events in the JSON array form of the Chrome trace event format, which trace viewers such as
+/// chrome://tracing and Perfetto display on a timeline per thread.
+/// Events are printed one at a time as they are given, so a trace can be streamed while it is recorded: viewers
+/// accept an array which was not closed by PrintFooter().
+class ChromeTracePrinter
+{
+public:
+    ChromeTracePrinter(std::ostream& outputStream)
+        : m_OutputStream(outputStream)
+        , m_HeaderPrinted(false)
+    {}
+
+    /// Prints an event which has ended, as a complete event timed by its wall clock measurements.
+    /// The other measurements of the event are printed as its arguments.
+    void PrintEvent(const Event& event);
+
+    /// Closes the trace.
+    void PrintFooter();
+
+private:
+    void PrintHeader();
+    void PrintSeparator();
+
+    /// Returns the index of the thread in the trace, printing its name the first time it is seen
+    unsigned int GetThreadIndex(std::thread::id threadId);
+
+    static std::string Escape(const std::string& text);
+
+    std::ostream& m_OutputStream;
+    bool m_HeaderPrinted;
+    std::map<std::thread::id, unsigned int> m_ThreadIndices;
+};
+
+} // namespace armnn
@@ -0,0 +1,94 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "ConstTensorStore.hpp"
+
+#include <armnnUtils/TensorUtils.hpp>
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <cstring>
+
+namespace armnn
+{
+
+void ConstTensorStore::Share(std::unique_ptr<ScopedCpuTensorHandle>& handle)
+{
+    const TensorInfo& info = handle->GetTensorInfo();
+    const void* data = handle->GetConstTensor<void>();
+    if (data == nullptr)
+    {
+        return;
+    }
+
+    const size_t hash = armnnUtils::GetTensorContentHash(info, data);
+
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+    auto range = m_Tensors.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        const Entry& entry = it->second;
+        std::shared_ptr<const void> storage = entry.m_Storage.lock();
+        if (storage &&
+            entry.m_Info == info &&
+            (entry.m_Data == data || std::memcmp(entry.m_Data, data, info.GetNumBytes()) == 0))
+        {
+            handle = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(info, entry.m_Data), std::move(storage));
+            return;
+        }
+    }
+
+    std::shared_ptr<const void> storage = handle->GetSharedStorage();
+    if (!storage)
+    {
+        // The handle keeps its memory alive for all the tensors sharing it
+        std::shared_ptr<ScopedCpuTensorHandle> owner(std::move(handle));
+        handle = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(info, data), owner);
+        storage = std::move(owner);
+    }
+    m_Tensors.emplace(hash, Entry{ info, data, storage });
+}
+
+size_t ConstTensorStore::GetNumTensors() const
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+    size_t numTensors = 0;
+    for (auto&& tensor : m_Tensors)
+    {
+        if (!tensor.second.m_Storage.expired())
+        {
+            ++numTensors;
+        }
+    }
+    return numTensors;
+}
+
+size_t ConstTensorStore::GetNumBytes() const
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+    size_t numBytes = 0;
+    for (auto&& tensor : m_Tensors)
+    {
+        if (!tensor.second.m_Storage.expired())
+        {
+            numBytes += tensor.second.m_Info.GetNumBytes();
+        }
+    }
+    return numBytes;
+}
+
+void ConstTensorStore::RemoveUnused()
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+    for (auto it = m_Tensors.begin(); it != m_Tensors.end();)
+    {
+        it = it->second.m_Storage.expired() ? m_Tensors.erase(it) : std::next(it);
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,47 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/Tensor.hpp>
+#include <armnn/backends/CpuTensorHandleFwd.hpp>
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace armnn
+{
+
+/// Store of the immutable constant tensors of the networks loaded in a Runtime, keyed by content hash.
+/// Equal tensors share a single copy, which is freed once no workload or layer references it.
+class ConstTensorStore
+{
+public:
+    /// Replaces the handle with one referencing the stored copy of its contents. The memory of the handle
+    /// becomes the stored copy if no equal tensor is stored yet, so no data is copied.
+    void Share(std::unique_ptr<ScopedCpuTensorHandle>& handle);
+
+    /// Number of distinct tensors referenced by the loaded networks.
+    size_t GetNumTensors() const;
+
+    /// Total size in bytes of the distinct tensors referenced by the loaded networks.
+    size_t GetNumBytes() const;
+
+    /// Forgets the tensors that are no longer referenced.
+    void RemoveUnused();
+
+private:
+    struct Entry
+    {
+        TensorInfo                m_Info;
+        const void*               m_Data;
+        std::weak_ptr<const void> m_Storage;
+    };
+
+    mutable std::mutex m_Mutex;
+    std::unordered_multimap<size_t, Entry> m_Tensors;
+};
+
+} // namespace armnn
@@ -18,16 +18,24 @@ struct Measurement
         TIME_NS,
         TIME_US,
         TIME_MS,
+        FLOP,
+        BYTE,
+        GFLOP_PER_S,
+        GBYTE_PER_S,
     };
 
     inline static const char* ToString(Unit unit)
     {
         switch (unit)
         {
-            case TIME_NS: return "ns";
-            case TIME_US: return "us";
-            case TIME_MS: return "ms";
-            default:      return "";
+            case TIME_NS:     return "ns";
+            case TIME_US:     return "us";
+            case TIME_MS:     return "ms";
+            case FLOP:        return "FLOP";
+            case BYTE:        return "B";
+            case GFLOP_PER_S: return "GFLOP/s";
+            case GBYTE_PER_S: return "GB/s";
+            default:          return "";
         }
     }
 
@@ -22,7 +22,9 @@ enum class LayerType
     Comparison,
     Concat,
     Constant,
+    ConvertBf16ToFp32,
     ConvertFp16ToFp32,
+    ConvertFp32ToBf16,
     ConvertFp32ToFp16,
     Convolution2d,
     Debug,
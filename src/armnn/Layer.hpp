@@ -285,6 +285,10 @@ public:
     /// (currently used in DotSerializer and company).
     virtual void SerializeLayerParameters(ParameterStringifyFunction& fn) const;
 
+    /// Returns true if the other layer is of the same type and has equal parameters
+    /// (not including tensor-valued weights etc.).
+    virtual bool HasEqualParameters(const Layer& other) const { return GetType() == other.GetType(); }
+
     // Free up the constant source data
     virtual void ReleaseConstantData();
 
@@ -397,6 +401,12 @@ public:
 
     LayerBindingId GetBindingId() const { return m_Id; };
 
+    bool HasEqualParameters(const Layer& other) const override
+    {
+        return Layer::HasEqualParameters(other) &&
+               boost::polymorphic_downcast<const BindableLayer*>(&other)->GetBindingId() == m_Id;
+    }
+
 protected:
     ~BindableLayer() = default;
 
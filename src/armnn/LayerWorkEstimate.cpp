@@ -0,0 +1,260 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "LayerWorkEstimate.hpp"
+
+#include "LayersFwd.hpp"
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <boost/polymorphic_cast.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace armnn
+{
+
+namespace
+{
+
+uint64_t GetNumBytes(const std::unique_ptr<ScopedCpuTensorHandle>& tensor)
+{
+    return tensor ? tensor->GetTensorInfo().GetNumBytes() : 0;
+}
+
+uint64_t GetNumElements(const std::unique_ptr<ScopedCpuTensorHandle>& tensor)
+{
+    return tensor ? tensor->GetTensorInfo().GetNumElements() : 0;
+}
+
+/// Multiply-accumulate operations per output element of a layer whose weights have the output channels
+/// in the given dimension.
+uint64_t GetMacsPerOutput(const std::unique_ptr<ScopedCpuTensorHandle>& weight, unsigned int channelsDimension)
+{
+    if (!weight)
+    {
+        return 0;
+    }
+
+    const TensorShape& shape = weight->GetTensorInfo().GetShape();
+    const uint64_t numOutputChannels = shape[channelsDimension];
+    return numOutputChannels == 0 ? 0 : weight->GetTensorInfo().GetNumElements() / numOutputChannels;
+}
+
+/// Number of rows of the first input of a layer, which is the batch of a recurrent layer.
+uint64_t GetBatchSize(const Layer& layer)
+{
+    const OutputSlot* connection = layer.GetInputSlot(0).GetConnectedOutputSlot();
+    return connection != nullptr && connection->GetTensorInfo().GetNumDimensions() > 0 ?
+           connection->GetTensorInfo().GetShape()[0] : 0;
+}
+
+/// Adds the gate matrix products of a recurrent layer: every weight element is multiplied and accumulated
+/// once per batch entry. All its constant tensors are read.
+void AddRecurrentWork(const std::vector<const std::unique_ptr<ScopedCpuTensorHandle>*>& matrices,
+                      const std::vector<const std::unique_ptr<ScopedCpuTensorHandle>*>& vectors,
+                      uint64_t batchSize,
+                      LayerWorkEstimate& estimate)
+{
+    for (const std::unique_ptr<ScopedCpuTensorHandle>* matrix : matrices)
+    {
+        estimate.m_Flops     += 2 * batchSize * GetNumElements(*matrix);
+        estimate.m_BytesRead += GetNumBytes(*matrix);
+    }
+    for (const std::unique_ptr<ScopedCpuTensorHandle>* vector : vectors)
+    {
+        estimate.m_BytesRead += GetNumBytes(*vector);
+    }
+}
+
+} // anonymous namespace
+
+LayerWorkEstimate EstimateLayerWork(const Layer& layer)
+{
+    LayerWorkEstimate estimate;
+
+    uint64_t inputElements = 0;
+    for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+    {
+        const OutputSlot* connection = layer.GetInputSlot(i).GetConnectedOutputSlot();
+        if (connection != nullptr)
+        {
+            estimate.m_BytesRead += connection->GetTensorInfo().GetNumBytes();
+            inputElements        += connection->GetTensorInfo().GetNumElements();
+        }
+    }
+
+    uint64_t outputElements = 0;
+    for (unsigned int i = 0; i < layer.GetNumOutputSlots(); ++i)
+    {
+        const TensorInfo& outputInfo = layer.GetOutputSlot(i).GetTensorInfo();
+        estimate.m_BytesWritten += outputInfo.GetNumBytes();
+        outputElements          += outputInfo.GetNumElements();
+    }
+
+    switch (layer.GetType())
+    {
+        case LayerType::Constant:
+        case LayerType::Input:
+        case LayerType::MemCopy:
+        case LayerType::MemImport:
+        case LayerType::Output:
+        case LayerType::Reshape:
+        {
+            // Pure data movement
+            break;
+        }
+        case LayerType::Convolution2d:
+        {
+            // Weights are [O, I, H, W] or [O, H, W, I]
+            const auto& convolution = *boost::polymorphic_downcast<const Convolution2dLayer*>(&layer);
+            estimate.m_Flops      = 2 * outputElements * GetMacsPerOutput(convolution.m_Weight, 0);
+            estimate.m_BytesRead += GetNumBytes(convolution.m_Weight) + GetNumBytes(convolution.m_Bias);
+            break;
+        }
+        case LayerType::DepthwiseConvolution2d:
+        {
+            // Weights are [M, I, H, W], each output element accumulates H * W products
+            const auto& convolution = *boost::polymorphic_downcast<const DepthwiseConvolution2dLayer*>(&layer);
+            const uint64_t numWeights = GetNumElements(convolution.m_Weight);
+            const TensorShape& weightShape = convolution.m_Weight ? convolution.m_Weight->GetTensorInfo().GetShape()
+                                                                  : TensorShape({ 1, 1 });
+            const uint64_t numChannels = static_cast<uint64_t>(weightShape[0]) * weightShape[1];
+            estimate.m_Flops      = numChannels == 0 ? 0 : 2 * outputElements * (numWeights / numChannels);
+            estimate.m_BytesRead += GetNumBytes(convolution.m_Weight) + GetNumBytes(convolution.m_Bias);
+            break;
+        }
+        case LayerType::FullyConnected:
+        {
+            // Weights are [I, O], or [O, I] when transposed
+            const auto& fullyConnected = *boost::polymorphic_downcast<const FullyConnectedLayer*>(&layer);
+            const unsigned int outputDimension = fullyConnected.GetParameters().m_TransposeWeightMatrix ? 0 : 1;
+            estimate.m_Flops      = 2 * outputElements * GetMacsPerOutput(fullyConnected.m_Weight, outputDimension);
+            estimate.m_BytesRead += GetNumBytes(fullyConnected.m_Weight) + GetNumBytes(fullyConnected.m_Bias);
+            break;
+        }
+        case LayerType::TransposeConvolution2d:
+        {
+            // Every input element is scattered through the [O, H, W, I] weights
+            const auto& convolution = *boost::polymorphic_downcast<const TransposeConvolution2dLayer*>(&layer);
+            const unsigned int inputChannelsDimension =
+                convolution.GetParameters().m_DataLayout == DataLayout::NHWC ? 3 : 1;
+            const uint64_t macsPerInput = convolution.m_Weight ?
+                GetNumElements(convolution.m_Weight) /
+                    convolution.m_Weight->GetTensorInfo().GetShape()[inputChannelsDimension] : 0;
+            estimate.m_Flops      = 2 * inputElements * macsPerInput;
+            estimate.m_BytesRead += GetNumBytes(convolution.m_Weight) + GetNumBytes(convolution.m_Bias);
+            break;
+        }
+        case LayerType::Pooling2d:
+        {
+            const auto& pooling = *boost::polymorphic_downcast<const Pooling2dLayer*>(&layer);
+            estimate.m_Flops = outputElements * pooling.GetParameters().m_PoolWidth *
+                               pooling.GetParameters().m_PoolHeight;
+            break;
+        }
+        case LayerType::Lstm:
+        {
+            const auto& lstm = *boost::polymorphic_downcast<const LstmLayer*>(&layer);
+            const LstmDescriptor& descriptor = lstm.GetParameters();
+            const LstmBasicParameters& basic = lstm.m_BasicParameters;
+
+            AddRecurrentWork({ &basic.m_InputToForgetWeights, &basic.m_InputToCellWeights,
+                               &basic.m_InputToOutputWeights, &basic.m_RecurrentToForgetWeights,
+                               &basic.m_RecurrentToCellWeights, &basic.m_RecurrentToOutputWeights,
+                               &lstm.m_CifgParameters.m_InputToInputWeights,
+                               &lstm.m_CifgParameters.m_RecurrentToInputWeights,
+                               &lstm.m_ProjectionParameters.m_ProjectionWeights },
+                             { &basic.m_ForgetGateBias, &basic.m_CellBias, &basic.m_OutputGateBias,
+                               &lstm.m_CifgParameters.m_CellToInputWeights, &lstm.m_CifgParameters.m_InputGateBias,
+                               &lstm.m_ProjectionParameters.m_ProjectionBias,
+                               &lstm.m_PeepholeParameters.m_CellToForgetWeights,
+                               &lstm.m_PeepholeParameters.m_CellToOutputWeights,
+                               &lstm.m_LayerNormParameters.m_InputLayerNormWeights,
+                               &lstm.m_LayerNormParameters.m_ForgetLayerNormWeights,
+                               &lstm.m_LayerNormParameters.m_CellLayerNormWeights,
+                               &lstm.m_LayerNormParameters.m_OutputLayerNormWeights },
+                             GetBatchSize(layer), estimate);
+
+            // Per cell, each gate adds its bias and applies its activation, then the cell state is updated
+            // (f * c + i * g) and squashed into the output (o * tanh(c)). The peepholes multiply and add the cell
+            // state into the gates, and the layer normalization computes a mean and a variance and scales each gate.
+            const uint64_t numGates = descriptor.m_CifgEnabled ? 3 : 4;
+            uint64_t operationsPerCell = 2 * numGates + 3 + 2;
+            operationsPerCell += descriptor.m_PeepholeEnabled ? 2 * (numGates - 1) : 0;
+            operationsPerCell += descriptor.m_LayerNormEnabled ? 6 * numGates : 0;
+            estimate.m_Flops += GetBatchSize(layer) * GetNumElements(basic.m_ForgetGateBias) * operationsPerCell;
+            break;
+        }
+        case LayerType::QuantizedLstm:
+        {
+            const auto& lstm = *boost::polymorphic_downcast<const QuantizedLstmLayer*>(&layer);
+            const QuantizedLstmParameters& parameters = lstm.m_QuantizedLstmParameters;
+
+            AddRecurrentWork({ &parameters.m_InputToInputWeights, &parameters.m_InputToForgetWeights,
+                               &parameters.m_InputToCellWeights, &parameters.m_InputToOutputWeights,
+                               &parameters.m_RecurrentToInputWeights, &parameters.m_RecurrentToForgetWeights,
+                               &parameters.m_RecurrentToCellWeights, &parameters.m_RecurrentToOutputWeights },
+                             { &parameters.m_InputGateBias, &parameters.m_ForgetGateBias,
+                               &parameters.m_CellBias, &parameters.m_OutputGateBias },
+                             GetBatchSize(layer), estimate);
+
+            // Four gates adding their bias and applying their activation, the cell update and the output
+            const uint64_t operationsPerCell = 2 * 4 + 3 + 2;
+            estimate.m_Flops += GetBatchSize(layer) * GetNumElements(parameters.m_ForgetGateBias) * operationsPerCell;
+            break;
+        }
+        case LayerType::Softmax:
+        {
+            // The maximum, the shifted exponential, the sum and the division of each element
+            estimate.m_Flops = 5 * outputElements;
+            break;
+        }
+        case LayerType::Normalization:
+        {
+            // Each element sums the squares of its window, across the channels or within a square of its channel,
+            // then the sum is scaled, raised to the power beta and divides the element.
+            const NormalizationDescriptor& descriptor =
+                boost::polymorphic_downcast<const NormalizationLayer*>(&layer)->GetParameters();
+            const uint64_t windowSize = descriptor.m_NormChannelType == NormalizationAlgorithmChannel::Within ?
+                                        static_cast<uint64_t>(descriptor.m_NormSize) * descriptor.m_NormSize :
+                                        descriptor.m_NormSize;
+            estimate.m_Flops = outputElements * (2 * windowSize + 3);
+            break;
+        }
+        case LayerType::BatchNormalization:
+        {
+            // The mean, variance, beta and gamma fold into a scale and a shift of each element
+            const auto& batchNormalization = *boost::polymorphic_downcast<const BatchNormalizationLayer*>(&layer);
+            estimate.m_Flops      = 2 * outputElements;
+            estimate.m_BytesRead += GetNumBytes(batchNormalization.m_Mean) +
+                                    GetNumBytes(batchNormalization.m_Variance) +
+                                    GetNumBytes(batchNormalization.m_Beta) +
+                                    GetNumBytes(batchNormalization.m_Gamma);
+            break;
+        }
+        case LayerType::PreCompiled:
+        {
+            // Only the backend which compiled the layer knows its work, e.g. the steps of a fused elementwise chain
+            const auto& preCompiled = *boost::polymorphic_downcast<const PreCompiledLayer*>(&layer);
+            const unsigned int operationsPerElement = preCompiled.GetOperationsPerElement();
+            estimate.m_Flops       = outputElements * std::max(operationsPerElement, 1u);
+            estimate.m_IsEstimated = operationsPerElement == 0;
+            break;
+        }
+        default:
+        {
+            // Elementwise and data dependent layers, roughly one operation per output element
+            estimate.m_Flops       = outputElements;
+            estimate.m_IsEstimated = true;
+            break;
+        }
+    }
+
+    return estimate;
+}
+
+} // namespace armnn
@@ -0,0 +1,35 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <cstdint>
+
+namespace armnn
+{
+
+class Layer;
+
+/// Analytical estimate of the work done by a layer for a single execution.
+struct LayerWorkEstimate
+{
+    LayerWorkEstimate()
+        : m_Flops(0)
+        , m_BytesRead(0)
+        , m_BytesWritten(0)
+        , m_IsEstimated(false)
+    {}
+
+    uint64_t m_Flops;
+    uint64_t m_BytesRead;
+    uint64_t m_BytesWritten;
+    /// True when the operations of the layer are not modelled and only approximated from its outputs.
+    bool     m_IsEstimated;
+};
+
+/// Estimates the floating point (or integer arithmetic) operations and the memory traffic of the given layer
+/// from its descriptor and the tensor infos of its inputs, outputs and constant tensors.
+LayerWorkEstimate EstimateLayerWork(const Layer& layer);
+
+} // namespace armnn
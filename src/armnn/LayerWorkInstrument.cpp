@@ -0,0 +1,51 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "LayerWorkInstrument.hpp"
+
+namespace armnn
+{
+
+const std::string LayerWorkInstrument::FLOPS             ("Flops");
+const std::string LayerWorkInstrument::ESTIMATED_FLOPS   ("Estimated flops");
+const std::string LayerWorkInstrument::BYTES_READ        ("Bytes read");
+const std::string LayerWorkInstrument::BYTES_WRITTEN     ("Bytes written");
+const std::string LayerWorkInstrument::ACHIEVED_FLOPS    ("Achieved compute");
+const std::string LayerWorkInstrument::ACHIEVED_BANDWIDTH("Achieved bandwidth");
+
+const char* LayerWorkInstrument::GetName() const
+{
+    return "LayerWorkInstrument";
+}
+
+void LayerWorkInstrument::Start()
+{
+    m_Start = WallClockTimer::clock::now();
+}
+
+void LayerWorkInstrument::Stop()
+{
+    m_Stop = WallClockTimer::clock::now();
+}
+
+std::vector<Measurement> LayerWorkInstrument::GetMeasurements() const
+{
+    const double flops = static_cast<double>(m_Work.m_Flops);
+    const double bytes = static_cast<double>(m_Work.m_BytesRead + m_Work.m_BytesWritten);
+
+    // Operations per nanosecond are billions of operations per second
+    const double durationNs = std::chrono::duration<double, std::nano>(m_Stop - m_Start).count();
+    const double achievedGFlops = durationNs > 0.0 ? flops / durationNs : 0.0;
+    const double achievedGBytes = durationNs > 0.0 ? bytes / durationNs : 0.0;
+
+    return { { m_Work.m_IsEstimated ? ESTIMATED_FLOPS : FLOPS,
+                                   flops,                                        Measurement::Unit::FLOP },
+             { BYTES_READ,         static_cast<double>(m_Work.m_BytesRead),      Measurement::Unit::BYTE },
+             { BYTES_WRITTEN,      static_cast<double>(m_Work.m_BytesWritten),   Measurement::Unit::BYTE },
+             { ACHIEVED_FLOPS,     achievedGFlops,                               Measurement::Unit::GFLOP_PER_S },
+             { ACHIEVED_BANDWIDTH, achievedGBytes,                               Measurement::Unit::GBYTE_PER_S } };
+}
+
+} // namespace armnn
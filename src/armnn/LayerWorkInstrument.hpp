@@ -0,0 +1,46 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "Instrument.hpp"
+#include "LayerWorkEstimate.hpp"
+#include "WallClockTimer.hpp"
+
+namespace armnn
+{
+
+/// Reports the analytical work of a layer, or of a whole network, together with the compute and memory throughput
+/// achieved while the instrument was running, to compare them with the roofline of the machine.
+class LayerWorkInstrument : public Instrument
+{
+public:
+    LayerWorkInstrument(const LayerWorkEstimate& work)
+        : m_Work(work)
+    {}
+
+    void Start() override;
+
+    void Stop() override;
+
+    const char* GetName() const override;
+
+    std::vector<Measurement> GetMeasurements() const override;
+
+    static const std::string FLOPS;
+    /// Replaces FLOPS when the operations of the layer are only approximated.
+    static const std::string ESTIMATED_FLOPS;
+    static const std::string BYTES_READ;
+    static const std::string BYTES_WRITTEN;
+    static const std::string ACHIEVED_FLOPS;
+    static const std::string ACHIEVED_BANDWIDTH;
+
+private:
+    LayerWorkEstimate m_Work;
+    WallClockTimer::clock::time_point m_Start;
+    WallClockTimer::clock::time_point m_Stop;
+};
+
+} // namespace armnn
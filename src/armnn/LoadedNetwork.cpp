@@ -10,6 +10,7 @@
 #include "Runtime.hpp"
 #include "Profiling.hpp"
 #include "HeapProfiling.hpp"
+#include "LayerWorkInstrument.hpp"
 
 #include <armnn/BackendRegistry.hpp>
 #include <armnn/Logging.hpp>
@@ -84,7 +85,8 @@ void AddWorkloadStructure(std::unique_ptr<TimelineUtilityMethods>& timelineUtils
 
 std::unique_ptr<LoadedNetwork> LoadedNetwork::MakeLoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
                                                                 std::string& errorMessage,
-                                                                const INetworkProperties& networkProperties)
+                                                                const INetworkProperties& networkProperties,
+                                                                ConstTensorStore* constTensorStore)
 {
     std::unique_ptr<LoadedNetwork> loadedNetwork;
 
@@ -98,7 +100,7 @@ std::unique_ptr<LoadedNetwork> LoadedNetwork::MakeLoadedNetwork(std::unique_ptr<
 
     try
     {
-        loadedNetwork.reset(new LoadedNetwork(std::move(net), networkProperties));
+        loadedNetwork.reset(new LoadedNetwork(std::move(net), networkProperties, constTensorStore));
     }
     catch (const armnn::RuntimeException& error)
     {
@@ -117,7 +119,8 @@ std::unique_ptr<LoadedNetwork> LoadedNetwork::MakeLoadedNetwork(std::unique_ptr<
 }
 
 LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
-                             const INetworkProperties& networkProperties) :
+                             const INetworkProperties& networkProperties,
+                             ConstTensorStore* constTensorStore) :
                              m_OptimizedNetwork(std::move(net)),
                              m_IsImportEnabled(networkProperties.m_ImportEnabled),
                              m_IsExportEnabled(networkProperties.m_ExportEnabled)
@@ -218,6 +221,15 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
             }
         default:
             {
+                if (constTensorStore != nullptr)
+                {
+                    // Workloads referencing the constants share them with the other loaded networks
+                    layer->OperateOnConstantTensors([constTensorStore](std::unique_ptr<ScopedCpuTensorHandle>& handle)
+                    {
+                        constTensorStore->Share(handle);
+                    });
+                }
+
                 auto workload = layer->CreateWorkload(workloadFactory);
 
                 if (!workload)
@@ -236,6 +248,17 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
                     AddWorkloadStructure(timelineUtils, workload, *layer);
                 }
 
+                // The work of the layer is estimated while it still has its constant data
+                WorkloadLayerInfo layerInfo{ layer->GetNameStr().empty() ?
+                                                 GetLayerTypeAsCString(layer->GetType()) : layer->GetNameStr(),
+                                             layer->GetBackendId(),
+                                             EstimateLayerWork(*layer) };
+                m_NetworkWork.m_Flops        += layerInfo.m_Work.m_Flops;
+                m_NetworkWork.m_BytesRead    += layerInfo.m_Work.m_BytesRead;
+                m_NetworkWork.m_BytesWritten += layerInfo.m_Work.m_BytesWritten;
+                m_NetworkWork.m_IsEstimated   = m_NetworkWork.m_IsEstimated || layerInfo.m_Work.m_IsEstimated;
+                m_WorkloadLayerInfos.push_back(std::move(layerInfo));
+
                 m_WorkloadQueue.push_back(move(workload));
                 // release the constant data in the layer..
                 layer->ReleaseConstantData();
@@ -412,6 +435,8 @@ private:
 Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
                                       const OutputTensors& outputTensors)
 {
+    // Decides once whether the events of the inference are recorded, when only a sample of the inferences is profiled
+    ScopedProfilingInference profilingInference;
     ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "EnqueueWorkload");
 
     const Graph& graph = m_OptimizedNetwork->GetGraph();
@@ -449,15 +474,13 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
         EnqueueOutput(*outputLayer, pin.GetTensorHandle(), pin.GetTensorInfo());
     }
 
-    std::unique_ptr<TimelineUtilityMethods> timelineUtils = TimelineUtilityMethods::GetTimelineUtils();
+    // The timeline of the inference is recorded while it executes, and sent once it is over, if it is sampled
+    InferenceTimelineRecorder* timelineRecorder = nullptr;
     ProfilingGuid inferenceGuid = ProfilingService::Instance().NextGuid();
-    if (timelineUtils)
+    if (ProfilingService::Instance().IsEnabled() && ProfilingService::Instance().SampleNextInference())
     {
-        // Add inference timeline trace if profiling is enabled.
-        ProfilingGuid networkGuid = m_OptimizedNetwork->GetGuid();
-        timelineUtils->CreateTypedEntity(inferenceGuid, LabelsAndEventClasses::INFERENCE_GUID);
-        timelineUtils->CreateRelationship(ProfilingRelationshipType::RetentionLink, networkGuid, inferenceGuid);
-        timelineUtils->RecordEvent(inferenceGuid, LabelsAndEventClasses::ARMNN_PROFILING_SOL_EVENT_CLASS);
+        timelineRecorder = &InferenceTimelineRecorder::GetThreadRecorder();
+        timelineRecorder->BeginInference(m_InputQueue.size() + m_WorkloadQueue.size() + m_OutputQueue.size());
     }
 
     bool executionSucceeded = true;
@@ -467,16 +490,25 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
         {
             profiling::ProfilingService::Instance().IncrementCounterValue(armnn::profiling::INFERENCES_RUN);
         }
-        ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "Execute");
+        ARMNN_SCOPED_PROFILING_EVENT_WITH_INSTRUMENTS(Compute::Undefined,
+                                                      "Execute",
+                                                      WallClockTimer(),
+                                                      LayerWorkInstrument(m_NetworkWork));
         ARMNN_SCOPED_HEAP_PROFILING("Executing");
-        executionSucceeded = Execute(timelineUtils, inferenceGuid);
+        executionSucceeded = Execute(timelineRecorder);
     }
 
-    if (timelineUtils)
+    if (timelineRecorder)
     {
-        // Add end of life of the inference timeline if profiling is enabled.
-        timelineUtils->RecordEvent(inferenceGuid, LabelsAndEventClasses::ARMNN_PROFILING_EOL_EVENT_CLASS);
-        timelineUtils->Commit();
+        timelineRecorder->EndInference();
+
+        // Add the inference timeline if profiling is still enabled.
+        std::unique_ptr<TimelineUtilityMethods> timelineUtils = TimelineUtilityMethods::GetTimelineUtils();
+        if (timelineUtils)
+        {
+            timelineRecorder->SendInference(*timelineUtils, m_OptimizedNetwork->GetGuid(), inferenceGuid);
+            timelineUtils->Commit();
+        }
     }
     return executionSucceeded ? Status::Success : Status::Failure;
 }
@@ -677,8 +709,7 @@ void LoadedNetwork::FreeWorkingMemory()
     m_IsWorkingMemAllocated = false;
 }
 
-bool LoadedNetwork::Execute(std::unique_ptr<TimelineUtilityMethods>& timelineUtils,
-                            profiling::ProfilingGuid inferenceGuid)
+bool LoadedNetwork::Execute(InferenceTimelineRecorder* timelineRecorder)
 {
     bool success = true;
 
@@ -688,52 +719,50 @@ bool LoadedNetwork::Execute(std::unique_ptr<TimelineUtilityMethods>& timelineUti
         success = false;
     };
 
-    try
+    auto ExecuteWorkload = [timelineRecorder](IWorkload& workload)
     {
-        std::lock_guard<std::mutex> lockGuard(m_WorkingMemMutex);
-        AllocateWorkingMemory();
-
-        ProfilingDynamicGuid workloadInferenceID(0);
-        for (auto& input : m_InputQueue)
+        if (timelineRecorder)
         {
-            if(timelineUtils)
-            {
-                workloadInferenceID = timelineUtils->RecordWorkloadInferenceAndStartOfLifeEvent(input->GetGuid(),
-                                                                                                inferenceGuid);
-            }
-            input->Execute();
-            if(timelineUtils)
-            {
-                timelineUtils->RecordEndOfLifeEvent(workloadInferenceID);
-            }
+            timelineRecorder->BeginWorkload(workload.GetGuid());
         }
+        workload.Execute();
+        if (timelineRecorder)
+        {
+            timelineRecorder->EndWorkload();
+        }
+    };
 
-        for (auto& workload : m_WorkloadQueue)
+    auto ExecuteQueue = [&ExecuteWorkload](WorkloadQueue& queue)
+    {
+        for (auto& workload : queue)
         {
-            if(timelineUtils)
-            {
-                workloadInferenceID = timelineUtils->RecordWorkloadInferenceAndStartOfLifeEvent(workload->GetGuid(),
-                                                                                                inferenceGuid);
-            }
-            workload->Execute();
-            if(timelineUtils)
-            {
-                timelineUtils->RecordEndOfLifeEvent(workloadInferenceID);
-            }
+            ExecuteWorkload(*workload);
         }
-        for (auto& output: m_OutputQueue)
+    };
+
+    // The workloads of the layers are profiled with the analytical work of their layer
+    auto ExecuteLayerQueue = [this, &ExecuteWorkload]()
+    {
+        BOOST_ASSERT(m_WorkloadLayerInfos.size() == m_WorkloadQueue.size());
+        for (size_t i = 0; i < m_WorkloadQueue.size(); ++i)
         {
-            if(timelineUtils)
-            {
-                workloadInferenceID = timelineUtils->RecordWorkloadInferenceAndStartOfLifeEvent(output->GetGuid(),
-                                                                                                inferenceGuid);
-            }
-            output->Execute();
-            if(timelineUtils)
-            {
-                timelineUtils->RecordEndOfLifeEvent(workloadInferenceID);
-            }
+            const WorkloadLayerInfo& layerInfo = m_WorkloadLayerInfos[i];
+            ScopedProfilingEvent layerEvent(layerInfo.m_BackendId,
+                                            layerInfo.m_Name,
+                                            WallClockTimer(),
+                                            LayerWorkInstrument(layerInfo.m_Work));
+            ExecuteWorkload(*m_WorkloadQueue[i]);
         }
+    };
+
+    try
+    {
+        std::lock_guard<std::mutex> lockGuard(m_WorkingMemMutex);
+        AllocateWorkingMemory();
+
+        ExecuteQueue(m_InputQueue);
+        ExecuteLayerQueue();
+        ExecuteQueue(m_OutputQueue);
     }
     catch (const RuntimeException& error)
     {
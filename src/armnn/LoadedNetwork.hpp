@@ -7,14 +7,17 @@
 #include <armnn/Tensor.hpp>
 #include <armnn/Types.hpp>
 
+#include "ConstTensorStore.hpp"
 #include "Network.hpp"
 #include "LayerFwd.hpp"
+#include "LayerWorkEstimate.hpp"
 #include "Profiling.hpp"
 
 #include <armnn/backends/IBackendInternal.hpp>
 #include <backendsCommon/TensorHandleFactoryRegistry.hpp>
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadFactory.hpp>
+#include <InferenceTimelineRecorder.hpp>
 #include <TimelineUtilityMethods.hpp>
 
 #include <mutex>
@@ -41,9 +44,12 @@ public:
 
     Status EnqueueWorkload(const InputTensors& inputTensors, const OutputTensors& outputTensors);
 
+    /// The constant tensors of the network are shared with the equal tensors of the other networks using the same
+    /// constTensorStore, if one is given.
     static std::unique_ptr<LoadedNetwork> MakeLoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
                                                             std::string & errorMessage,
-                                                            const INetworkProperties& networkProperties);
+                                                            const INetworkProperties& networkProperties,
+                                                            ConstTensorStore* constTensorStore = nullptr);
 
     // NOTE we return by reference as the purpose of this method is only to provide
     // access to the private m_Profiler and in theory we should not need to increment
@@ -57,14 +63,16 @@ public:
 private:
     void AllocateWorkingMemory();
 
-    LoadedNetwork(std::unique_ptr<OptimizedNetwork> net, const INetworkProperties& networkProperties);
+    LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
+                  const INetworkProperties& networkProperties,
+                  ConstTensorStore* constTensorStore);
 
     void EnqueueInput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo);
 
     void EnqueueOutput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo);
 
-    bool Execute(std::unique_ptr<profiling::TimelineUtilityMethods>& timelineUtils,
-                 profiling::ProfilingGuid inferenceGuid);
+    /// Executes the queued workloads, recording them with the timeline recorder unless it is null
+    bool Execute(profiling::InferenceTimelineRecorder* timelineRecorder);
 
 
     const IWorkloadFactory& GetWorkloadFactory(const Layer& layer) const;
@@ -76,6 +84,14 @@ private:
 
     using WorkloadFactoryMap = std::unordered_map<BackendId, WorkloadFactoryWithMemoryManager>;
 
+    /// The layer a workload of m_WorkloadQueue executes, as it is reported to the profiler
+    struct WorkloadLayerInfo
+    {
+        std::string m_Name;
+        BackendId m_BackendId;
+        LayerWorkEstimate m_Work;
+    };
+
     BackendPtrMap       m_Backends;
     WorkloadFactoryMap  m_WorkloadFactories;
 
@@ -83,6 +99,8 @@ private:
     WorkloadQueue m_InputQueue;
     WorkloadQueue m_WorkloadQueue;
     WorkloadQueue m_OutputQueue;
+    std::vector<WorkloadLayerInfo> m_WorkloadLayerInfos;
+    LayerWorkEstimate m_NetworkWork;
     std::shared_ptr<Profiler> m_Profiler;
 
     mutable std::mutex m_WorkingMemMutex;
@@ -4,9 +4,11 @@
 //
 
 #include "Network.hpp"
+#include "BackendCostModel.hpp"
 #include "Graph.hpp"
 #include "Layer.hpp"
 #include "DeviceSpec.hpp"
+#include "OptimizedNetworkCache.hpp"
 #include "Optimizer.hpp"
 #include "SubgraphViewSelector.hpp"
 #include "BackendSettings.hpp"
@@ -29,6 +31,7 @@
 #include <algorithm>
 #include <fstream>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 #include <algorithm>
 
@@ -95,6 +98,18 @@ void ReportWarning(const std::string& warningMessage,
     }
 }
 
+void ReportInfo(const std::string& infoMessage,
+                Optional<std::vector<std::string>&> infoMessages)
+{
+    std::stringstream fullInfoMessage;
+    fullInfoMessage << "INFO: " << infoMessage;
+    ARMNN_LOG(info) << fullInfoMessage.str();
+    if (infoMessages)
+    {
+        infoMessages.value().push_back(fullInfoMessage.str());
+    }
+}
+
 bool CheckScaleSetOnQuantizedType(Layer* layer, Optional<std::vector<std::string>&> errMessages)
 {
     bool noErrors = true;
@@ -161,6 +176,44 @@ OptimizationResult AssignBackends(OptimizedNetwork* optNetObjPtr,
         return result;
     }
 
+    // Assign a supported backend to the newly introduced conversion layers
+    auto AssignFirstSupportedBackend = [&](Layer* layer, BackendId preferredBackend)
+    {
+        bool supportedBackendFound = false;
+        std::string reasonIfUnsupported;
+
+        // Try preferred backend first
+        layer->SetBackendId(preferredBackend);
+        if (IWorkloadFactory::IsLayerSupported(*layer,
+                                               EmptyOptional(),
+                                               reasonIfUnsupported))
+        {
+            supportedBackendFound = true;
+        }
+        else
+        {
+            for (const auto& backend : availablePreferredBackends)
+            {
+                // Skip preferred backend (we already determined that it is not supported)
+                if (backend == preferredBackend)
+                {
+                    continue;
+                }
+
+                layer->SetBackendId(backend);
+                if (IWorkloadFactory::IsLayerSupported(*layer,
+                                                       EmptyOptional(),
+                                                       reasonIfUnsupported))
+                {
+                    supportedBackendFound = true;
+                    break;
+                }
+            }
+        }
+
+        return supportedBackendFound;
+    };
+
     for (auto it = firstLayer; it != lastLayer; ++it)
     {
         auto layer = *it;
@@ -208,45 +261,48 @@ OptimizationResult AssignBackends(OptimizedNetwork* optNetObjPtr,
                                 InsertConvertFp32ToFp16LayersAfter(optNetObjPtr->GetGraph(), *layer);
                         }
 
-                        // Assign a supported backend to the newly introduced conversion layers
-                        auto AssignFirstSupportedBackend = [&](Layer* layer, BackendId preferredBackend)
+                        for (ConvertFp16ToFp32Layer* convertLayer : convertFp16ToFp32Layers)
                         {
-                            bool supportedBackendFound = false;
-                            std::string reasonIfUnsupported;
-
-                            // Try preferred backend first
-                            layer->SetBackendId(preferredBackend);
-                            if (IWorkloadFactory::IsLayerSupported(*layer,
-                                                                   EmptyOptional(),
-                                                                   reasonIfUnsupported))
+                            if (!AssignFirstSupportedBackend(convertLayer, backend))
                             {
-                                supportedBackendFound = true;
+                                return ReturnWithError(convertLayer);
                             }
-                            else
+                        }
+
+                        for (ConvertFp32ToFp16Layer* convertLayer : convertFp32ToFp16Layers)
+                        {
+                            if (!AssignFirstSupportedBackend(convertLayer, backend))
                             {
-                                for (const auto& backend : availablePreferredBackends)
-                                {
-                                    // Skip preferred backend (we already determined that it is not supported)
-                                    if (backend == preferredBackend)
-                                    {
-                                        continue;
-                                    }
-
-                                    layer->SetBackendId(backend);
-                                    if (IWorkloadFactory::IsLayerSupported(*layer,
-                                                                           EmptyOptional(),
-                                                                           reasonIfUnsupported))
-                                    {
-                                        supportedBackendFound = true;
-                                        break;
-                                    }
-                                }
+                                return ReturnWithError(convertLayer);
                             }
+                        }
 
-                            return supportedBackendFound;
-                        };
+                        found = true;
+                        break;
+                    }
+                }
+                else if (dataTypeIn == DataType::BFloat16 || dataTypeOut == DataType::BFloat16)
+                {
+                    if (IWorkloadFactory::IsLayerSupported(*layer, DataType::Float32, reasonIfUnsupported)
+                        && layer->GetType() != LayerType::ConvertFp32ToBf16
+                        && layer->GetType() != LayerType::ConvertBf16ToFp32)
+                    {
+                        // Run the layer in Float32 instead, its constants are converted back after the assignment
+                        std::vector<ConvertBf16ToFp32Layer*> convertBf16ToFp32Layers;
+                        if (dataTypeIn == DataType::BFloat16)
+                        {
+                            convertBf16ToFp32Layers =
+                                InsertConvertBf16ToFp32LayersBefore(optNetObjPtr->GetGraph(), *layer);
+                        }
 
-                        for (ConvertFp16ToFp32Layer* convertLayer : convertFp16ToFp32Layers)
+                        std::vector<ConvertFp32ToBf16Layer*> convertFp32ToBf16Layers;
+                        if (dataTypeOut == DataType::BFloat16)
+                        {
+                            convertFp32ToBf16Layers =
+                                InsertConvertFp32ToBf16LayersAfter(optNetObjPtr->GetGraph(), *layer);
+                        }
+
+                        for (ConvertBf16ToFp32Layer* convertLayer : convertBf16ToFp32Layers)
                         {
                             if (!AssignFirstSupportedBackend(convertLayer, backend))
                             {
@@ -254,7 +310,7 @@ OptimizationResult AssignBackends(OptimizedNetwork* optNetObjPtr,
                             }
                         }
 
-                        for (ConvertFp32ToFp16Layer* convertLayer : convertFp32ToFp16Layers)
+                        for (ConvertFp32ToBf16Layer* convertLayer : convertFp32ToBf16Layers)
                         {
                             if (!AssignFirstSupportedBackend(convertLayer, backend))
                             {
@@ -323,6 +379,172 @@ OptimizationResult AssignBackends(OptimizedNetwork* optNetObjPtr,
                           errMessages);
 }
 
+void AssignBackendsByCost(Graph& graph,
+                          BackendSettings& backendSettings,
+                          const BackendCostModel& costModel,
+                          Optional<std::vector<std::string>&> messages)
+{
+    auto availablePreferredBackends = backendSettings.GetAvailablePreferredBackends();
+    Graph& sortedGraph = graph.TopologicalSort();
+
+    // Find the backends able to run each layer. The backend chosen by AssignBackends is always a candidate,
+    // as it might be a fallback outside of the preferred backends.
+    std::unordered_map<Layer*, std::vector<BackendId>> candidateBackends;
+    std::unordered_map<Layer*, BackendId> initialBackends;
+    for (Layer* layer : sortedGraph)
+    {
+        const BackendId assignedBackend = layer->GetBackendId();
+        initialBackends[layer] = assignedBackend;
+
+        std::vector<BackendId>& candidates = candidateBackends[layer];
+        candidates.push_back(assignedBackend);
+
+        std::string reasonIfUnsupported;
+        for (const auto& backend : availablePreferredBackends)
+        {
+            if (backend == assignedBackend)
+            {
+                continue;
+            }
+
+            layer->SetBackendId(backend);
+            if (IWorkloadFactory::IsLayerSupported(*layer, EmptyOptional(), reasonIfUnsupported))
+            {
+                candidates.push_back(backend);
+            }
+        }
+        layer->SetBackendId(assignedBackend);
+    }
+
+    // Cost of the layer on the given backend, plus the copies of all its inputs and outputs
+    auto GetLocalCost = [&costModel](const Layer& layer, const BackendId& backend)
+    {
+        double cost = costModel.GetLayerCost(layer, backend);
+        for (auto&& inputSlot : layer.GetInputSlots())
+        {
+            const OutputSlot* source = inputSlot.GetConnectedOutputSlot();
+            if (source != nullptr)
+            {
+                cost += costModel.GetCopyCost(*source, source->GetOwningLayer().GetBackendId(), backend);
+            }
+        }
+        for (auto&& outputSlot : layer.GetOutputSlots())
+        {
+            for (auto&& connection : outputSlot.GetConnections())
+            {
+                cost += costModel.GetCopyCost(outputSlot, backend, connection->GetOwningLayer().GetBackendId());
+            }
+        }
+        return cost;
+    };
+
+    // Cost of the whole graph with the current assignment, counting every copy once
+    auto GetTotalCost = [&]()
+    {
+        double cost = 0.0;
+        for (Layer* layer : sortedGraph)
+        {
+            cost += costModel.GetLayerCost(*layer, layer->GetBackendId());
+            for (auto&& inputSlot : layer->GetInputSlots())
+            {
+                const OutputSlot* source = inputSlot.GetConnectedOutputSlot();
+                if (source != nullptr)
+                {
+                    cost += costModel.GetCopyCost(*source,
+                                                  source->GetOwningLayer().GetBackendId(),
+                                                  layer->GetBackendId());
+                }
+            }
+        }
+        return cost;
+    };
+
+    // Moves single layers to their cheapest backend until the assignment settles. As moving one layer at a
+    // time cannot leave a region of layers sharing a backend, the search is started from the initial
+    // assignment and from the assignment putting every layer on each of the backends in turn.
+    const unsigned int maxNumSweeps = 8;
+    auto LocalSearch = [&]()
+    {
+        bool changed = true;
+        for (unsigned int sweep = 0; changed && sweep < maxNumSweeps; ++sweep)
+        {
+            changed = false;
+            for (Layer* layer : sortedGraph)
+            {
+                BackendId bestBackend = layer->GetBackendId();
+                double bestCost = GetLocalCost(*layer, bestBackend);
+                for (const auto& backend : candidateBackends[layer])
+                {
+                    const double cost = GetLocalCost(*layer, backend);
+                    if (cost < bestCost)
+                    {
+                        bestBackend = backend;
+                        bestCost    = cost;
+                    }
+                }
+
+                if (bestBackend != layer->GetBackendId())
+                {
+                    layer->SetBackendId(bestBackend);
+                    changed = true;
+                }
+            }
+        }
+        return GetTotalCost();
+    };
+
+    const double initialCost = GetTotalCost();
+
+    std::unordered_map<Layer*, BackendId> bestAssignment = initialBackends;
+    double bestCost = LocalSearch();
+    for (Layer* layer : sortedGraph)
+    {
+        bestAssignment[layer] = layer->GetBackendId();
+    }
+
+    for (const auto& seedBackend : availablePreferredBackends)
+    {
+        for (Layer* layer : sortedGraph)
+        {
+            const std::vector<BackendId>& candidates = candidateBackends[layer];
+            const bool supported = std::find(candidates.begin(), candidates.end(), seedBackend) != candidates.end();
+            layer->SetBackendId(supported ? seedBackend : initialBackends[layer]);
+        }
+
+        const double cost = LocalSearch();
+        if (cost < bestCost)
+        {
+            bestCost = cost;
+            for (Layer* layer : sortedGraph)
+            {
+                bestAssignment[layer] = layer->GetBackendId();
+            }
+        }
+    }
+
+    // Apply the cheapest assignment found and expose it in the optimizer messages
+    backendSettings.m_SelectedBackends.clear();
+    for (Layer* layer : sortedGraph)
+    {
+        layer->SetBackendId(bestAssignment[layer]);
+        backendSettings.m_SelectedBackends.insert(bestAssignment[layer]);
+    }
+
+    std::stringstream summaryMsg;
+    summaryMsg << "Cost model backend assignment: estimated latency " << bestCost
+               << " us (first supported backend assignment: " << initialCost << " us)";
+    ReportInfo(summaryMsg.str(), messages);
+
+    for (Layer* layer : sortedGraph)
+    {
+        std::stringstream planMsg;
+        planMsg << "Layer " << layer->GetNameStr() << " of type " << GetLayerTypeAsCString(layer->GetType())
+                << " assigned to " << layer->GetBackendId()
+                << " (estimated " << costModel.GetLayerCost(*layer, layer->GetBackendId()) << " us)";
+        ReportInfo(planMsg.str(), messages);
+    }
+}
+
 BackendsMap CreateSupportedBackends(TensorHandleFactoryRegistry& handleFactoryRegistry,
                                     BackendSettings& backendSettings)
 {
@@ -815,6 +1037,11 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
         throw armnn::InvalidArgumentException("Invoked Optimize with no backends specified");
     }
 
+    if (options.m_ReduceFp32ToFp16 && options.m_ReduceFp32ToBf16)
+    {
+        throw armnn::InvalidArgumentException("BFloat16 and Float16 optimization cannot be enabled at the same time.");
+    }
+
     const Network& network = *boost::polymorphic_downcast<const Network*>(&inNetwork);
     std::unique_ptr<Graph> graph = std::make_unique<Graph>(network.GetGraph());
 
@@ -830,10 +1057,16 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
     Optimizer::Pass(optGraph, MakeOptimizations(SquashEqualPermuteSiblings(),
                                                 SquashEqualReshapeSiblings(),
                                                 OptimizeInversePermutes(),
+                                                OptimizeInverseQuantizations(),
+                                                FuseConsecutiveQuantizations(),
                                                 MovePermuteUp(),
                                                 PermuteAsReshape(),
                                                 OptimizeConsecutiveReshapes(),
                                                 FoldPadIntoConvolution2d(),
+                                                FoldMultiplicationIntoConvolution2d(),
+                                                FoldAdditionIntoConvolution2d(),
+                                                FoldMultiplicationIntoFullyConnected(),
+                                                FoldAdditionIntoFullyConnected(),
                                                 PermuteAndBatchToSpaceAsDepthToSpace()));
 
     // Infer the tensor infos for all output slots. Throws an exception on failure
@@ -846,6 +1079,16 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
         Optimizer::Pass(optGraph, MakeOptimizations(ConvertConstantsFloatToHalf()));
     }
 
+    // If Fp32 to Bf16 optimization is set run the weight bound layers of the Fp32 network in Bf16
+    if (options.m_ReduceFp32ToBf16)
+    {
+        Optimizer::Pass(optGraph, MakeOptimizations(Fp32NetworkToBf16Converter()));
+        Optimizer::Pass(optGraph, MakeOptimizations(ConvertConstantsFloatToBFloat()));
+    }
+
+    // Merge the constants with equal contents, which can then be stored once
+    Optimizer::Pass(optGraph, MakeOptimizations(DeduplicateConstants()));
+
     // Initialize backend settings
     BackendSettings backendSettings(backendPreferences, deviceSpec);
     if (backendSettings.GetAvailablePreferredBackends().empty())
@@ -875,8 +1118,29 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
         return IOptimizedNetworkPtr(nullptr, &IOptimizedNetwork::Destroy);
     }
 
+    // If requested, move layers between the supporting backends to minimise the estimated latency
+    if (options.m_CostModelBackendAssignment)
+    {
+        BackendCostModel costModel;
+        for (auto&& backendThroughput : options.m_BackendThroughputs)
+        {
+            costModel.SetBackendThroughput(backendThroughput.first, backendThroughput.second);
+        }
+        for (auto&& layerCosts : options.m_MeasuredLayerCostsUs)
+        {
+            for (auto&& backendCost : layerCosts.second)
+            {
+                costModel.SetMeasuredLayerCost(layerCosts.first, backendCost.first, backendCost.second);
+            }
+        }
+
+        // Every layer keeps a backend supporting it, so the assignment cannot fail
+        AssignBackendsByCost(optGraph, backendSettings, costModel, messages);
+    }
+
     Optimizer::Pass(optGraph, MakeOptimizations(OptimizeInverseConversionsFp16(),
-                                                OptimizeInverseConversionsFp32()));
+                                                OptimizeInverseConversionsFp32(),
+                                                OptimizeInverseConversionsBf16()));
 
     // Apply the backend-specific optimizations
     OptimizationResult backendOptimizationResult = ApplyBackendOptimizations(optNetObjPtr,
@@ -913,6 +1177,8 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
     // Convert constants
     Optimizer::Pass(optGraph, MakeOptimizations(ConvertConstantsFloatToHalf()));
     Optimizer::Pass(optGraph, MakeOptimizations(ConvertConstantsHalfToFloat()));
+    Optimizer::Pass(optGraph, MakeOptimizations(ConvertConstantsFloatToBFloat()));
+    Optimizer::Pass(optGraph, MakeOptimizations(ConvertConstantsBFloatToFloat()));
 
     // Run backend specific optimizations (deprecated)
     for (auto&& chosenBackend : backendSettings.m_SelectedBackends)
@@ -934,6 +1200,43 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
     return optNet;
 }
 
+IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
+                              const std::vector<BackendId>& backendPreferences,
+                              const IDeviceSpec& deviceSpec,
+                              IOptimizedNetworkCache& cache,
+                              const OptimizerOptions& options,
+                              Optional<std::vector<std::string>&> messages)
+{
+    const Network& network = *boost::polymorphic_downcast<const Network*>(&inNetwork);
+    OptimizedNetworkCache& networkCache = *boost::polymorphic_downcast<OptimizedNetworkCache*>(&cache);
+
+    const OptimizedNetworkCache::Settings settings{ backendPreferences, deviceSpec.GetSupportedBackends(), options };
+    const size_t hash = OptimizedNetworkCache::GetHash(network.GetGraph(), settings);
+
+    IOptimizedNetworkPtr optNet = networkCache.Find(hash, network.GetGraph(), settings, messages);
+    if (optNet)
+    {
+        return optNet;
+    }
+
+    // The messages of this optimization are kept with the network, to be reported again when it is found
+    std::vector<std::string> localMessages;
+    std::vector<std::string>& allMessages = messages ? messages.value() : localMessages;
+    const size_t firstMessage = allMessages.size();
+
+    optNet = Optimize(inNetwork, backendPreferences, deviceSpec, options,
+                      Optional<std::vector<std::string>&>(allMessages));
+    if (optNet)
+    {
+        auto optimizeMessages = std::next(allMessages.begin(), boost::numeric_cast<std::ptrdiff_t>(firstMessage));
+        networkCache.Insert(hash, network.GetGraph(), settings,
+                            *boost::polymorphic_downcast<OptimizedNetwork*>(optNet.get()),
+                            std::vector<std::string>(optimizeMessages, allMessages.end()));
+    }
+
+    return optNet;
+}
+
 Network::Network()
 : m_Graph(std::make_unique<Graph>()),
   m_Guid(profiling::ProfilingService::Instance().NextGuid())
@@ -944,6 +1247,35 @@ Network::~Network()
 {
 }
 
+void Network::AddConstTensorStorage(std::shared_ptr<const void> storage, const void* data, size_t size)
+{
+    if (storage)
+    {
+        m_ConstTensorStorages.push_back({ std::move(storage), data, size });
+    }
+}
+
+std::unique_ptr<ScopedCpuTensorHandle> Network::CreateConstTensorHandle(const ConstTensor& tensor) const
+{
+    const uintptr_t begin = reinterpret_cast<uintptr_t>(tensor.GetMemoryArea());
+    const size_t numBytes = tensor.GetNumBytes();
+    for (const ConstTensorStorage& constTensorStorage : m_ConstTensorStorages)
+    {
+        const uintptr_t storage = reinterpret_cast<uintptr_t>(constTensorStorage.m_Data);
+        if (begin >= storage && numBytes <= constTensorStorage.m_Size &&
+            begin - storage <= constTensorStorage.m_Size - numBytes)
+        {
+            return std::make_unique<ScopedCpuTensorHandle>(tensor, constTensorStorage.m_Storage);
+        }
+    }
+
+    // The copy is held in shared storage. Constant tensors are never modified in place, so the copies of the
+    // graph made by Optimize and the workloads created from it reference this memory instead of copying it again.
+    std::shared_ptr<ScopedCpuTensorHandle> storage = std::make_shared<ScopedCpuTensorHandle>(tensor);
+    return std::make_unique<ScopedCpuTensorHandle>(ConstTensor(tensor.GetInfo(), storage->GetConstTensor<void>()),
+                                                   storage);
+}
+
 Status Network::PrintGraph()
 {
     m_Graph->Print();
@@ -985,11 +1317,11 @@ IConnectableLayer* Network::AddFullyConnectedLayerImpl(const FullyConnectedDescr
 
     const auto layer = m_Graph->AddLayer<FullyConnectedLayer>(fullyConnectedDescriptor, name);
 
-    layer->m_Weight = std::make_unique<ScopedCpuTensorHandle>(weights);
+    layer->m_Weight = CreateConstTensorHandle(weights);
 
     if (fullyConnectedDescriptor.m_BiasEnabled)
     {
-        layer->m_Bias = std::make_unique<ScopedCpuTensorHandle>(biases.value());
+        layer->m_Bias = CreateConstTensorHandle(biases.value());
     }
 
     return layer;
@@ -1038,11 +1370,11 @@ IConnectableLayer* Network::AddConvolution2dLayerImpl(const Convolution2dDescrip
 
     const auto layer = m_Graph->AddLayer<Convolution2dLayer>(convolution2dDescriptor, name);
 
-    layer->m_Weight = std::make_unique<ScopedCpuTensorHandle>(weights);
+    layer->m_Weight = CreateConstTensorHandle(weights);
 
     if (convolution2dDescriptor.m_BiasEnabled)
     {
-        layer->m_Bias = std::make_unique<ScopedCpuTensorHandle>(biases.value());
+        layer->m_Bias = CreateConstTensorHandle(biases.value());
     }
 
     return layer;
@@ -1086,11 +1418,11 @@ IConnectableLayer* Network::AddDepthwiseConvolution2dLayerImpl(
 
     const auto layer = m_Graph->AddLayer<DepthwiseConvolution2dLayer>(convolution2dDescriptor, name);
 
-    layer->m_Weight = std::make_unique<ScopedCpuTensorHandle>(weights);
+    layer->m_Weight = CreateConstTensorHandle(weights);
 
     if (convolution2dDescriptor.m_BiasEnabled)
     {
-        layer->m_Bias = std::make_unique<ScopedCpuTensorHandle>(biases.value());
+        layer->m_Bias = CreateConstTensorHandle(biases.value());
     }
 
     return layer;
@@ -1135,7 +1467,7 @@ IConnectableLayer* Network::AddDetectionPostProcessLayer(const armnn::DetectionP
 {
     const auto layer = m_Graph->AddLayer<DetectionPostProcessLayer>(descriptor, name);
 
-    layer->m_Anchors = std::make_unique<ScopedCpuTensorHandle>(anchors);
+    layer->m_Anchors = CreateConstTensorHandle(anchors);
 
     return layer;
 }
@@ -1233,10 +1565,10 @@ IConnectableLayer* Network::AddBatchNormalizationLayer(const BatchNormalizationD
 {
     const auto layer = m_Graph->AddLayer<BatchNormalizationLayer>(desc, name);
 
-    layer->m_Mean = std::make_unique<ScopedCpuTensorHandle>(mean);
-    layer->m_Variance = std::make_unique<ScopedCpuTensorHandle>(variance);
-    layer->m_Beta = std::make_unique<ScopedCpuTensorHandle>(beta);
-    layer->m_Gamma = std::make_unique<ScopedCpuTensorHandle>(gamma);
+    layer->m_Mean = CreateConstTensorHandle(mean);
+    layer->m_Variance = CreateConstTensorHandle(variance);
+    layer->m_Beta = CreateConstTensorHandle(beta);
+    layer->m_Gamma = CreateConstTensorHandle(gamma);
 
     return layer;
 }
@@ -1281,7 +1613,7 @@ IConnectableLayer* Network::AddConstantLayer(const ConstTensor& input, const cha
 {
     auto layer = m_Graph->AddLayer<ConstantLayer>(name);
 
-    layer->m_LayerOutput = std::make_unique<ScopedCpuTensorHandle>(input);
+    layer->m_LayerOutput = CreateConstTensorHandle(input);
 
     return layer;
 }
@@ -1317,23 +1649,23 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
 
     //Lstm Basic Parameters
     layer->m_BasicParameters.m_InputToForgetWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputToForgetWeights));
+        CreateConstTensorHandle(*(params.m_InputToForgetWeights));
     layer->m_BasicParameters.m_InputToCellWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputToCellWeights));
+        CreateConstTensorHandle(*(params.m_InputToCellWeights));
     layer->m_BasicParameters.m_InputToOutputWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputToOutputWeights));
+        CreateConstTensorHandle(*(params.m_InputToOutputWeights));
     layer->m_BasicParameters.m_RecurrentToForgetWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_RecurrentToForgetWeights));
+        CreateConstTensorHandle(*(params.m_RecurrentToForgetWeights));
     layer->m_BasicParameters.m_RecurrentToCellWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_RecurrentToCellWeights));
+        CreateConstTensorHandle(*(params.m_RecurrentToCellWeights));
     layer->m_BasicParameters.m_RecurrentToOutputWeights =
-        std::make_unique<ScopedCpuTensorHandle>(*(params.m_RecurrentToOutputWeights));
+        CreateConstTensorHandle(*(params.m_RecurrentToOutputWeights));
     layer->m_BasicParameters.m_ForgetGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_ForgetGateBias));
+            CreateConstTensorHandle(*(params.m_ForgetGateBias));
     layer->m_BasicParameters.m_CellBias =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellBias));
+            CreateConstTensorHandle(*(params.m_CellBias));
     layer->m_BasicParameters.m_OutputGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_OutputGateBias));
+            CreateConstTensorHandle(*(params.m_OutputGateBias));
 
     //Lstm Cifg parameters
     if(!descriptor.m_CifgEnabled)
@@ -1352,17 +1684,17 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
             throw InvalidArgumentException("AddLstmLayer: Input Gate Bias cannot be NULL");
         }
         layer->m_CifgParameters.m_InputToInputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputToInputWeights));
+            CreateConstTensorHandle(*(params.m_InputToInputWeights));
         layer->m_CifgParameters.m_RecurrentToInputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_RecurrentToInputWeights));
+            CreateConstTensorHandle(*(params.m_RecurrentToInputWeights));
         // In the VTS tests, cell-to-input weights may be null, even if the other CIFG params are not.
         if(params.m_CellToInputWeights != nullptr)
         {
             layer->m_CifgParameters.m_CellToInputWeights =
-                    std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellToInputWeights));
+                    CreateConstTensorHandle(*(params.m_CellToInputWeights));
         }
         layer->m_CifgParameters.m_InputGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputGateBias));
+            CreateConstTensorHandle(*(params.m_InputGateBias));
     }
 
     //Lstm projection parameters
@@ -1373,11 +1705,11 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
             throw InvalidArgumentException("AddLstmLayer: Projection Weights cannot be NULL");
         }
         layer->m_ProjectionParameters.m_ProjectionWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_ProjectionWeights));
+            CreateConstTensorHandle(*(params.m_ProjectionWeights));
         if(params.m_ProjectionBias != nullptr)
         {
             layer->m_ProjectionParameters.m_ProjectionBias =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_ProjectionBias));
+                CreateConstTensorHandle(*(params.m_ProjectionBias));
         }
     }
 
@@ -1393,9 +1725,9 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
             throw InvalidArgumentException("AddLstmLayer: Cell To Output Weights cannot be NULL");
         }
         layer->m_PeepholeParameters.m_CellToForgetWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellToForgetWeights));
+            CreateConstTensorHandle(*(params.m_CellToForgetWeights));
         layer->m_PeepholeParameters.m_CellToOutputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellToOutputWeights));
+            CreateConstTensorHandle(*(params.m_CellToOutputWeights));
     }
 
     //Lstm Layer Normalization params
@@ -1408,7 +1740,7 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
                 throw InvalidArgumentException("AddLstmLayer: Input layer normalization weights cannot be NULL");
             }
             layer->m_LayerNormParameters.m_InputLayerNormWeights =
-                    std::make_unique<ScopedCpuTensorHandle>(*(params.m_InputLayerNormWeights));
+                    CreateConstTensorHandle(*(params.m_InputLayerNormWeights));
         }
 
         if(params.m_ForgetLayerNormWeights == nullptr)
@@ -1424,11 +1756,11 @@ IConnectableLayer* Network::AddLstmLayer(const LstmDescriptor&  descriptor,
             throw InvalidArgumentException("AddLstmLayer: Output layer normalization weights cannot be NULL");
         }
         layer->m_LayerNormParameters.m_ForgetLayerNormWeights =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_ForgetLayerNormWeights));
+                CreateConstTensorHandle(*(params.m_ForgetLayerNormWeights));
         layer->m_LayerNormParameters.m_CellLayerNormWeights =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_CellLayerNormWeights));
+                CreateConstTensorHandle(*(params.m_CellLayerNormWeights));
         layer->m_LayerNormParameters.m_OutputLayerNormWeights =
-                std::make_unique<ScopedCpuTensorHandle>(*(params.m_OutputLayerNormWeights));
+                CreateConstTensorHandle(*(params.m_OutputLayerNormWeights));
     }
     return layer;
 }
@@ -1516,11 +1848,11 @@ IConnectableLayer* Network::AddTransposeConvolution2dLayer(const TransposeConvol
 
     const auto layer = m_Graph->AddLayer<TransposeConvolution2dLayer>(descriptor, name);
 
-    layer->m_Weight = std::make_unique<ScopedCpuTensorHandle>(weights);
+    layer->m_Weight = CreateConstTensorHandle(weights);
 
     if (descriptor.m_BiasEnabled)
     {
-        layer->m_Bias = std::make_unique<ScopedCpuTensorHandle>(biases.value());
+        layer->m_Bias = CreateConstTensorHandle(biases.value());
     }
 
     return layer;
@@ -1546,33 +1878,33 @@ IConnectableLayer* Network::AddQuantizedLstmLayer(const QuantizedLstmInputParams
 
     // InputToX weights
     layer->m_QuantizedLstmParameters.m_InputToInputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetInputToInputWeights());
+            CreateConstTensorHandle(params.GetInputToInputWeights());
     layer->m_QuantizedLstmParameters.m_InputToForgetWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetInputToForgetWeights());
+            CreateConstTensorHandle(params.GetInputToForgetWeights());
     layer->m_QuantizedLstmParameters.m_InputToCellWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetInputToCellWeights());
+            CreateConstTensorHandle(params.GetInputToCellWeights());
     layer->m_QuantizedLstmParameters.m_InputToOutputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetInputToOutputWeights());
+            CreateConstTensorHandle(params.GetInputToOutputWeights());
 
     // RecurrentToX weights
     layer->m_QuantizedLstmParameters.m_RecurrentToInputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetRecurrentToInputWeights());
+            CreateConstTensorHandle(params.GetRecurrentToInputWeights());
     layer->m_QuantizedLstmParameters.m_RecurrentToForgetWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetRecurrentToForgetWeights());
+            CreateConstTensorHandle(params.GetRecurrentToForgetWeights());
     layer->m_QuantizedLstmParameters.m_RecurrentToCellWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetRecurrentToCellWeights());
+            CreateConstTensorHandle(params.GetRecurrentToCellWeights());
     layer->m_QuantizedLstmParameters.m_RecurrentToOutputWeights =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetRecurrentToOutputWeights());
+            CreateConstTensorHandle(params.GetRecurrentToOutputWeights());
 
     // Bias
     layer->m_QuantizedLstmParameters.m_InputGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetInputGateBias());
+            CreateConstTensorHandle(params.GetInputGateBias());
     layer->m_QuantizedLstmParameters.m_ForgetGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetForgetGateBias());
+            CreateConstTensorHandle(params.GetForgetGateBias());
     layer->m_QuantizedLstmParameters.m_CellBias =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetCellBias());
+            CreateConstTensorHandle(params.GetCellBias());
     layer->m_QuantizedLstmParameters.m_OutputGateBias =
-            std::make_unique<ScopedCpuTensorHandle>(params.GetOutputGateBias());
+            CreateConstTensorHandle(params.GetOutputGateBias());
 
     return layer;
 }
@@ -11,6 +11,7 @@
 #include <armnn/Types.hpp>
 
 #include <armnn/INetwork.hpp>
+#include <armnn/backends/CpuTensorHandleFwd.hpp>
 
 #include <string>
 #include <vector>
@@ -31,6 +32,7 @@ public:
     ~Network();
 
     const Graph& GetGraph() const { return *m_Graph; }
+    Graph& GetGraph() { return *m_Graph; }
 
     Status PrintGraph() override;
 
@@ -237,7 +239,16 @@ public:
 
     void Accept(ILayerVisitor& visitor) const override;
 
+    /// Constant tensors added to the network whose contents lie within [data, data + size) are referenced
+    /// by the layers instead of being copied. The layers keep storage alive for as long as they use it.
+    /// Several storages can be added, e.g. one for each file the constants are mapped from.
+    void AddConstTensorStorage(std::shared_ptr<const void> storage, const void* data, size_t size);
+
 private:
+    /// Creates the handle holding a constant tensor of a layer, referencing the constant tensor storage if possible.
+    /// Otherwise the tensor is copied once into shared storage, which later copies of the handle reference.
+    std::unique_ptr<ScopedCpuTensorHandle> CreateConstTensorHandle(const ConstTensor& tensor) const;
+
     IConnectableLayer* AddFullyConnectedLayerImpl(const FullyConnectedDescriptor& fullyConnectedDescriptor,
                                                   const ConstTensor& weights,
                                                   const Optional<ConstTensor>& biases,
@@ -256,6 +267,15 @@ private:
 
     std::unique_ptr<Graph> m_Graph;
     profiling::ProfilingGuid m_Guid;
+
+    struct ConstTensorStorage
+    {
+        std::shared_ptr<const void> m_Storage;
+        const void*                 m_Data;
+        size_t                      m_Size;
+    };
+
+    std::vector<ConstTensorStorage> m_ConstTensorStorages;
 };
 
 class OptimizedNetwork final : public IOptimizedNetwork
@@ -270,6 +290,7 @@ public:
     profiling::ProfilingGuid GetGuid() const final { return m_Guid; };
 
     Graph& GetGraph() { return *m_Graph; }
+    const Graph& GetGraph() const { return *m_Graph; }
 
 private:
     std::unique_ptr<Graph> m_Graph;
@@ -294,6 +315,13 @@ using BackendsMap = std::map<BackendId, std::unique_ptr<class IBackendInternal>>
 BackendsMap CreateSupportedBackends(TensorHandleFactoryRegistry& handleFactoryRegistry,
                                     struct BackendSettings& backendSettings);
 
+/// Moves the layers of the graph, already assigned to their first supported backend, between the backends supporting
+/// them to minimise the latency estimated by the cost model, including the copies between backends.
+void AssignBackendsByCost(Graph& graph,
+                          struct BackendSettings& backendSettings,
+                          const class BackendCostModel& costModel,
+                          Optional<std::vector<std::string>&> messages);
+
 OptimizationResult SelectTensorHandleStrategy(Graph& optGraph,
                                               BackendsMap& backends,
                                               TensorHandleFactoryRegistry& registry,
@@ -16,56 +16,49 @@ namespace armnn
 namespace
 {
 
-void UpdateOutputSlotFp16ToFp32(OutputSlot& outputSlot)
-{
-    const TensorInfo& origTensorInfo = outputSlot.GetTensorInfo();
-    TensorInfo newTensorInfo(origTensorInfo);
-    newTensorInfo.SetDataType(DataType::Float32);
-    outputSlot.SetTensorInfo(newTensorInfo);
-}
-
-void ChangeOutputFp16ToFp32(Layer& layer)
+void ChangeOutputDataType(Layer& layer, DataType from, DataType to)
 {
     for (auto&& outputSlot = layer.BeginOutputSlots(); outputSlot != layer.EndOutputSlots(); ++outputSlot)
     {
-        if (outputSlot->GetTensorInfo().GetDataType() == DataType::Float16)
+        TensorInfo newTensorInfo(outputSlot->GetTensorInfo());
+        if (newTensorInfo.GetDataType() == from)
         {
-            UpdateOutputSlotFp16ToFp32(*outputSlot);
+            newTensorInfo.SetDataType(to);
+            outputSlot->SetTensorInfo(newTensorInfo);
         }
     }
 }
 
-} // anonymous namespace
-
-std::vector<ConvertFp16ToFp32Layer*> InsertConvertFp16ToFp32LayersBefore(Graph& graph,
-                                                                         Layer& layer,
-                                                                         bool expectCorrectInputType)
+/// Inserts a conversion layer from the given data type before each input slot of a layer, or only before the
+/// input slots connected to a tensor of that data type if expectCorrectInputType is set.
+template <typename ConvertLayer>
+std::vector<ConvertLayer*> InsertConvertLayersBefore(Graph& graph,
+                                                     Layer& layer,
+                                                     bool expectCorrectInputType,
+                                                     DataType from,
+                                                     DataType to,
+                                                     const std::string& namePrefix)
 {
-    std::vector<ConvertFp16ToFp32Layer*> convertLayers;
+    std::vector<ConvertLayer*> convertLayers;
     convertLayers.reserve(layer.GetNumInputSlots());
 
-    // Insert a ConvertFp16ToFp32Layer before each input slot
     for (auto&& inputSlot = layer.BeginInputSlots(); inputSlot != layer.EndInputSlots(); ++inputSlot)
     {
         bool allowInsert = true;
         if (expectCorrectInputType)
         {
-            // Only insert ConvertFp16ToFp32Layer before FP16 input slots
             OutputSlot* connectedOutputSlot = inputSlot->GetConnectedOutputSlot();
-            allowInsert =
-                connectedOutputSlot && connectedOutputSlot->GetTensorInfo().GetDataType() == DataType::Float16;
+            allowInsert = connectedOutputSlot && connectedOutputSlot->GetTensorInfo().GetDataType() == from;
         }
 
         if (allowInsert)
         {
             const std::string name =
-                std::string("convert_fp16_to_fp32-" + std::to_string(inputSlot->GetSlotIndex()) + "-") +
-                layer.GetName();
-            ConvertFp16ToFp32Layer* convertLayer =
-                graph.InsertNewLayer<ConvertFp16ToFp32Layer>(*inputSlot, name.c_str());
+                namePrefix + "-" + std::to_string(inputSlot->GetSlotIndex()) + "-" + layer.GetName();
+            ConvertLayer* convertLayer = graph.InsertNewLayer<ConvertLayer>(*inputSlot, name.c_str());
 
             TensorInfo convertInfo = convertLayer->GetInputSlot(0).GetConnectedOutputSlot()->GetTensorInfo();
-            convertInfo.SetDataType(DataType::Float32);
+            convertInfo.SetDataType(to);
 
             convertLayer->GetOutputSlot().SetTensorInfo(convertInfo);
 
@@ -76,29 +69,32 @@ std::vector<ConvertFp16ToFp32Layer*> InsertConvertFp16ToFp32LayersBefore(Graph&
     return convertLayers;
 }
 
-std::vector<ConvertFp32ToFp16Layer*> InsertConvertFp32ToFp16LayersAfter(Graph& graph, Layer& layer)
+/// Changes the output slots of a layer from the target data type of the conversion to its source data type,
+/// and inserts a conversion layer back to the target data type after each of them.
+template <typename ConvertLayer>
+std::vector<ConvertLayer*> InsertConvertLayersAfter(Graph& graph,
+                                                    Layer& layer,
+                                                    DataType from,
+                                                    DataType to,
+                                                    const std::string& namePrefix)
 {
     const unsigned int numOutputSlots = layer.GetNumOutputSlots();
 
-    std::vector<ConvertFp32ToFp16Layer*> convertLayers;
+    std::vector<ConvertLayer*> convertLayers;
     convertLayers.reserve(numOutputSlots);
 
-    // Update FP16 output slots to FP32 on current layer
-    ChangeOutputFp16ToFp32(layer);
+    ChangeOutputDataType(layer, to, from);
 
-    // Insert a ConvertFp32ToFp16Layer after each FP32 output slot
     for (unsigned int slotIndex = 0u; slotIndex < numOutputSlots; ++slotIndex)
     {
         OutputSlot& outputSlot = layer.GetOutputSlot(slotIndex);
-        if(outputSlot.GetTensorInfo().GetDataType() == DataType::Float32)
+        if (outputSlot.GetTensorInfo().GetDataType() == from)
         {
-            const std::string name =
-                std::string("convert_fp32_to_fp16-" + std::to_string(slotIndex) + "-") + layer.GetName();
-            ConvertFp32ToFp16Layer* convertLayer =
-                graph.InsertNewLayer<ConvertFp32ToFp16Layer>(outputSlot, name.c_str());
+            const std::string name = namePrefix + "-" + std::to_string(slotIndex) + "-" + layer.GetName();
+            ConvertLayer* convertLayer = graph.InsertNewLayer<ConvertLayer>(outputSlot, name.c_str());
 
             TensorInfo convertInfo = convertLayer->GetInputSlot(0).GetConnectedOutputSlot()->GetTensorInfo();
-            convertInfo.SetDataType(DataType::Float16);
+            convertInfo.SetDataType(to);
 
             convertLayer->GetOutputSlot().SetTensorInfo(convertInfo);
 
@@ -109,6 +105,53 @@ std::vector<ConvertFp32ToFp16Layer*> InsertConvertFp32ToFp16LayersAfter(Graph& g
     return convertLayers;
 }
 
+} // anonymous namespace
+
+std::vector<ConvertBf16ToFp32Layer*> InsertConvertBf16ToFp32LayersBefore(Graph& graph,
+                                                                         Layer& layer,
+                                                                         bool expectCorrectInputType)
+{
+    return InsertConvertLayersBefore<ConvertBf16ToFp32Layer>(
+        graph, layer, expectCorrectInputType, DataType::BFloat16, DataType::Float32, "convert_bf16_to_fp32");
+}
+
+std::vector<ConvertFp32ToBf16Layer*> InsertConvertFp32ToBf16LayersBefore(Graph& graph,
+                                                                         Layer& layer,
+                                                                         bool expectCorrectInputType)
+{
+    return InsertConvertLayersBefore<ConvertFp32ToBf16Layer>(
+        graph, layer, expectCorrectInputType, DataType::Float32, DataType::BFloat16, "convert_fp32_to_bf16");
+}
+
+std::vector<ConvertBf16ToFp32Layer*> InsertConvertBf16ToFp32LayersAfter(Graph& graph, Layer& layer)
+{
+    // The layer produces BFloat16 and is followed by a conversion back to Float32
+    return InsertConvertLayersAfter<ConvertBf16ToFp32Layer>(
+        graph, layer, DataType::BFloat16, DataType::Float32, "convert_bf16_to_fp32");
+}
+
+std::vector<ConvertFp32ToBf16Layer*> InsertConvertFp32ToBf16LayersAfter(Graph& graph, Layer& layer)
+{
+    // The layer produces Float32 and is followed by a conversion back to BFloat16
+    return InsertConvertLayersAfter<ConvertFp32ToBf16Layer>(
+        graph, layer, DataType::Float32, DataType::BFloat16, "convert_fp32_to_bf16");
+}
+
+std::vector<ConvertFp16ToFp32Layer*> InsertConvertFp16ToFp32LayersBefore(Graph& graph,
+                                                                         Layer& layer,
+                                                                         bool expectCorrectInputType)
+{
+    return InsertConvertLayersBefore<ConvertFp16ToFp32Layer>(
+        graph, layer, expectCorrectInputType, DataType::Float16, DataType::Float32, "convert_fp16_to_fp32");
+}
+
+std::vector<ConvertFp32ToFp16Layer*> InsertConvertFp32ToFp16LayersAfter(Graph& graph, Layer& layer)
+{
+    // The layer produces Float32 and is followed by a conversion back to Float16
+    return InsertConvertLayersAfter<ConvertFp32ToFp16Layer>(
+        graph, layer, DataType::Float32, DataType::Float16, "convert_fp32_to_fp16");
+}
+
 std::vector<DebugLayer*> InsertDebugLayerAfter(Graph& graph, Layer& layer)
 {
     std::vector<DebugLayer*> debugLayers;
@@ -0,0 +1,504 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "OptimizedNetworkCache.hpp"
+
+#include "Network.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <armnnUtils/TensorUtils.hpp>
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <boost/functional/hash.hpp>
+#include <boost/polymorphic_cast.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <queue>
+#include <unordered_map>
+
+namespace armnn
+{
+
+IOptimizedNetworkCache* IOptimizedNetworkCache::CreateRaw(size_t maxNumEntries)
+{
+    if (maxNumEntries == 0)
+    {
+        throw InvalidArgumentException("An optimized network cache must be able to hold at least one network");
+    }
+    return new OptimizedNetworkCache(maxNumEntries);
+}
+
+IOptimizedNetworkCachePtr IOptimizedNetworkCache::Create(size_t maxNumEntries)
+{
+    return IOptimizedNetworkCachePtr(CreateRaw(maxNumEntries), &IOptimizedNetworkCache::Destroy);
+}
+
+void IOptimizedNetworkCache::Destroy(IOptimizedNetworkCache* cache)
+{
+    delete boost::polymorphic_downcast<OptimizedNetworkCache*>(cache);
+}
+
+namespace
+{
+
+void HashTensorInfo(size_t& seed, const TensorInfo& info)
+{
+    boost::hash_combine(seed, static_cast<int>(info.GetDataType()));
+    for (unsigned int i = 0; i < info.GetNumDimensions(); ++i)
+    {
+        boost::hash_combine(seed, info.GetShape()[i]);
+    }
+    boost::hash_combine(seed, info.GetQuantizationScales());
+    boost::hash_combine(seed, info.GetQuantizationOffset());
+}
+
+std::vector<const ScopedCpuTensorHandle*> GetConstantTensors(const Layer& layer)
+{
+    std::vector<const ScopedCpuTensorHandle*> constants;
+
+    // The handles are only read
+    const_cast<Layer&>(layer).OperateOnConstantTensors([&constants](std::unique_ptr<ScopedCpuTensorHandle>& handle)
+    {
+        constants.push_back(handle.get());
+    });
+    return constants;
+}
+
+/// Returns the layers of the graph in topological order, taking the layer with the lowest guid first when several
+/// are ready. Unlike the order of the graph, which TopologicalSort() changes, this only depends on the structure of
+/// the graph and on the order in which its layers were created.
+std::vector<const Layer*> GetCanonicalOrder(const Graph& graph)
+{
+    auto compareGuids = [](const Layer* lhs, const Layer* rhs)
+    {
+        return lhs->GetGuid() > rhs->GetGuid();
+    };
+    std::priority_queue<const Layer*, std::vector<const Layer*>, decltype(compareGuids)> readyLayers(compareGuids);
+
+    std::unordered_map<const Layer*, unsigned int> numPendingInputs;
+    for (const Layer* layer : graph)
+    {
+        unsigned int numInputs = 0;
+        for (const InputSlot& inputSlot : layer->GetInputSlots())
+        {
+            if (inputSlot.GetConnectedOutputSlot() != nullptr)
+            {
+                ++numInputs;
+            }
+        }
+
+        if (numInputs == 0)
+        {
+            readyLayers.push(layer);
+        }
+        else
+        {
+            numPendingInputs.emplace(layer, numInputs);
+        }
+    }
+
+    std::vector<const Layer*> order;
+    order.reserve(graph.GetNumLayers());
+    while (!readyLayers.empty())
+    {
+        const Layer* layer = readyLayers.top();
+        readyLayers.pop();
+        order.push_back(layer);
+
+        for (const OutputSlot& outputSlot : layer->GetOutputSlots())
+        {
+            for (const InputSlot* connection : outputSlot.GetConnections())
+            {
+                const Layer* consumer = &connection->GetOwningLayer();
+                if (--numPendingInputs.at(consumer) == 0)
+                {
+                    readyLayers.push(consumer);
+                }
+            }
+        }
+    }
+
+    if (order.size() != graph.GetNumLayers())
+    {
+        throw GraphValidationException("The graph contains a cycle");
+    }
+    return order;
+}
+
+/// Returns the position of each layer in the given order.
+std::unordered_map<const Layer*, size_t> GetLayerPositions(const std::vector<const Layer*>& order)
+{
+    std::unordered_map<const Layer*, size_t> positions;
+    for (const Layer* layer : order)
+    {
+        positions.emplace(layer, positions.size());
+    }
+    return positions;
+}
+
+bool AreEqual(const BackendThroughput& lhs, const BackendThroughput& rhs)
+{
+    return lhs.m_GigaFlopsPerSecond == rhs.m_GigaFlopsPerSecond &&
+           lhs.m_GigaBytesPerSecond == rhs.m_GigaBytesPerSecond &&
+           lhs.m_DispatchOverheadUs == rhs.m_DispatchOverheadUs;
+}
+
+bool AreEqual(const OptimizerOptions& lhs, const OptimizerOptions& rhs)
+{
+    return lhs.m_ReduceFp32ToFp16           == rhs.m_ReduceFp32ToFp16 &&
+           lhs.m_Debug                      == rhs.m_Debug &&
+           lhs.m_ReduceFp32ToBf16           == rhs.m_ReduceFp32ToBf16 &&
+           lhs.m_CostModelBackendAssignment == rhs.m_CostModelBackendAssignment &&
+           lhs.m_MeasuredLayerCostsUs       == rhs.m_MeasuredLayerCostsUs &&
+           lhs.m_BackendThroughputs.size()  == rhs.m_BackendThroughputs.size() &&
+           std::equal(lhs.m_BackendThroughputs.begin(), lhs.m_BackendThroughputs.end(),
+                      rhs.m_BackendThroughputs.begin(),
+                      [](const std::pair<const BackendId, BackendThroughput>& lhsThroughput,
+                         const std::pair<const BackendId, BackendThroughput>& rhsThroughput)
+                      {
+                          return lhsThroughput.first == rhsThroughput.first &&
+                                 AreEqual(lhsThroughput.second, rhsThroughput.second);
+                      });
+}
+
+bool AreEqual(const OptimizedNetworkCache::Settings& lhs, const OptimizedNetworkCache::Settings& rhs)
+{
+    return lhs.m_BackendPreferences == rhs.m_BackendPreferences &&
+           lhs.m_SupportedBackends  == rhs.m_SupportedBackends &&
+           AreEqual(lhs.m_Options, rhs.m_Options);
+}
+
+/// Copies an optimized graph, including the memory strategies chosen by Optimize().
+std::unique_ptr<Graph> CopyOptimizedGraph(const Graph& graph)
+{
+    auto copy = std::make_unique<Graph>(graph);
+
+    // The copied layers keep the guids of the original ones
+    std::unordered_map<LayerGuid, const Layer*> originals;
+    for (const Layer* layer : graph)
+    {
+        originals.emplace(layer->GetGuid(), layer);
+    }
+
+    for (Layer* layer : *copy)
+    {
+        const Layer& original = *originals.at(layer->GetGuid());
+        for (unsigned int slotIndex = 0; slotIndex < layer->GetNumOutputSlots(); ++slotIndex)
+        {
+            OutputSlot& outputSlot = layer->GetOutputSlot(slotIndex);
+            const OutputSlot& originalSlot = original.GetOutputSlot(slotIndex);
+
+            outputSlot.SetTensorHandleFactory(originalSlot.GetTensorHandleFactoryId());
+            for (unsigned int connectionIndex = 0; connectionIndex < outputSlot.GetNumConnections(); ++connectionIndex)
+            {
+                outputSlot.SetEdgeStrategy(connectionIndex, originalSlot.GetEdgeStrategyForConnection(connectionIndex));
+            }
+        }
+    }
+
+    return copy;
+}
+
+/// Moves the constant tensors of the graph to shared storage, so the copies of the graph reference them.
+void ShareConstantTensors(Graph& graph)
+{
+    for (Layer* layer : graph)
+    {
+        layer->OperateOnConstantTensors([](std::unique_ptr<ScopedCpuTensorHandle>& handle)
+        {
+            if (handle->GetSharedStorage() == nullptr)
+            {
+                std::shared_ptr<ScopedCpuTensorHandle> storage(std::move(handle));
+                handle = std::make_unique<ScopedCpuTensorHandle>(
+                    ConstTensor(storage->GetTensorInfo(), storage->GetConstTensor<void>()), storage);
+            }
+        });
+    }
+}
+
+} // anonymous namespace
+
+size_t GetStructuralHash(const Graph& graph)
+{
+    const std::vector<const Layer*> order = GetCanonicalOrder(graph);
+    const std::unordered_map<const Layer*, size_t> positions = GetLayerPositions(order);
+
+    size_t seed = 0;
+    ParameterStringifyFunction hashParameter = [&seed](const std::string& name, const std::string& value)
+    {
+        boost::hash_combine(seed, name);
+        boost::hash_combine(seed, value);
+    };
+
+    for (const Layer* layer : order)
+    {
+        boost::hash_combine(seed, static_cast<int>(layer->GetType()));
+        boost::hash_combine(seed, layer->GetNameStr());
+        layer->SerializeLayerParameters(hashParameter);
+
+        for (const InputSlot& inputSlot : layer->GetInputSlots())
+        {
+            const OutputSlot* connection = inputSlot.GetConnectedOutputSlot();
+            if (connection != nullptr)
+            {
+                boost::hash_combine(seed, positions.at(&connection->GetOwningLayer()));
+                boost::hash_combine(seed, connection->CalculateIndexOnOwner());
+            }
+        }
+
+        for (const OutputSlot& outputSlot : layer->GetOutputSlots())
+        {
+            HashTensorInfo(seed, outputSlot.GetTensorInfo());
+        }
+
+        for (const ScopedCpuTensorHandle* constant : GetConstantTensors(*layer))
+        {
+            boost::hash_combine(seed, armnnUtils::GetTensorContentHash(constant->GetTensorInfo(),
+                                                                       constant->GetConstTensor<void>()));
+        }
+    }
+
+    return seed;
+}
+
+bool AreStructurallyEqual(const Graph& lhs, const Graph& rhs)
+{
+    if (lhs.GetNumLayers() != rhs.GetNumLayers())
+    {
+        return false;
+    }
+
+    const std::vector<const Layer*> lhsOrder = GetCanonicalOrder(lhs);
+    const std::vector<const Layer*> rhsOrder = GetCanonicalOrder(rhs);
+    const std::unordered_map<const Layer*, size_t> lhsPositions = GetLayerPositions(lhsOrder);
+    const std::unordered_map<const Layer*, size_t> rhsPositions = GetLayerPositions(rhsOrder);
+
+    auto areConnectionsEqual = [&](const OutputSlot* lhsConnection, const OutputSlot* rhsConnection)
+    {
+        if (lhsConnection == nullptr || rhsConnection == nullptr)
+        {
+            return lhsConnection == rhsConnection;
+        }
+        const size_t lhsPosition = lhsPositions.at(&lhsConnection->GetOwningLayer());
+        const size_t rhsPosition = rhsPositions.at(&rhsConnection->GetOwningLayer());
+        return lhsPosition == rhsPosition &&
+               lhsConnection->CalculateIndexOnOwner() == rhsConnection->CalculateIndexOnOwner();
+    };
+
+    for (auto lhsIt = lhsOrder.begin(), rhsIt = rhsOrder.begin(); lhsIt != lhsOrder.end(); ++lhsIt, ++rhsIt)
+    {
+        const Layer& lhsLayer = **lhsIt;
+        const Layer& rhsLayer = **rhsIt;
+
+        if (!lhsLayer.HasEqualParameters(rhsLayer) ||
+            lhsLayer.GetNameStr() != rhsLayer.GetNameStr() ||
+            lhsLayer.GetNumInputSlots() != rhsLayer.GetNumInputSlots() ||
+            lhsLayer.GetNumOutputSlots() != rhsLayer.GetNumOutputSlots())
+        {
+            return false;
+        }
+
+        for (unsigned int i = 0; i < lhsLayer.GetNumInputSlots(); ++i)
+        {
+            if (!areConnectionsEqual(lhsLayer.GetInputSlot(i).GetConnectedOutputSlot(),
+                                     rhsLayer.GetInputSlot(i).GetConnectedOutputSlot()))
+            {
+                return false;
+            }
+        }
+
+        for (unsigned int i = 0; i < lhsLayer.GetNumOutputSlots(); ++i)
+        {
+            if (lhsLayer.GetOutputSlot(i).GetTensorInfo() != rhsLayer.GetOutputSlot(i).GetTensorInfo())
+            {
+                return false;
+            }
+        }
+
+        const std::vector<const ScopedCpuTensorHandle*> lhsConstants = GetConstantTensors(lhsLayer);
+        const std::vector<const ScopedCpuTensorHandle*> rhsConstants = GetConstantTensors(rhsLayer);
+        if (lhsConstants.size() != rhsConstants.size())
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < lhsConstants.size(); ++i)
+        {
+            const TensorInfo& info = lhsConstants[i]->GetTensorInfo();
+            const void* lhsData = lhsConstants[i]->GetConstTensor<void>();
+            const void* rhsData = rhsConstants[i]->GetConstTensor<void>();
+            if (info != rhsConstants[i]->GetTensorInfo() ||
+                (lhsData != rhsData && std::memcmp(lhsData, rhsData, info.GetNumBytes()) != 0))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+OptimizedNetworkCache::OptimizedNetworkCache(size_t maxNumEntries)
+    : m_MaxNumEntries(maxNumEntries)
+    , m_NumHits(0)
+    , m_NumMisses(0)
+    , m_NumRejected(0)
+{
+}
+
+size_t OptimizedNetworkCache::GetHash(const Graph& graph, const Settings& settings)
+{
+    size_t seed = GetStructuralHash(graph);
+
+    for (const BackendId& backend : settings.m_BackendPreferences)
+    {
+        boost::hash_combine(seed, backend.Get());
+    }
+
+    // The order of the set is unspecified, so its elements are hashed independently of it
+    size_t supportedBackendsHash = 0;
+    for (const BackendId& backend : settings.m_SupportedBackends)
+    {
+        supportedBackendsHash ^= std::hash<BackendId>()(backend);
+    }
+    boost::hash_combine(seed, supportedBackendsHash);
+
+    const OptimizerOptions& options = settings.m_Options;
+    boost::hash_combine(seed, options.m_ReduceFp32ToFp16);
+    boost::hash_combine(seed, options.m_Debug);
+    boost::hash_combine(seed, options.m_ReduceFp32ToBf16);
+    boost::hash_combine(seed, options.m_CostModelBackendAssignment);
+    for (const auto& layerCosts : options.m_MeasuredLayerCostsUs)
+    {
+        boost::hash_combine(seed, layerCosts.first);
+        for (const auto& backendCost : layerCosts.second)
+        {
+            boost::hash_combine(seed, backendCost.first.Get());
+            boost::hash_combine(seed, backendCost.second);
+        }
+    }
+    for (const auto& backendThroughput : options.m_BackendThroughputs)
+    {
+        boost::hash_combine(seed, backendThroughput.first.Get());
+        boost::hash_combine(seed, backendThroughput.second.m_GigaFlopsPerSecond);
+        boost::hash_combine(seed, backendThroughput.second.m_GigaBytesPerSecond);
+        boost::hash_combine(seed, backendThroughput.second.m_DispatchOverheadUs);
+    }
+
+    return seed;
+}
+
+std::list<OptimizedNetworkCache::Entry>::iterator OptimizedNetworkCache::FindEntry(size_t hash,
+                                                                                  const Graph& graph,
+                                                                                  const Settings& settings)
+{
+    return std::find_if(m_Entries.begin(), m_Entries.end(), [&](const Entry& entry)
+    {
+        return entry.m_Hash == hash &&
+               AreEqual(entry.m_Settings, settings) &&
+               AreStructurallyEqual(*entry.m_Graph, graph);
+    });
+}
+
+IOptimizedNetworkPtr OptimizedNetworkCache::Find(size_t hash,
+                                                 const Graph& graph,
+                                                 const Settings& settings,
+                                                 Optional<std::vector<std::string>&> messages)
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+    auto it = FindEntry(hash, graph, settings);
+    if (it == m_Entries.end())
+    {
+        ++m_NumMisses;
+        return IOptimizedNetworkPtr(nullptr, &IOptimizedNetwork::Destroy);
+    }
+
+    ++m_NumHits;
+    m_Entries.splice(m_Entries.begin(), m_Entries, it);
+
+    if (messages)
+    {
+        messages.value().insert(messages.value().end(), it->m_Messages.begin(), it->m_Messages.end());
+    }
+
+    return IOptimizedNetworkPtr(new OptimizedNetwork(CopyOptimizedGraph(*it->m_OptimizedGraph)),
+                                &IOptimizedNetwork::Destroy);
+}
+
+void OptimizedNetworkCache::Insert(size_t hash,
+                                   const Graph& graph,
+                                   const Settings& settings,
+                                   OptimizedNetwork& network,
+                                   std::vector<std::string> messages)
+{
+    // Pre-compiled layers without a copier hand their compiled object over to their copies, so they are not cached
+    for (const Layer* layer : network.GetGraph())
+    {
+        if (layer->GetType() == LayerType::PreCompiled &&
+            !boost::polymorphic_downcast<const PreCompiledLayer*>(layer)->IsPreCompiledObjectCopyable())
+        {
+            std::lock_guard<std::mutex> lockGuard(m_Mutex);
+            ++m_NumRejected;
+            return;
+        }
+    }
+
+    ShareConstantTensors(network.GetGraph());
+
+    Entry entry{ hash,
+                 std::make_unique<Graph>(graph),
+                 settings,
+                 CopyOptimizedGraph(network.GetGraph()),
+                 std::move(messages) };
+
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+    // The same network may have been optimized by another thread in the meantime
+    if (FindEntry(hash, graph, settings) != m_Entries.end())
+    {
+        return;
+    }
+
+    m_Entries.push_front(std::move(entry));
+    while (m_Entries.size() > m_MaxNumEntries)
+    {
+        m_Entries.pop_back();
+    }
+}
+
+size_t OptimizedNetworkCache::GetNumHits() const
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    return m_NumHits;
+}
+
+size_t OptimizedNetworkCache::GetNumMisses() const
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    return m_NumMisses;
+}
+
+size_t OptimizedNetworkCache::GetNumRejected() const
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    return m_NumRejected;
+}
+
+size_t OptimizedNetworkCache::GetNumEntries() const
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    return m_Entries.size();
+}
+
+void OptimizedNetworkCache::Clear()
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    m_Entries.clear();
+}
+
+} // namespace armnn
@@ -0,0 +1,96 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Graph.hpp"
+
+#include <armnn/BackendId.hpp>
+#include <armnn/INetwork.hpp>
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace armnn
+{
+
+class OptimizedNetwork;
+
+/// Returns a hash of the structure of a graph: the types, names and parameters of its layers, their connections,
+/// output tensor infos and constant tensor contents. Layers are taken in topological order, with independent layers
+/// in the order they were created in, so building a network the same way gives the same hash whether or not its
+/// graph has been sorted.
+size_t GetStructuralHash(const Graph& graph);
+
+/// Returns true if the graphs have the same structure, as described for GetStructuralHash, with equal constant
+/// tensor contents.
+bool AreStructurallyEqual(const Graph& lhs, const Graph& rhs);
+
+class OptimizedNetworkCache final : public IOptimizedNetworkCache
+{
+public:
+    /// Settings, other than the network, that the result of Optimize() depends on.
+    struct Settings
+    {
+        BackendIdVector  m_BackendPreferences;
+        BackendIdSet     m_SupportedBackends;
+        OptimizerOptions m_Options;
+    };
+
+    explicit OptimizedNetworkCache(size_t maxNumEntries);
+
+    /// Returns the hash of a graph optimized with the given settings, used to find it in the cache.
+    static size_t GetHash(const Graph& graph, const Settings& settings);
+
+    /// Returns a copy of the network cached for an equal graph optimized with equal settings, adding the warnings
+    /// of its optimization to messages, or nullptr if there is none.
+    IOptimizedNetworkPtr Find(size_t hash,
+                              const Graph& graph,
+                              const Settings& settings,
+                              Optional<std::vector<std::string>&> messages);
+
+    /// Caches the result of optimizing the graph with the given settings, unless it cannot be copied, which is
+    /// counted as rejected.
+    /// The constant tensors of the network are moved to shared storage, which its cached copy references.
+    void Insert(size_t hash,
+                const Graph& graph,
+                const Settings& settings,
+                OptimizedNetwork& network,
+                std::vector<std::string> messages);
+
+    size_t GetNumHits() const override;
+    size_t GetNumMisses() const override;
+    size_t GetNumRejected() const override;
+    size_t GetNumEntries() const override;
+    void Clear() override;
+
+private:
+    struct Entry
+    {
+        size_t                    m_Hash;
+        std::unique_ptr<Graph>    m_Graph;
+        Settings                  m_Settings;
+        std::unique_ptr<Graph>    m_OptimizedGraph;
+        std::vector<std::string>  m_Messages;
+    };
+
+    /// Returns the entry for an equal graph and settings, or m_Entries.end(). Must be called with m_Mutex held.
+    std::list<Entry>::iterator FindEntry(size_t hash, const Graph& graph, const Settings& settings);
+
+    const size_t m_MaxNumEntries;
+
+    mutable std::mutex m_Mutex;
+
+    /// Most recently used first.
+    std::list<Entry> m_Entries;
+
+    size_t m_NumHits;
+    size_t m_NumMisses;
+    size_t m_NumRejected;
+};
+
+} // namespace armnn
@@ -7,12 +7,16 @@
 #include <armnn/BackendId.hpp>
 
 #include "JsonPrinter.hpp"
+#include "LayerWorkInstrument.hpp"
+
+#include <InferenceSampler.hpp>
 
 #if ARMNN_STREAMLINE_ENABLED
 #include <streamline_annotate.h>
 #endif
 
 #include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <iostream>
 #include <fstream>
@@ -60,6 +64,19 @@ Measurement FindMeasurement(const std::string& name, const Event* event)
     return Measurement{ "", 0.f, Measurement::Unit::TIME_MS };
 }
 
+// Checks whether an event is part of an inference, i.e. whether it or one of its parents is an inference event.
+bool IsInInference(const Event* event)
+{
+    for (; event != nullptr; event = event->GetParentEvent())
+    {
+        if (event->GetName() == "EnqueueWorkload")
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 std::vector<Measurement> FindKernelMeasurements(const Event* event)
 {
     BOOST_ASSERT(event != nullptr);
@@ -80,28 +97,48 @@ std::vector<Measurement> FindKernelMeasurements(const Event* event)
     return measurements;
 }
 
+void Profiler::AddToProfilingEventStats(std::map<std::string, ProfilingEventStats>& nameToStatsMap,
+                                        const Event& event)
+{
+    Measurement measurement = FindMeasurement(WallClockTimer::WALL_CLOCK_TIME, &event);
+
+    double durationMs = measurement.m_Value;
+
+    // Only the events of layers carry the estimate of their work
+    const Measurement estimatedFlops = FindMeasurement(LayerWorkInstrument::ESTIMATED_FLOPS, &event);
+    const bool isEstimated = !estimatedFlops.m_Name.empty();
+    double flops = isEstimated ? estimatedFlops.m_Value : FindMeasurement(LayerWorkInstrument::FLOPS, &event).m_Value;
+    double bytes = FindMeasurement(LayerWorkInstrument::BYTES_READ, &event).m_Value +
+                   FindMeasurement(LayerWorkInstrument::BYTES_WRITTEN, &event).m_Value;
+
+    auto it = nameToStatsMap.find(event.GetName());
+    if (it != nameToStatsMap.end())
+    {
+        ProfilingEventStats& stats = it->second;
+        stats.m_TotalMs += durationMs;
+        stats.m_MinMs = std::min(stats.m_MinMs, durationMs);
+        stats.m_MaxMs = std::max(stats.m_MaxMs, durationMs);
+        ++stats.m_Count;
+        stats.m_TotalFlops += flops;
+        stats.m_TotalBytes += bytes;
+        stats.m_IsEstimated = stats.m_IsEstimated || isEstimated;
+    }
+    else
+    {
+        nameToStatsMap.emplace(event.GetName(),
+                               ProfilingEventStats{ durationMs, durationMs, durationMs, 1, flops, bytes, isEstimated,
+                                                    IsInInference(&event) });
+    }
+}
+
 std::map<std::string, Profiler::ProfilingEventStats> Profiler::CalculateProfilingEventStats() const
 {
-    std::map<std::string, ProfilingEventStats> nameToStatsMap;
+    // The recycled events are only kept as stats
+    std::map<std::string, ProfilingEventStats> nameToStatsMap = m_RecycledEventStats;
 
     for (const auto& event : m_EventSequence)
     {
-        Measurement measurement = FindMeasurement(WallClockTimer::WALL_CLOCK_TIME, event.get());
-
-        double durationMs = measurement.m_Value;
-        auto it = nameToStatsMap.find(event->GetName());
-        if (it != nameToStatsMap.end())
-        {
-            ProfilingEventStats& stats = it->second;
-            stats.m_TotalMs += durationMs;
-            stats.m_MinMs = std::min(stats.m_MinMs, durationMs);
-            stats.m_MaxMs = std::max(stats.m_MaxMs, durationMs);
-            ++stats.m_Count;
-        }
-        else
-        {
-            nameToStatsMap.emplace(event->GetName(), ProfilingEventStats{ durationMs, durationMs, durationMs, 1 });
-        }
+        AddToProfilingEventStats(nameToStatsMap, *event);
     }
 
     return nameToStatsMap;
@@ -147,23 +184,78 @@ void Profiler::AnalyzeEventSequenceAndWriteResults(ItertType first, ItertType la
     // Aggregates results per event name.
     std::map<std::string, ProfilingEventStats> nameToStatsMap = CalculateProfilingEventStats();
 
-    // Outputs aggregated stats.
+    // Outputs aggregated stats, with the totals of the events of inferences estimated for all the inferences run.
+    const double inferenceScale = GetInferenceScale();
     outStream << "Event Stats - Name | Avg (ms) | Min (ms) | Max (ms) | Total (ms) | Count" << std::endl;
     for (const auto& pair : nameToStatsMap)
     {
         const std::string& eventLabel = pair.first;
         const ProfilingEventStats& eventStats = pair.second;
         const double avgMs = eventStats.m_TotalMs / double(eventStats.m_Count);
+        const double scale = eventStats.m_InInference ? inferenceScale : 1.0;
+        const uint64_t count = static_cast<uint64_t>(std::llround(double(eventStats.m_Count) * scale));
 
         outStream << "\t" << std::setw(50) << eventLabel << " " << std::setw(9) << avgMs << " "
             << std::setw(9) << eventStats.m_MinMs << " " << std::setw(9) << eventStats.m_MaxMs << " "
-            << std::setw(9) << eventStats.m_TotalMs << " " << std::setw(9) << eventStats.m_Count << std::endl;
+            << std::setw(9) << eventStats.m_TotalMs * scale << " " << std::setw(9) << count << std::endl;
     }
     outStream << std::endl;
+
+    // Outputs the work of the events which estimate it, with the rates achieved over their total duration, to place
+    // them on a roofline plot: the arithmetic intensity is the abscissa and the achieved compute the ordinate.
+    const bool hasWork = std::any_of(nameToStatsMap.cbegin(), nameToStatsMap.cend(),
+        [](const std::pair<const std::string, ProfilingEventStats>& pair)
+        {
+            return pair.second.m_TotalFlops > 0.0 || pair.second.m_TotalBytes > 0.0;
+        });
+    if (hasWork)
+    {
+        std::streamsize oldPrecision = outStream.precision();
+        outStream.precision(3);
+        std::ios_base::fmtflags oldFlags = outStream.flags();
+        outStream.setf(std::ios::fixed);
+
+        outStream << "Event Work - Name | Avg (MFLOP) | Avg (MB) | Intensity (FLOP/B) | Compute (GFLOP/s) | "
+            "Bandwidth (GB/s)" << std::endl;
+        for (const auto& pair : nameToStatsMap)
+        {
+            const ProfilingEventStats& eventStats = pair.second;
+            if (eventStats.m_TotalFlops <= 0.0 && eventStats.m_TotalBytes <= 0.0)
+            {
+                continue;
+            }
+
+            const double count = double(eventStats.m_Count);
+            const double intensity = eventStats.m_TotalBytes > 0.0 ?
+                                     eventStats.m_TotalFlops / eventStats.m_TotalBytes : 0.0;
+            // The wall clock durations are in microseconds: converts operations per microsecond into billions of
+            // operations per second
+            const double gflopsPerS = eventStats.m_TotalMs > 0.0 ?
+                                      eventStats.m_TotalFlops / eventStats.m_TotalMs * 1e-3 : 0.0;
+            const double gbytesPerS = eventStats.m_TotalMs > 0.0 ?
+                                      eventStats.m_TotalBytes / eventStats.m_TotalMs * 1e-3 : 0.0;
+
+            outStream << "\t" << std::setw(50) << pair.first << " "
+                << std::setw(12) << eventStats.m_TotalFlops / count * 1e-6 << " "
+                << std::setw(12) << eventStats.m_TotalBytes / count * 1e-6 << " "
+                << std::setw(9) << intensity << " " << std::setw(9) << gflopsPerS << " "
+                << std::setw(9) << gbytesPerS << (eventStats.m_IsEstimated ? " (estimated)" : "") << std::endl;
+        }
+        outStream << std::endl;
+
+        outStream.flags(oldFlags);
+        outStream.precision(oldPrecision);
+    }
 }
 
 Profiler::Profiler()
     : m_ProfilingEnabled(false)
+    , m_MaxEventCount(0)
+    , m_RecycledEventCount(0)
+    , m_InferenceSampler(std::make_unique<profiling::InferenceSampler>())
+    , m_RecordingInference(true)
+    , m_InferenceCount(0)
+    , m_SampledInferenceCount(0)
 {
     m_EventSequence.reserve(g_ProfilingEventCountHint);
 
@@ -183,6 +275,8 @@ Profiler::~Profiler()
         }
     }
 
+    SetChromeTraceStream(nullptr);
+
     // Un-register this profiler from the current thread.
     ProfilerManager::GetInstance().RegisterProfiler(nullptr);
 }
@@ -197,21 +291,114 @@ void Profiler::EnableProfiling(bool enableProfiling)
     m_ProfilingEnabled = enableProfiling;
 }
 
+void Profiler::SetMaxEventCount(size_t maxEventCount)
+{
+    m_MaxEventCount = maxEventCount;
+}
+
+void Profiler::SetInferenceSampling(const InferenceSamplingOptions& sampling)
+{
+    m_InferenceSampler->SetOptions(sampling);
+}
+
+void Profiler::BeginInference()
+{
+    if (!m_ProfilingEnabled)
+    {
+        return;
+    }
+
+    ++m_InferenceCount;
+    m_RecordingInference = m_InferenceSampler->SampleNextInference();
+    if (m_RecordingInference)
+    {
+        ++m_SampledInferenceCount;
+    }
+}
+
+void Profiler::EndInference()
+{
+    m_RecordingInference = true;
+}
+
+double Profiler::GetInferenceScale() const
+{
+    return m_SampledInferenceCount == 0 ? 1.0 : double(m_InferenceCount) / double(m_SampledInferenceCount);
+}
+
+bool Profiler::RecycleOldestEvents()
+{
+    // Events are recycled a whole tree at a time, so that the parents of the events kept are kept too
+    BOOST_ASSERT(!m_EventSequence.empty());
+    BOOST_ASSERT(m_EventSequence.front()->GetParentEvent() == nullptr);
+
+    if (!m_Parents.empty())
+    {
+        const Event* root = m_Parents.top();
+        while (root->GetParentEvent() != nullptr)
+        {
+            root = root->GetParentEvent();
+        }
+        if (root == m_EventSequence.front().get())
+        {
+            // The oldest tree is still being recorded
+            return false;
+        }
+    }
+
+    auto treeEnd = std::find_if(m_EventSequence.begin() + 1, m_EventSequence.end(),
+                                [](const EventPtr& event) { return event->GetParentEvent() == nullptr; });
+    for (auto event = m_EventSequence.begin(); event != treeEnd; ++event)
+    {
+        AddToProfilingEventStats(m_RecycledEventStats, **event);
+        m_FreeEvents.push_back(std::move(*event));
+    }
+    m_RecycledEventCount += static_cast<std::size_t>(std::distance(m_EventSequence.begin(), treeEnd));
+    m_EventSequence.erase(m_EventSequence.begin(), treeEnd);
+    return true;
+}
+
 Event* Profiler::BeginEvent(const BackendId& backendId,
                             const std::string& label,
                             std::vector<InstrumentPtr>&& instruments)
 {
+    Event* event = AcquireEvent(backendId, label);
+    event->SetInstruments(std::move(instruments));
+    StartEvent(event);
+    return event;
+}
+
+Event* Profiler::AcquireEvent(const BackendId& backendId, const std::string& label)
+{
+    while (m_MaxEventCount != 0 && m_EventSequence.size() >= m_MaxEventCount && RecycleOldestEvents())
+    {
+    }
+
     Event* parent = m_Parents.empty() ? nullptr : m_Parents.top();
-    m_EventSequence.push_back(std::make_unique<Event>(label, this, parent, backendId, std::move(instruments)));
-    Event* event = m_EventSequence.back().get();
+    if (m_FreeEvents.empty())
+    {
+        m_EventSequence.push_back(std::make_unique<Event>(label, this, parent, backendId, Event::Instruments()));
+    }
+    else
+    {
+        // Reuses the storage of a recycled event
+        m_EventSequence.push_back(std::move(m_FreeEvents.back()));
+        m_FreeEvents.pop_back();
+        m_EventSequence.back()->Reset(label, parent, backendId);
+    }
+    return m_EventSequence.back().get();
+}
+
+void Profiler::StartEvent(Event* event)
+{
     event->Start();
 
 #if ARMNN_STREAMLINE_ENABLED
-    ANNOTATE_CHANNEL_COLOR(uint32_t(m_Parents.size()), GetEventColor(backendId), label.c_str());
+    ANNOTATE_CHANNEL_COLOR(uint32_t(m_Parents.size()), GetEventColor(event->GetBackendId()),
+                           event->GetName().c_str());
 #endif
 
     m_Parents.push(event);
-    return event;
 }
 
 void Profiler::EndEvent(Event* event)
@@ -229,6 +416,11 @@ void Profiler::EndEvent(Event* event)
 #if ARMNN_STREAMLINE_ENABLED
     ANNOTATE_CHANNEL_END(uint32_t(m_Parents.size()));
 #endif
+
+    if (m_ChromeTraceStream)
+    {
+        m_ChromeTraceStream->PrintEvent(*event);
+    }
 }
 
 int CalcLevel(const Event* eventPtr)
@@ -377,6 +569,29 @@ void Profiler::Print(std::ostream& outStream) const
     outStream.precision(oldPrecision);
 }
 
+void Profiler::PrintChromeTrace(std::ostream& outStream) const
+{
+    ChromeTracePrinter printer(outStream);
+    for (const auto& event : m_EventSequence)
+    {
+        printer.PrintEvent(*event);
+    }
+    printer.PrintFooter();
+}
+
+void Profiler::SetChromeTraceStream(std::ostream* outStream)
+{
+    if (m_ChromeTraceStream)
+    {
+        m_ChromeTraceStream->PrintFooter();
+        m_ChromeTraceStream.reset();
+    }
+    if (outStream != nullptr)
+    {
+        m_ChromeTraceStream = std::make_unique<ChromeTracePrinter>(*outStream);
+    }
+}
+
 void Profiler::AnalyzeEventsAndWriteResults(std::ostream& outStream) const
 {
     // Stack should be empty now.
@@ -393,6 +608,19 @@ void Profiler::AnalyzeEventsAndWriteResults(std::ostream& outStream) const
         return;
     }
 
+    if (m_SampledInferenceCount != m_InferenceCount)
+    {
+        outStream << "Profiled " << m_SampledInferenceCount << " of the " << m_InferenceCount << " inferences run: "
+            "the totals and counts of the event stats of inferences are scaled up to estimate them for all of them."
+            << std::endl << std::endl;
+    }
+
+    if (m_RecycledEventCount != 0)
+    {
+        outStream << "The " << m_RecycledEventCount << " oldest events were recycled: "
+            "they are only included in the event stats." << std::endl << std::endl;
+    }
+
     // Analyzes the full sequence of events.
     AnalyzeEventSequenceAndWriteResults(m_EventSequence.cbegin(),
                                         m_EventSequence.cend(),
@@ -421,7 +649,8 @@ void Profiler::AnalyzeEventsAndWriteResults(std::ostream& outStream) const
             {
                 sequence.push_back(eventPtr);
 
-                if (CalcLevel(eventPtr) > baseLevel+2) //We only care about levels as deep as workload executions.
+                // We only care about levels as deep as workload executions, which are nested in their layers.
+                if (CalcLevel(eventPtr) > baseLevel+3)
                 {
                     return;
                 }
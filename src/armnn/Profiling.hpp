@@ -4,6 +4,7 @@
 //
 #pragma once
 
+#include "ChromeTracePrinter.hpp"
 #include "ProfilingEvent.hpp"
 
 #include "armnn/IProfiler.hpp"
@@ -16,12 +17,18 @@
 #include <vector>
 #include <stack>
 #include <map>
+#include <memory>
 
 #include <boost/core/ignore_unused.hpp>
 
 namespace armnn
 {
 
+namespace profiling
+{
+class InferenceSampler;
+}
+
 // Simple single-threaded profiler.
 // Tracks events reported by BeginEvent()/EndEvent() and outputs detailed information and stats when
 // Profiler::AnalyzeEventsAndWriteResults() is called.
@@ -36,6 +43,20 @@ public:
     // No attempt will be made to copy the name string: it must be known at compile time.
     Event* BeginEvent(const BackendId& backendId, const std::string& name, std::vector<InstrumentPtr>&& instruments);
 
+    // Marks the beginning of a user-defined event measured by copies of the given instruments.
+    // A recycled event reuses its instruments when they are of the same types, so that recording it does not
+    // allocate once the profiler recycles its events.
+    template<typename... Instruments>
+    Event* BeginEventWithInstruments(const BackendId& backendId,
+                                     const std::string& name,
+                                     const Instruments&... instruments)
+    {
+        Event* event = AcquireEvent(backendId, name);
+        event->AssignInstruments(instruments...);
+        StartEvent(event);
+        return event;
+    }
+
     // Marks the end of a user-defined event.
     void EndEvent(Event* event);
 
@@ -45,6 +66,21 @@ public:
     // Checks if profiling is enabled.
     bool IsProfilingEnabled() override;
 
+    // Bounds the number of events kept, recycling the events of the oldest inferences beyond it.
+    void SetMaxEventCount(size_t maxEventCount) override;
+
+    // Profiles only a sample of the inferences, scaling up the stats of their events.
+    void SetInferenceSampling(const InferenceSamplingOptions& sampling) override;
+
+    // Marks the beginning of an inference, deciding whether its events are recorded.
+    void BeginInference();
+
+    // Marks the end of an inference, after which the events are recorded again.
+    void EndInference();
+
+    // Checks if the events are recorded: profiling is enabled, and the current inference, if any, is sampled.
+    bool IsRecordingEvents() const { return m_ProfilingEnabled && m_RecordingInference; }
+
     // Increments the event tag, allowing grouping of events in a user-defined manner (e.g. per inference).
     void UpdateEventTag();
 
@@ -55,6 +91,12 @@ public:
     // Print stats for events in JSON Format to the given output stream.
     void Print(std::ostream& outStream) const override;
 
+    // Print the events in the Chrome trace event format to the given output stream.
+    void PrintChromeTrace(std::ostream& outStream) const override;
+
+    // Streams each event to the given output stream in the Chrome trace event format as soon as it ends.
+    void SetChromeTraceStream(std::ostream* outStream) override;
+
     // Gets the color to render an event with, based on which device it denotes.
     uint32_t GetEventColor(const BackendId& backendId) const;
 
@@ -71,12 +113,35 @@ private:
         double m_MinMs;
         double m_MaxMs;
         uint32_t m_Count;
+        double m_TotalFlops;
+        double m_TotalBytes;
+        // Whether the operations of any of the events are only approximated
+        bool m_IsEstimated;
+        // Whether the events are part of inferences, whose totals are scaled when they are sampled
+        bool m_InInference;
     };
 
     template<typename EventIterType>
     void AnalyzeEventSequenceAndWriteResults(EventIterType first, EventIterType last, std::ostream& outStream) const;
 
+    static void AddToProfilingEventStats(std::map<std::string, ProfilingEventStats>& nameToStatsMap,
+                                         const Event& event);
+
     std::map<std::string, ProfilingEventStats> CalculateProfilingEventStats() const;
+
+    // Appends an event to the event sequence, reusing a recycled one if there is any.
+    Event* AcquireEvent(const BackendId& backendId, const std::string& name);
+
+    // Starts an event acquired with AcquireEvent(), which becomes the parent of the events beginning until it ends.
+    void StartEvent(Event* event);
+
+    // Adds the oldest event and its descendants to the recycled event stats, and moves them to the free events.
+    // Returns false if they can not be recycled yet, as they have not all ended.
+    bool RecycleOldestEvents();
+
+    // Gets the ratio of the inferences run to the inferences profiled.
+    double GetInferenceScale() const;
+
     void PopulateInferences(std::vector<const Event*>& outInferences, int& outBaseLevel) const;
     void PopulateDescendants(std::map<const Event*, std::vector<const Event*>>& outDescendantsMap) const;
 
@@ -84,6 +149,25 @@ private:
     std::vector<EventPtr> m_EventSequence;
     bool m_ProfilingEnabled;
 
+    // Maximum number of events in m_EventSequence, or 0 if unbounded
+    std::size_t m_MaxEventCount;
+    // Events recycled from m_EventSequence, to be reused for new events
+    std::vector<EventPtr> m_FreeEvents;
+    // Stats of the events recycled so far, and their number
+    std::map<std::string, ProfilingEventStats> m_RecycledEventStats;
+    std::size_t m_RecycledEventCount;
+
+    // Decides which inferences are profiled
+    std::unique_ptr<profiling::InferenceSampler> m_InferenceSampler;
+    // Whether the events of the current inference are recorded, true outside inferences
+    bool m_RecordingInference;
+    // Numbers of inferences run and profiled while profiling was enabled
+    std::size_t m_InferenceCount;
+    std::size_t m_SampledInferenceCount;
+
+    // Printer of the Chrome trace the events are streamed to, if any
+    std::unique_ptr<ChromeTracePrinter> m_ChromeTraceStream;
+
 private:
     // Friend functions for unit testing, see ProfilerTests.cpp.
     friend size_t GetProfilerEventSequenceSize(armnn::Profiler* profiler);
@@ -113,19 +197,14 @@ private:
 class ScopedProfilingEvent
 {
 public:
-    using InstrumentPtr = std::unique_ptr<Instrument>;
-
     template<typename... Args>
     ScopedProfilingEvent(const BackendId& backendId, const std::string& name, Args... args)
         : m_Event(nullptr)
         , m_Profiler(ProfilerManager::GetInstance().GetProfiler())
     {
-        if (m_Profiler && m_Profiler->IsProfilingEnabled())
+        if (m_Profiler && m_Profiler->IsRecordingEvents())
         {
-            std::vector<InstrumentPtr> instruments(0);
-            instruments.reserve(sizeof...(args)); //One allocation
-            ConstructNextInVector(instruments, args...);
-            m_Event = m_Profiler->BeginEvent(backendId, name, std::move(instruments));
+            m_Event = m_Profiler->BeginEventWithInstruments(backendId, name, args...);
         }
     }
 
@@ -138,20 +217,32 @@ public:
     }
 
 private:
+    Event* m_Event;       ///< Event to track
+    Profiler* m_Profiler; ///< Profiler used
+};
 
-    void ConstructNextInVector(std::vector<InstrumentPtr>& instruments)
+// Marks the span of an inference, whose events the profiler of the thread records only if it samples the inference.
+class ScopedProfilingInference
+{
+public:
+    ScopedProfilingInference()
+        : m_Profiler(ProfilerManager::GetInstance().GetProfiler())
     {
-        boost::ignore_unused(instruments);
+        if (m_Profiler)
+        {
+            m_Profiler->BeginInference();
+        }
     }
 
-    template<typename Arg, typename... Args>
-    void ConstructNextInVector(std::vector<InstrumentPtr>& instruments, Arg arg, Args... args)
+    ~ScopedProfilingInference()
     {
-        instruments.emplace_back(std::make_unique<Arg>(arg));
-        ConstructNextInVector(instruments, args...);
+        if (m_Profiler)
+        {
+            m_Profiler->EndInference();
+        }
     }
 
-    Event* m_Event;       ///< Event to track
+private:
     Profiler* m_Profiler; ///< Profiler used
 };
 
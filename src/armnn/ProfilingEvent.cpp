@@ -17,6 +17,7 @@ Event::Event(const std::string& eventName,
     , m_Profiler(profiler)
     , m_Parent(parent)
     , m_BackendId(backendId)
+    , m_ThreadId(std::this_thread::get_id())
     , m_Instruments(std::move(instruments))
 {
 }
@@ -26,6 +27,7 @@ Event::Event(Event&& other) noexcept
     , m_Profiler(other.m_Profiler)
     , m_Parent(other.m_Parent)
     , m_BackendId(other.m_BackendId)
+    , m_ThreadId(other.m_ThreadId)
     , m_Instruments(std::move(other.m_Instruments))
 
 {
@@ -35,6 +37,21 @@ Event::~Event() noexcept
 {
 }
 
+void Event::Reset(const std::string& eventName,
+                  Event* parent,
+                  const BackendId backendId)
+{
+    m_EventName.assign(eventName);
+    m_Parent = parent;
+    m_BackendId = backendId;
+    m_ThreadId = std::this_thread::get_id();
+}
+
+void Event::SetInstruments(Instruments&& instruments)
+{
+    m_Instruments = std::move(instruments);
+}
+
 void Event::Start()
 {
     for (auto& instrument : m_Instruments)
@@ -84,6 +101,16 @@ BackendId Event::GetBackendId() const
     return m_BackendId;
 }
 
+const Event::Instruments& Event::GetInstruments() const
+{
+    return m_Instruments;
+}
+
+std::thread::id Event::GetThreadId() const
+{
+    return m_ThreadId;
+}
+
 Event& Event::operator=(Event&& other) noexcept
 {
     if (this == &other)
@@ -95,6 +122,7 @@ Event& Event::operator=(Event&& other) noexcept
     m_Profiler = other.m_Profiler;
     m_Parent = other.m_Parent;
     m_BackendId = other.m_BackendId;
+    m_ThreadId = other.m_ThreadId;
     other.m_Profiler = nullptr;
     other.m_Parent = nullptr;
     return *this;
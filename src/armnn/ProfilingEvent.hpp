@@ -9,9 +9,12 @@
 #include <vector>
 #include <chrono>
 #include <memory>
+#include <thread>
 #include "Instrument.hpp"
 #include "armnn/Types.hpp"
 
+#include <boost/core/ignore_unused.hpp>
+
 namespace armnn
 {
 
@@ -46,6 +49,25 @@ public:
     /// Stop the Event
     void Stop();
 
+    /// Reinitialise the Event to record another one, reusing the storage of its name and keeping its instruments
+    /// to be reused by AssignInstruments()
+    void Reset(const std::string& eventName,
+               Event* parent,
+               const BackendId backendId);
+
+    /// Replace the instruments of the Event
+    void SetInstruments(Instruments&& instruments);
+
+    /// Replace the instruments of the Event by copies of the given ones. The instruments it already has are
+    /// assigned to when they are of the same types, so that an Event reused for the same kind of event
+    /// does not allocate.
+    template<typename... Args>
+    void AssignInstruments(const Args&... args)
+    {
+        m_Instruments.resize(sizeof...(args));
+        AssignInstrument(0, args...);
+    }
+
     /// Get the recorded measurements calculated between Start() and Stop()
     /// \return Recorded measurements of the event
     const std::vector<Measurement> GetMeasurements() const;
@@ -66,6 +88,14 @@ public:
     /// \return Backend id of the event
     BackendId GetBackendId() const;
 
+    /// Get the instruments of the event
+    /// \return Instruments of the event
+    const Instruments& GetInstruments() const;
+
+    /// Get the id of the thread the event was recorded on
+    /// \return Id of the thread the event was recorded on
+    std::thread::id GetThreadId() const;
+
     /// Assignment operator
     Event& operator=(const Event& other) = delete;
 
@@ -73,6 +103,27 @@ public:
     Event& operator=(Event&& other) noexcept;
 
 private:
+    void AssignInstrument(size_t index)
+    {
+        boost::ignore_unused(index);
+    }
+
+    template<typename Arg, typename... Args>
+    void AssignInstrument(size_t index, const Arg& arg, const Args&... args)
+    {
+        InstrumentPtr& instrument = m_Instruments[index];
+        Arg* sameTypeInstrument = dynamic_cast<Arg*>(instrument.get());
+        if (sameTypeInstrument != nullptr)
+        {
+            *sameTypeInstrument = arg;
+        }
+        else
+        {
+            instrument = std::make_unique<Arg>(arg);
+        }
+        AssignInstrument(index + 1, args...);
+    }
+
     /// Name of the event
     std::string m_EventName;
 
@@ -85,6 +136,9 @@ private:
     /// Backend id
     BackendId m_BackendId;
 
+    /// Thread the event was recorded on
+    std::thread::id m_ThreadId;
+
     /// Instruments to use
     Instruments m_Instruments;
 };
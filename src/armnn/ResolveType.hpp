@@ -6,6 +6,7 @@
 #pragma once
 
 #include "armnn/Types.hpp"
+#include "BFloat16.hpp"
 #include "Half.hpp"
 
 namespace armnn
@@ -20,6 +21,12 @@ struct ResolveTypeImpl<DataType::Float16>
     using Type = Half;
 };
 
+template <>
+struct ResolveTypeImpl<DataType::BFloat16>
+{
+    using Type = BFloat16;
+};
+
 template<>
 struct ResolveTypeImpl<DataType::Float32>
 {
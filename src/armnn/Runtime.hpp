@@ -4,6 +4,7 @@
 //
 #pragma once
 
+#include "ConstTensorStore.hpp"
 #include "LoadedNetwork.hpp"
 #include "DeviceSpec.hpp"
 
@@ -77,6 +78,9 @@ public:
 
     ~Runtime();
 
+    /// The constant tensors shared by the loaded networks.
+    const ConstTensorStore& GetConstTensorStore() const { return m_ConstTensorStore; }
+
 private:
     friend void RuntimeLoadedNetworksReserve(armnn::Runtime* runtime); // See RuntimeTests.cpp
 
@@ -105,6 +109,9 @@ private:
 
     int m_NetworkIdCounter;
 
+    /// Equal constant tensors of the loaded networks are stored once.
+    ConstTensorStore m_ConstTensorStore;
+
     DeviceSpec m_DeviceSpec;
 
     /// List of dynamic backends loaded in the runtime
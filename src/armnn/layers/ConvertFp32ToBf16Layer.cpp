@@ -0,0 +1,54 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "ConvertFp32ToBf16Layer.hpp"
+
+#include "LayerCloneBase.hpp"
+
+#include <armnn/TypesUtils.hpp>
+#include <backendsCommon/WorkloadData.hpp>
+#include <backendsCommon/WorkloadFactory.hpp>
+
+namespace armnn
+{
+
+ConvertFp32ToBf16Layer::ConvertFp32ToBf16Layer(const char* name)
+ : Layer(1, 1, LayerType::ConvertFp32ToBf16, name)
+{
+}
+
+std::unique_ptr<IWorkload> ConvertFp32ToBf16Layer::CreateWorkload(const IWorkloadFactory& factory) const
+{
+    ConvertFp32ToBf16QueueDescriptor descriptor;
+    return factory.CreateConvertFp32ToBf16(descriptor, PrepInfoAndDesc(descriptor));
+}
+
+ConvertFp32ToBf16Layer* ConvertFp32ToBf16Layer::Clone(Graph& graph) const
+{
+    return CloneBase<ConvertFp32ToBf16Layer>(graph, GetName());
+}
+
+void ConvertFp32ToBf16Layer::ValidateTensorShapesFromInputs()
+{
+    VerifyLayerConnections(1, CHECK_LOCATION());
+
+    auto inferredShapes = InferOutputShapes({ GetInputSlot(0).GetConnection()->GetTensorInfo().GetShape() });
+
+    BOOST_ASSERT(inferredShapes.size() == 1);
+
+    ConditionalThrowIfNotEqual<LayerValidationException>(
+        "ConvertFp32ToBf16Layer: TensorShape set on OutputSlot[0] does not match the inferred shape.",
+        GetOutputSlot(0).GetTensorInfo().GetShape(),
+        inferredShapes[0]);
+}
+
+void ConvertFp32ToBf16Layer::Accept(ILayerVisitor& visitor) const
+{
+    // These conversion layers are only inserted by the
+    // optimizer and so will never be in an input graph.
+    boost::ignore_unused(visitor);
+    throw armnn::Exception("ConvertFp32ToBf16Layer should never appear in an input graph");
+}
+
+} // namespace armnn
@@ -25,6 +25,12 @@ public:
         Layer::SerializeLayerParameters(fn);
     }
 
+    bool HasEqualParameters(const Layer& other) const override
+    {
+        return Layer::HasEqualParameters(other) &&
+               boost::polymorphic_downcast<const LayerWithParameters*>(&other)->m_Param == m_Param;
+    }
+
 protected:
     LayerWithParameters(unsigned int numInputSlots,
                         unsigned int numOutputSlots,
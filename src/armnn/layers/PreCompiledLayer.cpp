@@ -16,6 +16,7 @@ namespace armnn
 
 PreCompiledLayer::PreCompiledLayer(const PreCompiledDescriptor& param, const char* name)
     : LayerWithParameters(param.m_NumInputSlots, param.m_NumOutputSlots, LayerType::PreCompiled, param, name)
+    , m_OperationsPerElement(0)
 {}
 
 PreCompiledLayer::~PreCompiledLayer()
@@ -24,7 +25,16 @@ PreCompiledLayer::~PreCompiledLayer()
 PreCompiledLayer* PreCompiledLayer::Clone(Graph& graph) const
 {
     PreCompiledLayer* clone = CloneBase<PreCompiledLayer>(graph, m_Param, GetName());
-    clone->m_PreCompiledObject.reset(const_cast<PreCompiledLayer*>(this)->m_PreCompiledObject.release());
+    if (m_PreCompiledObjectCopier && m_PreCompiledObject)
+    {
+        clone->m_PreCompiledObject = m_PreCompiledObjectCopier(m_PreCompiledObject.get());
+    }
+    else
+    {
+        clone->m_PreCompiledObject.reset(const_cast<PreCompiledLayer*>(this)->m_PreCompiledObject.release());
+    }
+    clone->m_PreCompiledObjectCopier = m_PreCompiledObjectCopier;
+    clone->m_OperationsPerElement = m_OperationsPerElement;
     return clone;
 }
 
@@ -44,6 +54,18 @@ void PreCompiledLayer::ValidateTensorShapesFromInputs()
 void PreCompiledLayer::SetPreCompiledObject(PreCompiledObjectPtr preCompiledObject)
 {
     m_PreCompiledObject = std::move(preCompiledObject);
+    m_PreCompiledObjectCopier = nullptr;
+}
+
+void PreCompiledLayer::SetPreCompiledObject(PreCompiledObjectPtr preCompiledObject, PreCompiledObjectCopier copier)
+{
+    m_PreCompiledObject = std::move(preCompiledObject);
+    m_PreCompiledObjectCopier = std::move(copier);
+}
+
+void PreCompiledLayer::SetOperationsPerElement(unsigned int operationsPerElement)
+{
+    m_OperationsPerElement = operationsPerElement;
 }
 
 void PreCompiledLayer::Accept(ILayerVisitor& visitor) const
@@ -18,6 +18,7 @@ namespace armnn
 
 using PreCompiledObjectDeleter = std::function<void(const void*)>;
 using PreCompiledObjectPtr = std::unique_ptr<void, PreCompiledObjectDeleter>;
+using PreCompiledObjectCopier = std::function<PreCompiledObjectPtr(const void*)>;
 
 class PreCompiledLayer : public LayerWithParameters<PreCompiledDescriptor>
 {
@@ -33,6 +34,19 @@ public:
 
     void SetPreCompiledObject(PreCompiledObjectPtr preCompiledObject);
 
+    /// Sets the pre-compiled object together with the function copying it, so that the copies of the layer get
+    /// their own copy of the object instead of taking it over from the layer.
+    void SetPreCompiledObject(PreCompiledObjectPtr preCompiledObject, PreCompiledObjectCopier copier);
+
+    /// Returns true if the copies of the layer keep the pre-compiled object of the layer.
+    bool IsPreCompiledObjectCopyable() const { return static_cast<bool>(m_PreCompiledObjectCopier); }
+
+    /// Sets the arithmetic operations done per output element by the pre-compiled object, as only the backend
+    /// which compiled it knows its work. Zero, the default, leaves the work of the layer unknown.
+    void SetOperationsPerElement(unsigned int operationsPerElement);
+
+    unsigned int GetOperationsPerElement() const { return m_OperationsPerElement; }
+
     void Accept(ILayerVisitor& visitor) const override;
 
 private:
@@ -40,6 +54,8 @@ private:
     PreCompiledLayer& operator=(const PreCompiledLayer& other) = delete;
 
     PreCompiledObjectPtr m_PreCompiledObject;
+    PreCompiledObjectCopier m_PreCompiledObjectCopier;
+    unsigned int m_OperationsPerElement;
 };
 
 } // namespace armnn
@@ -5,13 +5,17 @@
 #pragma once
 
 #include "ConvertConstants.hpp"
+#include "DeduplicateConstants.hpp"
 #include "OptimizeInversePermutes.hpp"
 #include "PermuteAsReshape.hpp"
 #include "OptimizeConsecutiveReshapes.hpp"
 #include "SquashEqualSiblings.hpp"
 #include "MovePermuteUp.hpp"
 #include "OptimizeInverseConversions.hpp"
+#include "OptimizeInverseQuantizations.hpp"
+#include "ConvertFp32NetworkToBf16.hpp"
 #include "ConvertFp32NetworkToFp16.hpp"
 #include "AddDebug.hpp"
 #include "FoldPadIntoConvolution2d.hpp"
+#include "FoldScaleShiftIntoWeights.hpp"
 #include "PermuteAndBatchToSpaceAsDepthToSpace.hpp"
\ No newline at end of file
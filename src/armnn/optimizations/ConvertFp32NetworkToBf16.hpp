@@ -0,0 +1,43 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Optimization.hpp"
+#include "NetworkUtils.hpp"
+
+namespace armnn
+{
+namespace optimizations
+{
+
+class ConvertFp32NetworkToBf16Impl
+{
+public:
+    /// Runs the weight bound layers in BFloat16. Their Float32 inputs are converted to BFloat16 and their
+    /// outputs are converted back to Float32, every other layer is left in Float32.
+    void Run(Graph& graph, Layer& layer) const
+    {
+        if (layer.GetType() != LayerType::Convolution2d && layer.GetType() != LayerType::FullyConnected)
+        {
+            return;
+        }
+
+        if (layer.GetDataType() == DataType::Float32 &&
+            layer.GetOutputSlot(0).GetTensorInfo().GetDataType() == DataType::Float32)
+        {
+            InsertConvertFp32ToBf16LayersBefore(graph, layer);
+            InsertConvertBf16ToFp32LayersAfter(graph, layer);
+        }
+    }
+
+protected:
+    ConvertFp32NetworkToBf16Impl() = default;
+    ~ConvertFp32NetworkToBf16Impl() = default;
+};
+
+using Fp32NetworkToBf16Converter = OptimizeForType<Layer, ConvertFp32NetworkToBf16Impl>;
+
+} // namespace optimizations
+} // namespace armnn
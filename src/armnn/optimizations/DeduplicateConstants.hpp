@@ -0,0 +1,125 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Optimization.hpp"
+
+#include <armnnUtils/TensorUtils.hpp>
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <boost/core/ignore_unused.hpp>
+
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+class DeduplicateConstantsImpl
+{
+public:
+    /// Run for every layer. A Constant layer equal to one already visited is bypassed, so it is removed,
+    /// and the constant tensors of all the other layers share their memory with an equal tensor if there is one.
+    /// Each content is hashed once, so the cost of the pass is linear in the size of the constants.
+    void Run(Graph& graph, Layer& layer) const
+    {
+        boost::ignore_unused(graph);
+
+        if (layer.GetType() == LayerType::Constant)
+        {
+            ConstantLayer& constantLayer = *boost::polymorphic_downcast<ConstantLayer*>(&layer);
+            if (constantLayer.m_LayerOutput == nullptr || layer.IsOutputUnconnected())
+            {
+                return;
+            }
+
+            auto hash = GetHash(*constantLayer.m_LayerOutput);
+            auto range = m_ConstantLayers.equal_range(hash);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                ConstantLayer& other = *it->second;
+                if (&other == &constantLayer)
+                {
+                    return;
+                }
+                if (other.GetOutputSlot(0).GetTensorInfo() == layer.GetOutputSlot(0).GetTensorInfo() &&
+                    AreEqual(*other.m_LayerOutput, *constantLayer.m_LayerOutput))
+                {
+                    // Bypasses the layer. It will be removed as it's left unconnected.
+                    layer.GetOutputSlot(0).MoveAllConnections(other.GetOutputSlot(0));
+                    return;
+                }
+            }
+            m_ConstantLayers.emplace(hash, &constantLayer);
+        }
+        else
+        {
+            layer.OperateOnConstantTensors([this](std::unique_ptr<ScopedCpuTensorHandle>& handle)
+            {
+                ShareTensor(handle);
+            });
+        }
+    }
+
+protected:
+    DeduplicateConstantsImpl()  = default;
+    ~DeduplicateConstantsImpl() = default;
+
+private:
+    static size_t GetHash(const ScopedCpuTensorHandle& handle)
+    {
+        return armnnUtils::GetTensorContentHash(handle.GetTensorInfo(), handle.GetConstTensor<void>());
+    }
+
+    static bool AreEqual(const ScopedCpuTensorHandle& lhs, const ScopedCpuTensorHandle& rhs)
+    {
+        return lhs.GetTensorInfo() == rhs.GetTensorInfo() &&
+               (lhs.GetConstTensor<void>() == rhs.GetConstTensor<void>() ||
+                std::memcmp(lhs.GetConstTensor<void>(),
+                            rhs.GetConstTensor<void>(),
+                            lhs.GetTensorInfo().GetNumBytes()) == 0);
+    }
+
+    /// Replaces the handle with one referencing the memory of an equal tensor seen before, if any.
+    void ShareTensor(std::unique_ptr<ScopedCpuTensorHandle>& handle) const
+    {
+        auto hash = GetHash(*handle);
+        auto range = m_Tensors.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (AreEqual(it->second, *handle))
+            {
+                handle = std::make_unique<ScopedCpuTensorHandle>(it->second);
+                return;
+            }
+        }
+
+        if (handle->GetSharedStorage() == nullptr)
+        {
+            // Keeps the memory of the handle alive for the tensors sharing it
+            std::shared_ptr<ScopedCpuTensorHandle> storage(std::move(handle));
+            handle = std::make_unique<ScopedCpuTensorHandle>(
+                ConstTensor(storage->GetTensorInfo(), storage->GetConstTensor<void>()), storage);
+        }
+        m_Tensors.emplace(hash, *handle);
+    }
+
+    /// Constant layers kept in the graph so far, by hash of their content.
+    mutable std::unordered_multimap<size_t, ConstantLayer*> m_ConstantLayers;
+
+    /// Handles sharing the memory of the tensors of the layers seen so far, by hash of their content.
+    mutable std::unordered_multimap<size_t, ScopedCpuTensorHandle> m_Tensors;
+};
+
+/// The state of the optimization is only valid for a single pass, during which no other optimization must
+/// remove layers. It must be created for each call of Optimizer::Pass.
+using DeduplicateConstants = OptimizeForType<Layer, DeduplicateConstantsImpl>;
+
+} // namespace optimizations
+} // namespace armnn
@@ -0,0 +1,240 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "Optimization.hpp"
+
+#include <armnnUtils/DataLayoutIndexed.hpp>
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <string>
+#include <vector>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+/// Folds a multiplication or an addition by a per output channel constant into the weights and
+/// bias of the producing layer, i.e. (x * W + B) * S + T == x * (W * S) + (B * S + T).
+template <typename LayerT>
+class FoldScaleShiftIntoWeightsImpl
+{
+public:
+    void Run(Graph& graph, InputSlot& connection) const
+    {
+        Layer& base  = connection.GetConnectedOutputSlot()->GetOwningLayer();
+        Layer& child = connection.GetOwningLayer();
+
+        BOOST_ASSERT(base.GetType() == LayerEnumOf<LayerT>());
+        BOOST_ASSERT(child.GetType() == LayerType::Multiplication || child.GetType() == LayerType::Addition);
+
+        LayerT& producer = *boost::polymorphic_downcast<LayerT*>(&base);
+
+        // The producer must not be used by any other layer, as its result is changed by the folding
+        if (base.GetOutputSlot(0).GetNumConnections() != 1 ||
+            producer.m_Weight == nullptr ||
+            producer.m_Weight->GetTensorInfo().GetDataType() != DataType::Float32)
+        {
+            return;
+        }
+
+        const TensorInfo& outputInfo = base.GetOutputSlot(0).GetTensorInfo();
+        const unsigned int axis = GetOutputChannelAxis(producer);
+        if (outputInfo.GetDataType() != DataType::Float32 || axis >= outputInfo.GetNumDimensions())
+        {
+            return;
+        }
+
+        const unsigned int operandSlot = connection.GetSlotIndex() == 0 ? 1 : 0;
+        Layer& operand = child.GetInputSlot(operandSlot).GetConnectedOutputSlot()->GetOwningLayer();
+
+        const std::vector<float> values = GetPerChannelConstantValues(operand, outputInfo, axis);
+        if (values.empty())
+        {
+            return;
+        }
+
+        const unsigned int numChannels = outputInfo.GetShape()[axis];
+        auto descriptor = producer.GetParameters();
+
+        std::unique_ptr<ScopedCpuTensorHandle> weight = CopyTensorData(*producer.m_Weight);
+        std::unique_ptr<ScopedCpuTensorHandle> bias;
+        if (descriptor.m_BiasEnabled)
+        {
+            BOOST_ASSERT_MSG(producer.m_Bias != nullptr,
+                             "FoldScaleShiftIntoWeights: Bias data should not be null if bias is enabled.");
+            if (producer.m_Bias->GetTensorInfo().GetDataType() != DataType::Float32)
+            {
+                return;
+            }
+            bias = CopyTensorData(*producer.m_Bias);
+        }
+
+        if (child.GetType() == LayerType::Multiplication)
+        {
+            float* weightData = weight->template GetTensor<float>();
+            const unsigned int numWeights = weight->GetTensorInfo().GetNumElements();
+            for (unsigned int i = 0; i < numWeights; ++i)
+            {
+                weightData[i] *= values[GetWeightOutputChannel(producer, i, numChannels)];
+            }
+
+            if (bias)
+            {
+                float* biasData = bias->template GetTensor<float>();
+                for (unsigned int c = 0; c < numChannels; ++c)
+                {
+                    biasData[c] *= values[c];
+                }
+            }
+        }
+        else
+        {
+            if (!bias)
+            {
+                descriptor.m_BiasEnabled = true;
+                const std::vector<float> zeroBias(numChannels, 0.f);
+                bias = std::make_unique<ScopedCpuTensorHandle>(
+                    ConstTensor(TensorInfo({ numChannels }, DataType::Float32), zeroBias));
+            }
+
+            float* biasData = bias->template GetTensor<float>();
+            for (unsigned int c = 0; c < numChannels; ++c)
+            {
+                biasData[c] += values[c];
+            }
+        }
+
+        OutputSlot* parentOut = base.GetInputSlot(0).GetConnectedOutputSlot();
+
+        const std::string name = std::string("folded-") + child.GetName() + std::string("-into-") + base.GetName();
+        auto& newLayer = *graph.InsertNewLayer<LayerT>(base.GetInputSlot(0), descriptor, name.c_str());
+        newLayer.GetOutputHandler().SetTensorInfo(child.GetOutputSlot(0).GetTensorInfo());
+        newLayer.m_Weight = std::move(weight);
+        newLayer.m_Bias   = std::move(bias);
+
+        // Reconnects the original producer with its parent, leaving the new layer unconnected at its output.
+        newLayer.GetOutputSlot().MoveAllConnections(*parentOut);
+
+        // Moves connections in child output to the new layer.
+        // Child layer will be removed as it's left unconnected.
+        // Base layer will be removed if left unconnected.
+        child.GetOutputSlot().MoveAllConnections(newLayer.GetOutputSlot());
+
+        // The constant operand may not be visited again by the optimizer, so it is removed here once unused.
+        if (operand.GetOutputSlot(0).GetNumConnections() == 1)
+        {
+            operand.GetOutputSlot(0).Disconnect(child.GetInputSlot(operandSlot));
+            Layer* operandLayer = &operand;
+            graph.EraseLayer(operandLayer);
+        }
+    }
+
+protected:
+    FoldScaleShiftIntoWeightsImpl()  = default;
+    ~FoldScaleShiftIntoWeightsImpl() = default;
+
+private:
+    /// Copies the contents of a constant tensor so they can be modified. Copying the handle itself would
+    /// share memory that is referenced rather than owned by the layer.
+    static std::unique_ptr<ScopedCpuTensorHandle> CopyTensorData(const ScopedCpuTensorHandle& handle)
+    {
+        return std::make_unique<ScopedCpuTensorHandle>(
+            ConstTensor(handle.GetTensorInfo(), handle.GetConstTensor<void>()));
+    }
+
+    static unsigned int GetOutputChannelAxis(const Convolution2dLayer& layer)
+    {
+        return armnnUtils::DataLayoutIndexed(layer.GetParameters().m_DataLayout).GetChannelsIndex();
+    }
+
+    static unsigned int GetOutputChannelAxis(const FullyConnectedLayer&)
+    {
+        return 1;
+    }
+
+    /// Returns the output channel that the given weight element contributes to.
+    static unsigned int GetWeightOutputChannel(const Convolution2dLayer& layer,
+                                               unsigned int index,
+                                               unsigned int numChannels)
+    {
+        // Weights are [O, I, H, W] for NCHW and [O, H, W, I] for NHWC
+        return index / (layer.m_Weight->GetTensorInfo().GetNumElements() / numChannels);
+    }
+
+    static unsigned int GetWeightOutputChannel(const FullyConnectedLayer& layer,
+                                               unsigned int index,
+                                               unsigned int numChannels)
+    {
+        // Weights are [I, O], or [O, I] when the weight matrix is transposed
+        return layer.GetParameters().m_TransposeWeightMatrix ?
+               index / (layer.m_Weight->GetTensorInfo().GetNumElements() / numChannels) :
+               index % numChannels;
+    }
+
+    /// Returns the per output channel values of a constant operand, or an empty vector if the operand
+    /// is not a constant of the same rank as the output varying along the output channels only.
+    static std::vector<float> GetPerChannelConstantValues(const Layer& operand,
+                                                          const TensorInfo& outputInfo,
+                                                          unsigned int axis)
+    {
+        if (operand.GetType() != LayerType::Constant)
+        {
+            return {};
+        }
+
+        const ConstantLayer& constantLayer = *boost::polymorphic_downcast<const ConstantLayer*>(&operand);
+        if (constantLayer.m_LayerOutput == nullptr)
+        {
+            return {};
+        }
+
+        const TensorInfo& constantInfo = constantLayer.m_LayerOutput->GetTensorInfo();
+        if (constantInfo.GetDataType() != DataType::Float32 ||
+            constantInfo.GetNumDimensions() != outputInfo.GetNumDimensions())
+        {
+            return {};
+        }
+
+        const unsigned int numChannels = outputInfo.GetShape()[axis];
+        for (unsigned int i = 0; i < constantInfo.GetNumDimensions(); ++i)
+        {
+            const unsigned int dimension = constantInfo.GetShape()[i];
+            if (dimension != 1 && (i != axis || dimension != numChannels))
+            {
+                return {};
+            }
+        }
+
+        const float* constantData = constantLayer.m_LayerOutput->GetConstTensor<float>();
+        const bool perChannel = constantInfo.GetShape()[axis] != 1;
+
+        std::vector<float> values(numChannels);
+        for (unsigned int c = 0; c < numChannels; ++c)
+        {
+            values[c] = constantData[perChannel ? c : 0];
+        }
+        return values;
+    }
+};
+
+using FoldMultiplicationIntoConvolution2d = OptimizeForConnection<Convolution2dLayer,
+                                                                  MultiplicationLayer,
+                                                                  FoldScaleShiftIntoWeightsImpl<Convolution2dLayer>>;
+using FoldAdditionIntoConvolution2d = OptimizeForConnection<Convolution2dLayer,
+                                                            AdditionLayer,
+                                                            FoldScaleShiftIntoWeightsImpl<Convolution2dLayer>>;
+using FoldMultiplicationIntoFullyConnected = OptimizeForConnection<FullyConnectedLayer,
+                                                                   MultiplicationLayer,
+                                                                   FoldScaleShiftIntoWeightsImpl<FullyConnectedLayer>>;
+using FoldAdditionIntoFullyConnected = OptimizeForConnection<FullyConnectedLayer,
+                                                             AdditionLayer,
+                                                             FoldScaleShiftIntoWeightsImpl<FullyConnectedLayer>>;
+
+} // namespace optimizations
+} // namespace armnn
@@ -17,7 +17,7 @@ class OptimizeInverseConversionsImpl
 {
 public:
     /// Run for every connection between two inverse data type conversion layers, i.e.
-    /// Fp16ToFp32 followed by Fp32ToFp16 or vice-versa.
+    /// Fp16ToFp32 followed by Fp32ToFp16 or vice-versa, and Bf16ToFp32 followed by Fp32ToBf16.
     void Run(Graph& graph, InputSlot& connection) const
     {
         boost::ignore_unused(graph);
@@ -27,7 +27,9 @@ public:
         BOOST_ASSERT((base.GetType() == LayerType::ConvertFp16ToFp32 &&
                      child.GetType() == LayerType::ConvertFp32ToFp16) ||
                      (base.GetType() == LayerType::ConvertFp32ToFp16 &&
-                     child.GetType() == LayerType::ConvertFp16ToFp32));
+                     child.GetType() == LayerType::ConvertFp16ToFp32) ||
+                     (base.GetType() == LayerType::ConvertBf16ToFp32 &&
+                     child.GetType() == LayerType::ConvertFp32ToBf16));
 
         // Bypass both conversion layers
         child.GetOutputSlot().MoveAllConnections(*base.GetInputSlot(0).GetConnectedOutputSlot());
@@ -42,6 +44,9 @@ using OptimizeInverseConversionsFp16 =
     OptimizeForConnection<ConvertFp16ToFp32Layer, ConvertFp32ToFp16Layer, OptimizeInverseConversionsImpl>;
 using OptimizeInverseConversionsFp32 =
     OptimizeForConnection<ConvertFp32ToFp16Layer, ConvertFp16ToFp32Layer, OptimizeInverseConversionsImpl>;
+// Widening BFloat16 to Float32 is exact so only this order of the conversions can be removed
+using OptimizeInverseConversionsBf16 =
+    OptimizeForConnection<ConvertBf16ToFp32Layer, ConvertFp32ToBf16Layer, OptimizeInverseConversionsImpl>;
 
 } // namespace optimizations
 } // namespace armnn
@@ -0,0 +1,156 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Optimization.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+/// Replaces the connection between two layers with a single Quantize layer taking the input of the
+/// first one and producing the output of the second one.
+inline void ReplaceWithRequantize(Graph& graph, Layer& base, Layer& child)
+{
+    OutputSlot* parentOut = base.GetInputSlot(0).GetConnectedOutputSlot();
+
+    const std::string name = std::string("requantize-") + base.GetName() + std::string("-") + child.GetName();
+    auto& requantizeLayer = *graph.InsertNewLayer<QuantizeLayer>(base.GetInputSlot(0), name.c_str());
+    requantizeLayer.GetOutputHandler().SetTensorInfo(child.GetOutputSlot(0).GetTensorInfo());
+
+    // Reconnects the base layer with its parent, leaving the new layer unconnected at its output.
+    requantizeLayer.GetOutputSlot().MoveAllConnections(*parentOut);
+
+    // Moves connections in child output to the new layer.
+    // Child layer will be removed as it's left unconnected.
+    // Base layer will be removed if left unconnected.
+    child.GetOutputSlot().MoveAllConnections(requantizeLayer.GetOutputSlot());
+}
+
+/// Gets the range of the quantized values of a data type, returns false if it is not a quantized type.
+inline bool GetQuantizedRange(DataType dataType, int64_t& min, int64_t& max)
+{
+    switch (dataType)
+    {
+        case DataType::QAsymmU8:
+            min = std::numeric_limits<uint8_t>::min();
+            max = std::numeric_limits<uint8_t>::max();
+            return true;
+        case DataType::QAsymmS8:
+        case DataType::QSymmS8:
+            min = std::numeric_limits<int8_t>::min();
+            max = std::numeric_limits<int8_t>::max();
+            return true;
+        case DataType::QSymmS16:
+            min = std::numeric_limits<int16_t>::min();
+            max = std::numeric_limits<int16_t>::max();
+            return true;
+        default:
+            return false;
+    }
+}
+
+/// Returns whether every value of the first quantized tensor is represented exactly by the second one, so that
+/// requantizing to the second tensor neither rounds nor clamps. This is the case when the scale of the first
+/// tensor is a whole multiple of the scale of the second one and its range maps inside the range of the second one.
+inline bool IsLosslessRequantization(const TensorInfo& from, const TensorInfo& to)
+{
+    int64_t fromMin = 0;
+    int64_t fromMax = 0;
+    int64_t toMin = 0;
+    int64_t toMax = 0;
+    if (from.HasPerAxisQuantization() || to.HasPerAxisQuantization() ||
+        !GetQuantizedRange(from.GetDataType(), fromMin, fromMax) ||
+        !GetQuantizedRange(to.GetDataType(), toMin, toMax))
+    {
+        return false;
+    }
+
+    const double ratio = static_cast<double>(from.GetQuantizationScale()) /
+                         static_cast<double>(to.GetQuantizationScale());
+    const double wholeRatio = std::round(ratio);
+    if (wholeRatio < 1.0 || std::abs(ratio - wholeRatio) > 1e-6 * wholeRatio)
+    {
+        return false;
+    }
+
+    // A quantized value q of the first tensor is the value (q - fromOffset) * ratio + toOffset of the second one
+    const int64_t multiplier = static_cast<int64_t>(wholeRatio);
+    const int64_t fromOffset = from.GetQuantizationOffset();
+    const int64_t toOffset   = to.GetQuantizationOffset();
+    return (fromMin - fromOffset) * multiplier + toOffset >= toMin &&
+           (fromMax - fromOffset) * multiplier + toOffset <= toMax;
+}
+
+class OptimizeInverseQuantizationsImpl
+{
+public:
+    /// Run for every connection between a Dequantize layer and a Quantize layer.
+    /// The pair is removed if the Quantize layer restores the original quantized tensor,
+    /// otherwise it is replaced by a single requantization from one quantized type to the other.
+    void Run(Graph& graph, InputSlot& connection) const
+    {
+        Layer& base  = connection.GetConnectedOutputSlot()->GetOwningLayer();
+        Layer& child = connection.GetOwningLayer();
+
+        BOOST_ASSERT(base.GetType() == LayerType::Dequantize);
+        BOOST_ASSERT(child.GetType() == LayerType::Quantize);
+
+        OutputSlot* parentOut = base.GetInputSlot(0).GetConnectedOutputSlot();
+        if (parentOut->GetTensorInfo() == child.GetOutputSlot(0).GetTensorInfo())
+        {
+            // Bypass both quantization layers
+            child.GetOutputSlot().MoveAllConnections(*parentOut);
+        }
+        else
+        {
+            ReplaceWithRequantize(graph, base, child);
+        }
+    }
+
+protected:
+    OptimizeInverseQuantizationsImpl()  = default;
+    ~OptimizeInverseQuantizationsImpl() = default;
+};
+
+class FuseConsecutiveQuantizationsImpl
+{
+public:
+    /// Run for every connection between two Quantize layers, merging them into a single requantization.
+    /// Only requantizations which lose nothing at the intermediate type are merged: the rounding of a float tensor,
+    /// or the rounding and clamping of a quantized tensor, to the intermediate type is kept.
+    void Run(Graph& graph, InputSlot& connection) const
+    {
+        Layer& base  = connection.GetConnectedOutputSlot()->GetOwningLayer();
+        Layer& child = connection.GetOwningLayer();
+
+        BOOST_ASSERT(base.GetType() == LayerType::Quantize);
+        BOOST_ASSERT(child.GetType() == LayerType::Quantize);
+
+        const OutputSlot* parentOut = base.GetInputSlot(0).GetConnectedOutputSlot();
+        if (IsLosslessRequantization(parentOut->GetTensorInfo(), base.GetOutputSlot(0).GetTensorInfo()))
+        {
+            ReplaceWithRequantize(graph, base, child);
+        }
+    }
+
+protected:
+    FuseConsecutiveQuantizationsImpl()  = default;
+    ~FuseConsecutiveQuantizationsImpl() = default;
+};
+
+using OptimizeInverseQuantizations =
+    OptimizeForConnection<DequantizeLayer, QuantizeLayer, OptimizeInverseQuantizationsImpl>;
+using FuseConsecutiveQuantizations =
+    OptimizeForConnection<QuantizeLayer, QuantizeLayer, FuseConsecutiveQuantizationsImpl>;
+
+} // namespace optimizations
+} // namespace armnn
@@ -0,0 +1,170 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <BackendCostModel.hpp>
+#include <Graph.hpp>
+#include <LayerWorkEstimate.hpp>
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+using namespace armnn;
+
+namespace
+{
+
+Convolution2dLayer* AddConvolution2dNetwork(Graph& graph)
+{
+    const TensorInfo inputInfo({ 1, 3, 8, 8 }, DataType::Float32);
+    const TensorInfo outputInfo({ 1, 4, 6, 6 }, DataType::Float32);
+
+    Convolution2dDescriptor descriptor;
+    descriptor.m_DataLayout = DataLayout::NCHW;
+
+    const std::vector<float> weightsData(4 * 3 * 3 * 3, 1.f);
+    ConstTensor weights(TensorInfo({ 4, 3, 3, 3 }, DataType::Float32), weightsData);
+
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(inputInfo);
+
+    Convolution2dLayer* conv2d = graph.AddLayer<Convolution2dLayer>(descriptor, "conv2d");
+    conv2d->m_Weight = std::make_unique<ScopedCpuTensorHandle>(weights);
+    conv2d->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    Layer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot().Connect(conv2d->GetInputSlot(0));
+    conv2d->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    return conv2d;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(BackendCostModel)
+
+BOOST_AUTO_TEST_CASE(EstimateConvolution2dWork)
+{
+    Graph graph;
+    const Convolution2dLayer* conv2d = AddConvolution2dNetwork(graph);
+
+    const LayerWorkEstimate estimate = EstimateLayerWork(*conv2d);
+
+    // 144 output elements, each accumulating 3 * 3 * 3 products
+    BOOST_TEST(estimate.m_Flops == 2 * 144 * 27);
+    BOOST_TEST(estimate.m_BytesRead == (192 + 108) * sizeof(float));
+    BOOST_TEST(estimate.m_BytesWritten == 144 * sizeof(float));
+}
+
+BOOST_AUTO_TEST_CASE(EstimateLstmWork)
+{
+    Graph graph;
+    const TensorInfo inputInfo({ 2, 5 }, DataType::Float32);
+
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(inputInfo);
+
+    // Four cells with the coupled input and forget gates
+    LstmLayer* lstm = graph.AddLayer<LstmLayer>(LstmDescriptor(), "lstm");
+    auto makeTensor = [](const TensorShape& shape)
+    {
+        const TensorInfo info(shape, DataType::Float32);
+        return std::make_unique<ScopedCpuTensorHandle>(
+            ConstTensor(info, std::vector<float>(info.GetNumElements(), 1.f)));
+    };
+    lstm->m_BasicParameters.m_InputToForgetWeights     = makeTensor({ 4, 5 });
+    lstm->m_BasicParameters.m_InputToCellWeights       = makeTensor({ 4, 5 });
+    lstm->m_BasicParameters.m_InputToOutputWeights     = makeTensor({ 4, 5 });
+    lstm->m_BasicParameters.m_RecurrentToForgetWeights = makeTensor({ 4, 4 });
+    lstm->m_BasicParameters.m_RecurrentToCellWeights   = makeTensor({ 4, 4 });
+    lstm->m_BasicParameters.m_RecurrentToOutputWeights = makeTensor({ 4, 4 });
+    lstm->m_BasicParameters.m_ForgetGateBias           = makeTensor({ 4 });
+    lstm->m_BasicParameters.m_CellBias                 = makeTensor({ 4 });
+    lstm->m_BasicParameters.m_OutputGateBias           = makeTensor({ 4 });
+
+    input->GetOutputSlot().Connect(lstm->GetInputSlot(0));
+
+    const LayerWorkEstimate estimate = EstimateLayerWork(*lstm);
+
+    // The gate products of the 108 weights for both batch entries, then 11 operations per cell
+    BOOST_TEST(estimate.m_Flops == 2 * 2 * 108 + 2 * 4 * 11);
+    BOOST_TEST(estimate.m_BytesRead == (10 + 108 + 12) * sizeof(float));
+    BOOST_TEST(!estimate.m_IsEstimated);
+}
+
+BOOST_AUTO_TEST_CASE(EstimateElementwiseWork)
+{
+    Graph graph;
+    const TensorInfo info({ 1, 100 }, DataType::Float32);
+
+    Layer* input0 = graph.AddLayer<InputLayer>(0, "input0");
+    Layer* input1 = graph.AddLayer<InputLayer>(1, "input1");
+    input0->GetOutputSlot().SetTensorInfo(info);
+    input1->GetOutputSlot().SetTensorInfo(info);
+
+    Layer* softmax = graph.AddLayer<SoftmaxLayer>(SoftmaxDescriptor(), "softmax");
+    softmax->GetOutputSlot().SetTensorInfo(info);
+    input0->GetOutputSlot().Connect(softmax->GetInputSlot(0));
+
+    Layer* addition = graph.AddLayer<AdditionLayer>("addition");
+    addition->GetOutputSlot().SetTensorInfo(info);
+    input0->GetOutputSlot().Connect(addition->GetInputSlot(0));
+    input1->GetOutputSlot().Connect(addition->GetInputSlot(1));
+
+    PreCompiledLayer* preCompiled = graph.AddLayer<PreCompiledLayer>(PreCompiledDescriptor(2, 1), "fused");
+    preCompiled->GetOutputSlot().SetTensorInfo(info);
+    input0->GetOutputSlot().Connect(preCompiled->GetInputSlot(0));
+    input1->GetOutputSlot().Connect(preCompiled->GetInputSlot(1));
+
+    BOOST_TEST(EstimateLayerWork(*softmax).m_Flops == 5 * 100);
+    BOOST_TEST(!EstimateLayerWork(*softmax).m_IsEstimated);
+
+    // The layers which are not modelled are approximated with one operation per output element
+    BOOST_TEST(EstimateLayerWork(*addition).m_Flops == 100);
+    BOOST_TEST(EstimateLayerWork(*addition).m_IsEstimated);
+
+    // A pre-compiled layer is only modelled once its backend has told the operations of its object
+    BOOST_TEST(EstimateLayerWork(*preCompiled).m_Flops == 100);
+    BOOST_TEST(EstimateLayerWork(*preCompiled).m_IsEstimated);
+
+    preCompiled->SetOperationsPerElement(3);
+    BOOST_TEST(EstimateLayerWork(*preCompiled).m_Flops == 3 * 100);
+    BOOST_TEST(!EstimateLayerWork(*preCompiled).m_IsEstimated);
+}
+
+BOOST_AUTO_TEST_CASE(MeasuredLayerCostOverridesEstimate)
+{
+    Graph graph;
+    const Convolution2dLayer* conv2d = AddConvolution2dNetwork(graph);
+
+    armnn::BackendCostModel costModel;
+    const double cpuRefEstimate = costModel.GetLayerCost(*conv2d, Compute::CpuRef);
+    const double cpuAccEstimate = costModel.GetLayerCost(*conv2d, Compute::CpuAcc);
+    BOOST_TEST(cpuRefEstimate > cpuAccEstimate);
+
+    costModel.SetMeasuredLayerCost("conv2d", Compute::CpuRef, 42.0);
+    BOOST_TEST(costModel.GetLayerCost(*conv2d, Compute::CpuRef) == 42.0);
+    BOOST_TEST(costModel.GetLayerCost(*conv2d, Compute::CpuAcc) == cpuAccEstimate);
+}
+
+BOOST_AUTO_TEST_CASE(CopyCostOnlyBetweenDifferentBackends)
+{
+    Graph graph;
+    const Convolution2dLayer* conv2d = AddConvolution2dNetwork(graph);
+
+    armnn::BackendCostModel costModel;
+    costModel.SetCopyCost(1.0, 10.0);
+
+    BOOST_TEST(costModel.GetCopyCost(conv2d->GetOutputSlot(0), Compute::CpuAcc, Compute::CpuAcc) == 0.0);
+
+    // 576 bytes at 1 GB/s plus the fixed overhead
+    BOOST_TEST(costModel.GetCopyCost(conv2d->GetOutputSlot(0), Compute::CpuAcc, Compute::GpuAcc) == 10.576,
+               boost::test_tools::tolerance(0.000001));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
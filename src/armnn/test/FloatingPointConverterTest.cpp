@@ -5,6 +5,7 @@
 
 #include <armnnUtils/FloatingPointConverter.hpp>
 
+#include <BFloat16.hpp>
 #include <Half.hpp>
 
 #include <boost/test/unit_test.hpp>
@@ -52,4 +53,39 @@ BOOST_AUTO_TEST_CASE(TestConvertFp16ToFp32)
     }
 }
 
+BOOST_AUTO_TEST_CASE(TestConvertFp32ToBf16)
+{
+    float floatArray[] = { 1.0f, -2.0f, 0.5f, 3.1f, 1.00390625f, 1.01171875f, 65536.0f, 3.4e38f };
+    size_t numFloats = sizeof(floatArray) / sizeof(floatArray[0]);
+    std::vector<armnn::BFloat16> convertedBuffer(numFloats);
+
+    armnnUtils::FloatingPointConverter::ConvertFloat32ToBFloat16(floatArray, numFloats, convertedBuffer.data());
+
+    // 1.00390625 and 1.01171875 lie half way between two BFloat16 values and round to the even one
+    std::vector<uint16_t> expected = { 0x3F80, 0xC000, 0x3F00, 0x4046, 0x3F80, 0x3F82, 0x4780, 0x7F80 };
+    for (size_t i = 0; i < numFloats; i++)
+    {
+        BOOST_CHECK_EQUAL(expected[i], convertedBuffer[i].Val());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestConvertBf16ToFp32)
+{
+    std::vector<armnn::BFloat16> bf16Array = { armnn::BFloat16(static_cast<uint16_t>(0x3F80)),
+                                               armnn::BFloat16(static_cast<uint16_t>(0xC000)),
+                                               armnn::BFloat16(static_cast<uint16_t>(0x4046)),
+                                               armnn::BFloat16(static_cast<uint16_t>(0x7F7F)) };
+    std::vector<float> convertedBuffer(bf16Array.size(), 0.0f);
+
+    armnnUtils::FloatingPointConverter::ConvertBFloat16ToFloat32(bf16Array.data(),
+                                                                 bf16Array.size(),
+                                                                 convertedBuffer.data());
+
+    std::vector<float> expected = { 1.0f, -2.0f, 3.09375f, 3.38953139e38f };
+    for (size_t i = 0; i < bf16Array.size(); i++)
+    {
+        BOOST_CHECK_EQUAL(expected[i], convertedBuffer[i]);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -7,8 +7,12 @@
 
 #include <armnn/LayerVisitorBase.hpp>
 
+#include <Graph.hpp>
 #include <Network.hpp>
 
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <boost/polymorphic_cast.hpp>
 #include <boost/test/unit_test.hpp>
 
 namespace
@@ -539,4 +543,46 @@ BOOST_AUTO_TEST_CASE(StandInLayerSingleInputMultipleOutputsNetworkTest)
     BOOST_TEST(standIn->GetOutputSlot(1).GetConnection(0) == &output1->GetInputSlot(0));
 }
 
+BOOST_AUTO_TEST_CASE(NetworkConstTensorStorage)
+{
+    auto storage = std::make_shared<const std::vector<float>>(std::vector<float>{ 1.f, 2.f, 3.f, 4.f });
+    auto secondStorage = std::make_shared<const std::vector<float>>(std::vector<float>{ 7.f, 8.f });
+    const std::vector<float> otherData{ 5.f, 6.f };
+
+    armnn::Network net;
+    net.AddConstTensorStorage(storage, storage->data(), storage->size() * sizeof(float));
+    net.AddConstTensorStorage(secondStorage, secondStorage->data(), secondStorage->size() * sizeof(float));
+
+    const armnn::TensorInfo info({ 2 }, armnn::DataType::Float32);
+    auto referenced = net.AddConstantLayer(armnn::ConstTensor(info, storage->data() + 2), "referenced");
+    auto copied     = net.AddConstantLayer(armnn::ConstTensor(info, otherData.data()), "copied");
+    auto second     = net.AddConstantLayer(armnn::ConstTensor(info, secondStorage->data()), "second");
+
+    auto getConstantData = [](const armnn::IConnectableLayer* layer)
+    {
+        return boost::polymorphic_downcast<const armnn::ConstantLayer*>(layer)->m_LayerOutput->GetConstTensor<float>();
+    };
+
+    // Constants within the storage are referenced, others are copied
+    BOOST_TEST(getConstantData(referenced) == storage->data() + 2);
+    BOOST_TEST(getConstantData(second) == secondStorage->data());
+    BOOST_TEST(getConstantData(copied) != otherData.data());
+    BOOST_TEST(getConstantData(copied)[1] == 6.f);
+
+    // Copies of the graph, as made by Optimize(), keep referencing the storage and the copied constants
+    armnn::Graph graphCopy(net.GetGraph());
+    for (armnn::Layer* layer : graphCopy)
+    {
+        if (layer->GetNameStr() == "referenced")
+        {
+            BOOST_TEST(getConstantData(layer) == storage->data() + 2);
+        }
+        else if (layer->GetNameStr() == "copied")
+        {
+            BOOST_TEST(getConstantData(layer) == getConstantData(copied));
+        }
+    }
+    BOOST_TEST(storage.use_count() > 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
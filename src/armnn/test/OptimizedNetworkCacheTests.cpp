@@ -0,0 +1,356 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <Network.hpp>
+#include <OptimizedNetworkCache.hpp>
+
+#include <armnn/INetwork.hpp>
+#include <armnn/IRuntime.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <vector>
+
+using namespace armnn;
+
+namespace
+{
+
+INetworkPtr CreateFullyConnectedNetwork(const std::vector<float>& weightsData, float activationLimit = 6.f)
+{
+    const TensorInfo inputInfo({ 1, 2 }, DataType::Float32);
+    const TensorInfo weightsInfo({ 2, 2 }, DataType::Float32);
+
+    FullyConnectedDescriptor fullyConnectedDescriptor;
+    fullyConnectedDescriptor.m_BiasEnabled = false;
+
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::BoundedReLu;
+    activationDescriptor.m_A = activationLimit;
+
+    INetworkPtr network = INetwork::Create();
+    IConnectableLayer* input = network->AddInputLayer(0, "input");
+    IConnectableLayer* fullyConnected = network->AddFullyConnectedLayer(fullyConnectedDescriptor,
+                                                                        ConstTensor(weightsInfo, weightsData),
+                                                                        EmptyOptional(),
+                                                                        "fullyConnected");
+    IConnectableLayer* activation = network->AddActivationLayer(activationDescriptor, "activation");
+    IConnectableLayer* output = network->AddOutputLayer(0, "output");
+
+    input->GetOutputSlot(0).Connect(fullyConnected->GetInputSlot(0));
+    fullyConnected->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    fullyConnected->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    activation->GetOutputSlot(0).SetTensorInfo(inputInfo);
+
+    return network;
+}
+
+// Adds the two inputs and bounds the sum, which the reference backend fuses into a single pre-compiled layer
+INetworkPtr CreateFusedElementwiseNetwork()
+{
+    const TensorInfo info({ 1, 4 }, DataType::Float32);
+
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::BoundedReLu;
+    activationDescriptor.m_A = 6.f;
+
+    INetworkPtr network = INetwork::Create();
+    IConnectableLayer* input0 = network->AddInputLayer(0, "input0");
+    IConnectableLayer* input1 = network->AddInputLayer(1, "input1");
+    IConnectableLayer* addition = network->AddAdditionLayer("addition");
+    IConnectableLayer* activation = network->AddActivationLayer(activationDescriptor, "activation");
+    IConnectableLayer* output = network->AddOutputLayer(0, "output");
+
+    input0->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+    input1->GetOutputSlot(0).Connect(addition->GetInputSlot(1));
+    addition->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input0->GetOutputSlot(0).SetTensorInfo(info);
+    input1->GetOutputSlot(0).SetTensorInfo(info);
+    addition->GetOutputSlot(0).SetTensorInfo(info);
+    activation->GetOutputSlot(0).SetTensorInfo(info);
+
+    return network;
+}
+
+const Graph& GetGraph(const INetwork& network)
+{
+    return boost::polymorphic_downcast<const Network*>(&network)->GetGraph();
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(OptimizedNetworkCache)
+
+BOOST_AUTO_TEST_CASE(StructuralHashOfEqualNetworks)
+{
+    const std::vector<float> weights{ 1.f, 2.f, 3.f, 4.f };
+
+    INetworkPtr network      = CreateFullyConnectedNetwork(weights);
+    INetworkPtr equalNetwork = CreateFullyConnectedNetwork(weights);
+
+    BOOST_TEST(GetStructuralHash(GetGraph(*network)) == GetStructuralHash(GetGraph(*equalNetwork)));
+    BOOST_TEST(AreStructurallyEqual(GetGraph(*network), GetGraph(*equalNetwork)));
+
+    // A copy of the graph is equal to the original one
+    Graph graphCopy(GetGraph(*network));
+    BOOST_TEST(GetStructuralHash(graphCopy) == GetStructuralHash(GetGraph(*network)));
+    BOOST_TEST(AreStructurallyEqual(graphCopy, GetGraph(*network)));
+
+    // Networks differing by their constants or by their descriptors are not
+    INetworkPtr otherWeightsNetwork    = CreateFullyConnectedNetwork({ 1.f, 2.f, 3.f, 5.f });
+    INetworkPtr otherDescriptorNetwork = CreateFullyConnectedNetwork(weights, 1.f);
+
+    BOOST_TEST(GetStructuralHash(GetGraph(*network)) != GetStructuralHash(GetGraph(*otherWeightsNetwork)));
+    BOOST_TEST(!AreStructurallyEqual(GetGraph(*network), GetGraph(*otherWeightsNetwork)));
+    BOOST_TEST(GetStructuralHash(GetGraph(*network)) != GetStructuralHash(GetGraph(*otherDescriptorNetwork)));
+    BOOST_TEST(!AreStructurallyEqual(GetGraph(*network), GetGraph(*otherDescriptorNetwork)));
+}
+
+BOOST_AUTO_TEST_CASE(StructuralHashDoesNotDependOnTheOrderOfTheGraph)
+{
+    // Layers added in reverse, so the graph is reordered when it is sorted
+    const TensorInfo info({ 1, 2 }, DataType::Float32);
+    ActivationDescriptor descriptor;
+
+    INetworkPtr network = INetwork::Create();
+    IConnectableLayer* output = network->AddOutputLayer(0, "output");
+    IConnectableLayer* activation1 = network->AddActivationLayer(descriptor, "activation1");
+    IConnectableLayer* activation0 = network->AddActivationLayer(descriptor, "activation0");
+    IConnectableLayer* input = network->AddInputLayer(0, "input");
+
+    input->GetOutputSlot(0).Connect(activation0->GetInputSlot(0));
+    activation0->GetOutputSlot(0).Connect(activation1->GetInputSlot(0));
+    activation1->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(info);
+    activation0->GetOutputSlot(0).SetTensorInfo(info);
+    activation1->GetOutputSlot(0).SetTensorInfo(info);
+
+    const Graph& graph = GetGraph(*network);
+    Graph unsortedCopy(graph);
+
+    const size_t hash = GetStructuralHash(graph);
+    graph.TopologicalSort();
+
+    BOOST_TEST(GetStructuralHash(graph) == hash);
+    BOOST_TEST(GetStructuralHash(unsortedCopy) == hash);
+    BOOST_TEST(AreStructurallyEqual(graph, unsortedCopy));
+}
+
+BOOST_AUTO_TEST_CASE(DescriptorEquality)
+{
+    ActivationDescriptor activation;
+    activation.m_Function = ActivationFunction::BoundedReLu;
+    activation.m_A = 6.f;
+    activation.m_B = 0.f;
+
+    ActivationDescriptor equalActivation(activation);
+    BOOST_TEST((activation == equalActivation));
+
+    // Each member is compared, including m_A, which used to be compared to m_B
+    ActivationDescriptor otherA(activation);
+    otherA.m_A = 1.f;
+    BOOST_TEST(!(activation == otherA));
+
+    ActivationDescriptor otherB(activation);
+    otherB.m_B = -1.f;
+    BOOST_TEST(!(activation == otherB));
+
+    ActivationDescriptor otherFunction(activation);
+    otherFunction.m_Function = ActivationFunction::ReLu;
+    BOOST_TEST(!(activation == otherFunction));
+
+    ActivationDescriptor aEqualToB;
+    aEqualToB.m_A = 2.f;
+    aEqualToB.m_B = 2.f;
+    ActivationDescriptor otherAEqualToB(aEqualToB);
+    otherAEqualToB.m_A = 3.f;
+    BOOST_TEST(!(aEqualToB == otherAEqualToB));
+
+    BOOST_TEST((PreCompiledDescriptor(2, 1) == PreCompiledDescriptor(2, 1)));
+    BOOST_TEST(!(PreCompiledDescriptor(2, 1) == PreCompiledDescriptor(1, 1)));
+    BOOST_TEST(!(PreCompiledDescriptor(2, 1) == PreCompiledDescriptor(2, 2)));
+}
+
+BOOST_AUTO_TEST_CASE(OptimizeEqualNetworkFromCache)
+{
+    IRuntimePtr runtime = IRuntime::Create(IRuntime::CreationOptions());
+    IOptimizedNetworkCachePtr cache = IOptimizedNetworkCache::Create();
+
+    const std::vector<float> weights{ 1.f, 2.f, 3.f, 4.f };
+    const std::vector<BackendId> backends{ Compute::CpuRef };
+
+    IOptimizedNetworkPtr optNet = Optimize(*CreateFullyConnectedNetwork(weights), backends,
+                                           runtime->GetDeviceSpec(), *cache);
+    BOOST_CHECK(optNet);
+    BOOST_TEST(cache->GetNumMisses() == 1);
+    BOOST_TEST(cache->GetNumHits() == 0);
+    BOOST_TEST(cache->GetNumEntries() == 1);
+
+    // A network built again the same way is found in the cache
+    IOptimizedNetworkPtr cachedOptNet = Optimize(*CreateFullyConnectedNetwork(weights), backends,
+                                                 runtime->GetDeviceSpec(), *cache);
+    BOOST_CHECK(cachedOptNet);
+    BOOST_TEST(cache->GetNumMisses() == 1);
+    BOOST_TEST(cache->GetNumHits() == 1);
+    BOOST_TEST((cachedOptNet->GetGuid() != optNet->GetGuid()));
+
+    const Graph& graph       = boost::polymorphic_downcast<OptimizedNetwork*>(optNet.get())->GetGraph();
+    const Graph& cachedGraph = boost::polymorphic_downcast<OptimizedNetwork*>(cachedOptNet.get())->GetGraph();
+    BOOST_TEST(cachedGraph.GetNumLayers() == graph.GetNumLayers());
+    for (const Layer* layer : cachedGraph)
+    {
+        BOOST_TEST((layer->GetBackendId() == Compute::CpuRef));
+    }
+
+    // The copy can be loaded and run
+    NetworkId networkId;
+    BOOST_TEST(runtime->LoadNetwork(networkId, std::move(cachedOptNet)) == Status::Success);
+
+    std::vector<float> inputData{ 1.f, 1.f };
+    std::vector<float> outputData(2);
+    InputTensors inputTensors{ { 0, ConstTensor(runtime->GetInputTensorInfo(networkId, 0), inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(networkId, 0), outputData.data()) } };
+    BOOST_TEST(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == Status::Success);
+
+    // [1, 1] x [[1, 2], [3, 4]] bounded to 6
+    BOOST_TEST(outputData[0] == 4.f);
+    BOOST_TEST(outputData[1] == 6.f);
+}
+
+BOOST_AUTO_TEST_CASE(OptimizeDifferentNetworkOrSettingsNotFromCache)
+{
+    IRuntimePtr runtime = IRuntime::Create(IRuntime::CreationOptions());
+    IOptimizedNetworkCachePtr cache = IOptimizedNetworkCache::Create();
+
+    const std::vector<float> weights{ 1.f, 2.f, 3.f, 4.f };
+    const std::vector<BackendId> backends{ Compute::CpuRef };
+
+    Optimize(*CreateFullyConnectedNetwork(weights), backends, runtime->GetDeviceSpec(), *cache);
+    Optimize(*CreateFullyConnectedNetwork({ 4.f, 3.f, 2.f, 1.f }), backends, runtime->GetDeviceSpec(), *cache);
+
+    OptimizerOptions debugOptions;
+    debugOptions.m_Debug = true;
+    Optimize(*CreateFullyConnectedNetwork(weights), backends, runtime->GetDeviceSpec(), *cache, debugOptions);
+
+    BOOST_TEST(cache->GetNumMisses() == 3);
+    BOOST_TEST(cache->GetNumHits() == 0);
+    BOOST_TEST(cache->GetNumEntries() == 3);
+
+    cache->Clear();
+    BOOST_TEST(cache->GetNumEntries() == 0);
+
+    Optimize(*CreateFullyConnectedNetwork(weights), backends, runtime->GetDeviceSpec(), *cache);
+    BOOST_TEST(cache->GetNumMisses() == 4);
+}
+
+BOOST_AUTO_TEST_CASE(OptimizeFusedNetworkFromCache)
+{
+    IRuntimePtr runtime = IRuntime::Create(IRuntime::CreationOptions());
+    IOptimizedNetworkCachePtr cache = IOptimizedNetworkCache::Create();
+
+    const std::vector<BackendId> backends{ Compute::CpuRef };
+
+    // The fused program is copied along with the pre-compiled layer, so every copy of the network keeps its own
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        IOptimizedNetworkPtr optNet = Optimize(*CreateFusedElementwiseNetwork(), backends,
+                                               runtime->GetDeviceSpec(), *cache);
+        BOOST_CHECK(optNet);
+
+        const Graph& graph = boost::polymorphic_downcast<OptimizedNetwork*>(optNet.get())->GetGraph();
+        BOOST_TEST(std::any_of(graph.begin(), graph.end(), [](const Layer* layer)
+        {
+            return layer->GetType() == LayerType::PreCompiled;
+        }));
+
+        NetworkId networkId;
+        BOOST_TEST(runtime->LoadNetwork(networkId, std::move(optNet)) == Status::Success);
+
+        std::vector<float> input0Data{ -2.f, 1.f, 3.f, 5.f };
+        std::vector<float> input1Data{ 1.f, 1.f, 1.f, 3.f };
+        std::vector<float> outputData(4);
+        InputTensors inputTensors
+        {
+            { 0, ConstTensor(runtime->GetInputTensorInfo(networkId, 0), input0Data.data()) },
+            { 1, ConstTensor(runtime->GetInputTensorInfo(networkId, 1), input1Data.data()) }
+        };
+        OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(networkId, 0), outputData.data()) } };
+        BOOST_TEST(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == Status::Success);
+
+        const std::vector<float> expectedOutput{ 0.f, 2.f, 4.f, 6.f };
+        BOOST_TEST(outputData == expectedOutput, boost::test_tools::per_element());
+
+        runtime->UnloadNetwork(networkId);
+    }
+
+    BOOST_TEST(cache->GetNumMisses() == 1);
+    BOOST_TEST(cache->GetNumHits() == 2);
+    BOOST_TEST(cache->GetNumRejected() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(RejectNetworkWithUncopyablePreCompiledLayer)
+{
+    armnn::OptimizedNetworkCache cache(2);
+
+    Graph graph;
+    graph.AddLayer<InputLayer>(0, "input");
+
+    // Without a copier, the pre-compiled object would be taken over by the cached copy of the network
+    auto optimizedGraph = std::make_unique<Graph>();
+    PreCompiledLayer* preCompiled = optimizedGraph->AddLayer<PreCompiledLayer>(PreCompiledDescriptor(0, 0), "layer");
+    preCompiled->SetPreCompiledObject(PreCompiledObjectPtr(new int(0), [](const void* object)
+    {
+        delete static_cast<const int*>(object);
+    }));
+    OptimizedNetwork network(std::move(optimizedGraph));
+
+    const armnn::OptimizedNetworkCache::Settings settings;
+    cache.Insert(armnn::OptimizedNetworkCache::GetHash(graph, settings), graph, settings, network, {});
+
+    BOOST_TEST(cache.GetNumEntries() == 0);
+    BOOST_TEST(cache.GetNumRejected() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(OptimizedNetworkCacheDropsLeastRecentlyUsed)
+{
+    IRuntimePtr runtime = IRuntime::Create(IRuntime::CreationOptions());
+    IOptimizedNetworkCachePtr cache = IOptimizedNetworkCache::Create(2);
+
+    const std::vector<BackendId> backends{ Compute::CpuRef };
+    const std::vector<float> firstWeights{ 1.f, 2.f, 3.f, 4.f };
+    const std::vector<float> secondWeights{ 5.f, 6.f, 7.f, 8.f };
+    const std::vector<float> thirdWeights{ 9.f, 10.f, 11.f, 12.f };
+
+    auto optimize = [&](const std::vector<float>& weights)
+    {
+        return Optimize(*CreateFullyConnectedNetwork(weights), backends, runtime->GetDeviceSpec(), *cache);
+    };
+
+    optimize(firstWeights);
+    optimize(secondWeights);
+    optimize(firstWeights);
+    BOOST_TEST(cache->GetNumHits() == 1);
+
+    // The second network is the least recently used one
+    optimize(thirdWeights);
+    BOOST_TEST(cache->GetNumEntries() == 2);
+
+    optimize(firstWeights);
+    BOOST_TEST(cache->GetNumHits() == 2);
+    optimize(secondWeights);
+    BOOST_TEST(cache->GetNumHits() == 2);
+    BOOST_TEST(cache->GetNumMisses() == 4);
+
+    BOOST_CHECK_THROW(IOptimizedNetworkCache::Create(0), InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -10,10 +10,16 @@
 #include <boost/test/tools/output_test_stream.hpp>
 #include <boost/algorithm/string.hpp>
 
+#include <algorithm>
+#include <map>
 #include <memory>
 #include <thread>
 #include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
 
+#include <LayerWorkInstrument.hpp>
 #include <Profiling.hpp>
 
 namespace armnn
@@ -160,6 +166,257 @@ BOOST_AUTO_TEST_CASE(ProfilingMacros)
     profiler->EnableProfiling(false);
 }
 
+BOOST_AUTO_TEST_CASE(BoundedEventStorage)
+{
+    // Create and register a profiler for this thread.
+    std::unique_ptr<armnn::Profiler> profiler = std::make_unique<armnn::Profiler>();
+    armnn::ProfilerManager::GetInstance().RegisterProfiler(profiler.get());
+
+    // Enable profiling, keeping two inferences of two events at most.
+    profiler->EnableProfiling(true);
+    profiler->SetMaxEventCount(4);
+
+    for (unsigned int i = 0; i < 5; ++i)
+    {
+        ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "EnqueueWorkload");
+        { ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "Workload"); }
+    }
+
+    // The events of the three oldest inferences were recycled.
+    BOOST_TEST(armnn::GetProfilerEventSequenceSize(profiler.get()) == 4);
+
+    // The stats still cover them.
+    boost::test_tools::output_test_stream output;
+    profiler->AnalyzeEventsAndWriteResults(output);
+    BOOST_CHECK(boost::contains(output.str(), "The 6 oldest events were recycled"));
+    BOOST_CHECK(boost::contains(output.str(), "> Begin Inference: 1"));
+    BOOST_CHECK(!boost::contains(output.str(), "> Begin Inference: 2"));
+
+    std::stringstream statsStream(output.str().substr(output.str().find("Event Stats - Name")));
+    std::string line;
+    unsigned int statsFound = 0;
+    while (std::getline(statsStream, line) && !line.empty())
+    {
+        if (boost::contains(line, "EnqueueWorkload") || boost::contains(line, "Workload"))
+        {
+            std::vector<std::string> fields;
+            boost::split(fields, line, boost::is_any_of(" \t"), boost::token_compress_on);
+            BOOST_TEST(fields.back() == "5");
+            ++statsFound;
+        }
+    }
+    BOOST_TEST(statsFound == 2);
+
+    // An inference which is still being recorded is kept whole, beyond the limit.
+    {
+        ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "EnqueueWorkload");
+        for (unsigned int i = 0; i < 5; ++i)
+        {
+            ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "Workload");
+        }
+    }
+    BOOST_TEST(armnn::GetProfilerEventSequenceSize(profiler.get()) == 6);
+
+    // Disable profiling here to not print out anything on stdout.
+    profiler->EnableProfiling(false);
+}
+
+BOOST_AUTO_TEST_CASE(ChromeTrace)
+{
+    // Create and register a profiler for this thread.
+    std::unique_ptr<armnn::Profiler> profiler = std::make_unique<armnn::Profiler>();
+    armnn::ProfilerManager::GetInstance().RegisterProfiler(profiler.get());
+    profiler->EnableProfiling(true);
+
+    // Stream the events while they are recorded, on this thread and another one.
+    std::stringstream streamed;
+    profiler->SetChromeTraceStream(&streamed);
+    {
+        ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "Outer");
+        { ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuAcc, "Inner \"quoted\""); }
+    }
+
+    std::thread thread([&profiler]()
+    {
+        armnn::ProfilerManager::GetInstance().RegisterProfiler(profiler.get());
+        ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::GpuAcc, "OtherThread");
+        armnn::ProfilerManager::GetInstance().RegisterProfiler(nullptr);
+    });
+    thread.join();
+
+    // The events were streamed as they ended, before the trace is closed.
+    BOOST_CHECK(boost::starts_with(streamed.str(), "["));
+    BOOST_CHECK(boost::contains(streamed.str(), R"("name": "Inner \"quoted\"", "cat": "CpuAcc", "ph": "X")"));
+    BOOST_CHECK(!boost::contains(streamed.str(), "]"));
+    profiler->SetChromeTraceStream(nullptr);
+    BOOST_CHECK(boost::ends_with(streamed.str(), "\n]\n"));
+
+    // Printing the trace gives the same events, in the order they began rather than ended, one thread per timeline.
+    std::stringstream printed;
+    profiler->PrintChromeTrace(printed);
+    auto SortedEvents = [](const std::string& trace)
+    {
+        std::vector<std::string> events;
+        boost::split(events, trace, boost::is_any_of("\n"));
+        for (std::string& event : events)
+        {
+            boost::trim_right_if(event, boost::is_any_of(","));
+        }
+        std::sort(events.begin(), events.end());
+        return events;
+    };
+    BOOST_CHECK(SortedEvents(printed.str()) == SortedEvents(streamed.str()));
+
+    const std::string trace = printed.str();
+    for (const std::string name : { "Outer", "OtherThread" })
+    {
+        BOOST_CHECK(boost::contains(trace, R"("name": ")" + name + R"(", )"));
+    }
+    BOOST_CHECK(boost::contains(trace, R"("name": "thread_name", "ph": "M", "pid": 0, "tid": 0)"));
+    BOOST_CHECK(boost::contains(trace, R"("name": "thread_name", "ph": "M", "pid": 0, "tid": 1)"));
+    BOOST_CHECK(boost::contains(trace, R"("cat": "GpuAcc", "ph": "X", "pid": 0, "tid": 1, "ts": )"));
+
+    // Disable profiling here to not print out anything on stdout.
+    profiler->EnableProfiling(false);
+}
+
+BOOST_AUTO_TEST_CASE(LayerWork)
+{
+    // Create and register a profiler for this thread.
+    std::unique_ptr<armnn::Profiler> profiler = std::make_unique<armnn::Profiler>();
+    armnn::ProfilerManager::GetInstance().RegisterProfiler(profiler.get());
+    profiler->EnableProfiling(true);
+
+    armnn::LayerWorkEstimate work;
+    work.m_Flops        = 2000000;
+    work.m_BytesRead    = 300000;
+    work.m_BytesWritten = 100000;
+
+    armnn::LayerWorkInstrument instrument(work);
+    instrument.Start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    instrument.Stop();
+
+    // The work is reported as it was estimated, and the achieved rates over at least 10 ms are bounded by it.
+    std::vector<armnn::Measurement> measurements = instrument.GetMeasurements();
+    BOOST_REQUIRE(measurements.size() == 5);
+    BOOST_TEST(measurements[0].m_Name == armnn::LayerWorkInstrument::FLOPS);
+    BOOST_TEST(measurements[0].m_Value == 2000000.0);
+    BOOST_TEST(measurements[1].m_Value == 300000.0);
+    BOOST_TEST(measurements[2].m_Value == 100000.0);
+    BOOST_TEST(measurements[3].m_Unit == armnn::Measurement::Unit::GFLOP_PER_S);
+    BOOST_TEST(measurements[3].m_Value > 0.0);
+    BOOST_TEST(measurements[3].m_Value <= 0.2);
+    BOOST_TEST(measurements[4].m_Value > 0.0);
+    BOOST_TEST(measurements[4].m_Value <= 0.04);
+
+    // Only the events with work are reported in the work table, with their average work per execution.
+    for (unsigned int i = 0; i < 2; ++i)
+    {
+        armnn::ScopedProfilingEvent layerEvent(armnn::Compute::CpuRef,
+                                               "convolution",
+                                               armnn::WallClockTimer(),
+                                               armnn::LayerWorkInstrument(work));
+        ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "RefConvolution2dWorkload_Execute");
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    // The work of the layers which are not modelled is labelled as estimated
+    armnn::LayerWorkEstimate estimatedWork;
+    estimatedWork.m_Flops       = 1000;
+    estimatedWork.m_IsEstimated = true;
+    {
+        armnn::ScopedProfilingEvent layerEvent(armnn::Compute::CpuRef,
+                                               "resize",
+                                               armnn::WallClockTimer(),
+                                               armnn::LayerWorkInstrument(estimatedWork));
+    }
+
+    boost::test_tools::output_test_stream output;
+    profiler->AnalyzeEventsAndWriteResults(output);
+    const std::string::size_type workTable = output.str().find("Event Work - Name");
+    BOOST_REQUIRE(workTable != std::string::npos);
+
+    std::stringstream workStream(output.str().substr(workTable));
+    std::string line;
+    std::getline(workStream, line);
+    BOOST_REQUIRE(std::getline(workStream, line));
+    std::vector<std::string> fields;
+    boost::split(fields, boost::trim_copy(line), boost::is_any_of(" \t"), boost::token_compress_on);
+    BOOST_REQUIRE(fields.size() == 6);
+    BOOST_TEST(fields[0] == "convolution");
+    BOOST_TEST(fields[1] == "2.000");
+    BOOST_TEST(fields[2] == "0.400");
+    BOOST_TEST(fields[3] == "5.000");
+
+    // The rates achieved by the events, which ran as long as the instrument above, match the ones it reports
+    // up to the jitter of the sleeps.
+    const double gflopsPerS = std::stod(fields[4]);
+    const double gbytesPerS = std::stod(fields[5]);
+    BOOST_TEST(gflopsPerS > measurements[3].m_Value * 0.5);
+    BOOST_TEST(gflopsPerS < measurements[3].m_Value * 2.0);
+    BOOST_TEST(gbytesPerS > measurements[4].m_Value * 0.5);
+    BOOST_TEST(gbytesPerS < measurements[4].m_Value * 2.0);
+
+    BOOST_REQUIRE(std::getline(workStream, line));
+    BOOST_TEST(line.find("resize") != std::string::npos);
+    BOOST_TEST(line.find("(estimated)") != std::string::npos);
+    BOOST_TEST((!std::getline(workStream, line) || line.empty()));
+
+    // Disable profiling here to not print out anything on stdout.
+    profiler->EnableProfiling(false);
+}
+
+BOOST_AUTO_TEST_CASE(InferenceSampling)
+{
+    // Create and register a profiler for this thread.
+    std::unique_ptr<armnn::Profiler> profiler = std::make_unique<armnn::Profiler>();
+    armnn::ProfilerManager::GetInstance().RegisterProfiler(profiler.get());
+    profiler->EnableProfiling(true);
+
+    BOOST_CHECK_THROW(profiler->SetInferenceSampling(armnn::InferenceSamplingOptions(0)),
+                      armnn::InvalidArgumentException);
+    BOOST_CHECK_THROW(profiler->SetInferenceSampling(armnn::InferenceSamplingOptions(1, 0.0f)),
+                      armnn::InvalidArgumentException);
+
+    // Profile one inference in every four.
+    profiler->SetInferenceSampling(armnn::InferenceSamplingOptions(4));
+
+    { ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "LoadNetwork"); }
+    for (unsigned int i = 0; i < 8; ++i)
+    {
+        armnn::ScopedProfilingInference inference;
+        ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "EnqueueWorkload");
+        { ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "Workload"); }
+    }
+    { ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "UnloadNetwork"); }
+
+    // The events outside inferences are always recorded, and the ones of the first and fifth inferences only.
+    BOOST_TEST(armnn::GetProfilerEventSequenceSize(profiler.get()) == 6);
+
+    // The counts of the events of inferences are scaled up to all the inferences, the others are not.
+    boost::test_tools::output_test_stream output;
+    profiler->AnalyzeEventsAndWriteResults(output);
+    BOOST_CHECK(boost::contains(output.str(), "Profiled 2 of the 8 inferences run"));
+
+    std::stringstream statsStream(output.str().substr(output.str().find("Event Stats - Name")));
+    std::string line;
+    std::map<std::string, std::string> counts;
+    while (std::getline(statsStream, line) && !line.empty())
+    {
+        std::vector<std::string> fields;
+        boost::split(fields, boost::trim_copy(line), boost::is_any_of(" \t"), boost::token_compress_on);
+        counts[fields.front()] = fields.back();
+    }
+    BOOST_TEST(counts["EnqueueWorkload"] == "8");
+    BOOST_TEST(counts["Workload"] == "8");
+    BOOST_TEST(counts["LoadNetwork"] == "1");
+    BOOST_TEST(counts["UnloadNetwork"] == "1");
+
+    // Disable profiling here to not print out anything on stdout.
+    profiler->EnableProfiling(false);
+}
+
 #if defined(ARMNNREF_ENABLED)
 
 // This test unit needs the reference backend, it's not available if the reference backend is not built
@@ -100,4 +100,41 @@ BOOST_AUTO_TEST_CASE(ProfilingEventTestOnGpuAcc)
     BOOST_CHECK(gpuAccBackendId == testEvent2.GetBackendId());
 }
 
+BOOST_AUTO_TEST_CASE(ProfilingEventReusesInstruments)
+{
+    class CountingInstrument : public Instrument
+    {
+    public:
+        void Start() override {}
+        void Stop() override {}
+        std::vector<Measurement> GetMeasurements() const override { return {}; }
+        const char* GetName() const override { return "CountingInstrument"; }
+    };
+
+    Event testEvent("EventName", nullptr, nullptr, BackendId(), Event::Instruments());
+    testEvent.AssignInstruments(WallClockTimer());
+    BOOST_TEST(testEvent.GetInstruments().size() == 1);
+    const Instrument* timer = testEvent.GetInstruments()[0].get();
+
+    // Reusing the event for another one keeps its instrument of the same type
+    testEvent.Reset("OtherEventName", nullptr, Compute::CpuRef);
+    testEvent.AssignInstruments(WallClockTimer());
+    BOOST_CHECK_EQUAL(testEvent.GetName(), "OtherEventName");
+    BOOST_TEST(testEvent.GetInstruments().size() == 1);
+    BOOST_TEST(testEvent.GetInstruments()[0].get() == timer);
+
+    testEvent.Start();
+    testEvent.Stop();
+    BOOST_TEST(testEvent.GetMeasurements().size() == 3);
+
+    // Instruments of other types replace it, and extra ones are added
+    testEvent.AssignInstruments(CountingInstrument(), WallClockTimer());
+    BOOST_TEST(testEvent.GetInstruments().size() == 2);
+    BOOST_CHECK_EQUAL(testEvent.GetInstruments()[0]->GetName(), "CountingInstrument");
+    BOOST_CHECK_EQUAL(testEvent.GetInstruments()[1]->GetName(), WallClockTimer().GetName());
+
+    testEvent.AssignInstruments();
+    BOOST_TEST(testEvent.GetInstruments().empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -19,6 +19,7 @@
 #include <valgrind/memcheck.h>
 #endif
 
+#include <boost/polymorphic_cast.hpp>
 #include <boost/test/unit_test.hpp>
 #include "RuntimeTests.hpp"
 
@@ -197,6 +198,73 @@ BOOST_AUTO_TEST_CASE(RuntimeCpuRef)
     BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
 }
 
+BOOST_AUTO_TEST_CASE(RuntimeSharesConstantTensors)
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    const TensorInfo inputInfo({ 1, 4 }, DataType::Float32);
+    const TensorInfo weightsInfo({ 4, 4 }, DataType::Float32);
+    const TensorInfo biasInfo({ 4 }, DataType::Float32);
+
+    const std::vector<float> weightsData(weightsInfo.GetNumElements(), 0.5f);
+    const std::vector<float> biasData{ 1.f, 2.f, 3.f, 4.f };
+
+    FullyConnectedDescriptor descriptor;
+    descriptor.m_BiasEnabled = true;
+
+    // build up the structure of the network
+    INetworkPtr net(INetwork::Create());
+
+    IConnectableLayer* input = net->AddInputLayer(0);
+    IConnectableLayer* fullyConnected = net->AddFullyConnectedLayer(descriptor,
+                                                                    ConstTensor(weightsInfo, weightsData),
+                                                                    Optional<ConstTensor>(ConstTensor(biasInfo,
+                                                                                                      biasData)));
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(fullyConnected->GetInputSlot(0));
+    fullyConnected->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    fullyConnected->GetOutputSlot(0).SetTensorInfo(inputInfo);
+
+    // Load the same network twice
+    std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+    armnn::NetworkId netId1;
+    armnn::NetworkId netId2;
+    BOOST_TEST(runtime->LoadNetwork(netId1, Optimize(*net, backends, runtime->GetDeviceSpec())) == Status::Success);
+    BOOST_TEST(runtime->LoadNetwork(netId2, Optimize(*net, backends, runtime->GetDeviceSpec())) == Status::Success);
+
+    // The workloads of both networks reference a single copy of the weights and bias
+    const ConstTensorStore& store =
+        boost::polymorphic_downcast<armnn::Runtime*>(runtime.get())->GetConstTensorStore();
+    BOOST_TEST(store.GetNumTensors() == 2);
+    BOOST_TEST(store.GetNumBytes() == weightsInfo.GetNumBytes() + biasInfo.GetNumBytes());
+
+    const std::vector<float> inputData{ 1.f, 1.f, 1.f, 1.f };
+    const std::vector<float> expectedOutputData{ 3.f, 4.f, 5.f, 6.f };
+    for (armnn::NetworkId netId : { netId1, netId2 })
+    {
+        std::vector<float> outputData(4);
+        InputTensors inputTensors{ { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) } };
+
+        BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+        BOOST_TEST(outputData == expectedOutputData);
+    }
+
+    // The weights are freed with the last network using them, once the network they were added to is gone too
+    net.reset();
+    BOOST_TEST(store.GetNumTensors() == 2);
+    BOOST_TEST(runtime->UnloadNetwork(netId1) == Status::Success);
+    BOOST_TEST(store.GetNumTensors() == 2);
+    BOOST_TEST(runtime->UnloadNetwork(netId2) == Status::Success);
+    BOOST_TEST(store.GetNumTensors() == 0);
+}
+
 BOOST_AUTO_TEST_CASE(RuntimeFallbackToCpuRef)
 {
     using namespace armnn;
@@ -371,7 +439,7 @@ BOOST_AUTO_TEST_CASE(ProfilingDisable)
     BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
 
     profiling::ProfilingServiceRuntimeHelper profilingServiceHelper;
-    profiling::BufferManager& bufferManager = profilingServiceHelper.GetProfilingBufferManager();
+    profiling::RingBufferManager& bufferManager = profilingServiceHelper.GetProfilingBufferManager();
     auto readableBuffer = bufferManager.GetReadableBuffer();
 
     // Profiling is not enabled, the post-optimisation structure should not be created
@@ -415,7 +483,7 @@ BOOST_AUTO_TEST_CASE(ProfilingEnableCpuRef)
     BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
 
     profiling::ProfilingServiceRuntimeHelper profilingServiceHelper;
-    profiling::BufferManager& bufferManager = profilingServiceHelper.GetProfilingBufferManager();
+    profiling::RingBufferManager& bufferManager = profilingServiceHelper.GetProfilingBufferManager();
     auto readableBuffer = bufferManager.GetReadableBuffer();
 
     // Profiling is enabled, the post-optimisation structure should be created
@@ -703,17 +771,18 @@ BOOST_AUTO_TEST_CASE(ProfilingEnableCpuRef)
     // Does the inference.
     runtime->EnqueueWorkload(netId, inputTensors, outputTensors);
 
-    // Get readable buffer for inference timeline
-    auto inferenceReadableBuffer = bufferManager.GetReadableBuffer();
-    BOOST_CHECK(inferenceReadableBuffer != nullptr);
+    // The buffers are read in the order they were committed in
+    // Get readable buffer for input workload
+    auto inputReadableBuffer = bufferManager.GetReadableBuffer();
+    BOOST_CHECK(inputReadableBuffer != nullptr);
 
     // Get readable buffer for output workload
     auto outputReadableBuffer = bufferManager.GetReadableBuffer();
     BOOST_CHECK(outputReadableBuffer != nullptr);
 
-    // Get readable buffer for input workload
-    auto inputReadableBuffer = bufferManager.GetReadableBuffer();
-    BOOST_CHECK(inputReadableBuffer != nullptr);
+    // Get readable buffer for inference timeline
+    auto inferenceReadableBuffer = bufferManager.GetReadableBuffer();
+    BOOST_CHECK(inferenceReadableBuffer != nullptr);
 
     // Validate input workload data
     size = inputReadableBuffer->GetSize();
@@ -0,0 +1,105 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "../TestUtils.hpp"
+
+#include <Optimizer.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace armnn;
+
+BOOST_AUTO_TEST_SUITE(Optimizer)
+using namespace armnn::optimizations;
+
+BOOST_AUTO_TEST_CASE(DeduplicateConstantLayersTest)
+{
+    Graph graph;
+
+    const TensorInfo info({ 1, 3 }, DataType::Float32);
+    const std::vector<float> data{ 1.f, 2.f, 3.f };
+    const std::vector<float> duplicateData(data);
+    const std::vector<float> otherData{ 1.f, 2.f, 4.f };
+
+    auto addConstantLayer = [&](const std::vector<float>& values, const char* name)
+    {
+        ConstantLayer* constant = graph.AddLayer<ConstantLayer>(name);
+        constant->m_LayerOutput = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(info, values));
+        constant->GetOutputSlot().SetTensorInfo(info);
+        return constant;
+    };
+
+    ConstantLayer* constant  = addConstantLayer(data, "constant");
+    ConstantLayer* duplicate = addConstantLayer(duplicateData, "duplicate");
+    ConstantLayer* other     = addConstantLayer(otherData, "other");
+
+    Layer* add = graph.AddLayer<AdditionLayer>("add");
+    add->GetOutputSlot().SetTensorInfo(info);
+
+    Layer* mul = graph.AddLayer<MultiplicationLayer>("mul");
+    mul->GetOutputSlot().SetTensorInfo(info);
+
+    Layer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    // constant + duplicate -> mul(other) -> output
+    constant->GetOutputSlot().Connect(add->GetInputSlot(0));
+    duplicate->GetOutputSlot().Connect(add->GetInputSlot(1));
+    add->GetOutputSlot().Connect(mul->GetInputSlot(0));
+    other->GetOutputSlot().Connect(mul->GetInputSlot(1));
+    mul->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    BOOST_TEST(graph.GetNumLayers() == 6);
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(DeduplicateConstants()));
+
+    // One of the two equal constants is left, connected to both inputs of the addition
+    BOOST_TEST(graph.GetNumLayers() == 5);
+    BOOST_TEST(add->GetInputSlot(0).GetConnectedOutputSlot() == add->GetInputSlot(1).GetConnectedOutputSlot());
+    BOOST_TEST(mul->GetInputSlot(1).GetConnectedOutputSlot() == &other->GetOutputSlot());
+}
+
+BOOST_AUTO_TEST_CASE(DeduplicateLayerWeightsTest)
+{
+    Graph graph;
+
+    const TensorInfo inputInfo({ 1, 3 }, DataType::Float32);
+    const TensorInfo weightsInfo({ 3, 3 }, DataType::Float32);
+
+    const std::vector<float> weightsData{ 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f };
+
+    FullyConnectedDescriptor descriptor;
+    descriptor.m_BiasEnabled = false;
+
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(inputInfo);
+
+    // Two layers with tied weights, each holding its own copy
+    FullyConnectedLayer* first = graph.AddLayer<FullyConnectedLayer>(descriptor, "first");
+    first->m_Weight = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(weightsInfo, weightsData));
+    first->GetOutputSlot().SetTensorInfo(inputInfo);
+
+    FullyConnectedLayer* second = graph.AddLayer<FullyConnectedLayer>(descriptor, "second");
+    second->m_Weight = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(weightsInfo, weightsData));
+    second->GetOutputSlot().SetTensorInfo(inputInfo);
+
+    Layer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot().Connect(first->GetInputSlot(0));
+    first->GetOutputSlot().Connect(second->GetInputSlot(0));
+    second->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    BOOST_TEST(first->m_Weight->GetConstTensor<void>() != second->m_Weight->GetConstTensor<void>());
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(DeduplicateConstants()));
+
+    // The weights are stored once
+    BOOST_TEST(first->m_Weight->GetConstTensor<void>() == second->m_Weight->GetConstTensor<void>());
+    BOOST_TEST(first->m_Weight->GetSharedStorage() != nullptr);
+
+    const float* weights = second->m_Weight->GetConstTensor<float>();
+    BOOST_TEST(std::vector<float>(weights, weights + weightsInfo.GetNumElements()) == weightsData);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,202 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "../TestUtils.hpp"
+
+#include <Optimizer.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+
+using namespace armnn;
+
+BOOST_AUTO_TEST_SUITE(Optimizer)
+using namespace armnn::optimizations;
+
+namespace
+{
+
+ConstantLayer* AddConstantLayer(Graph& graph, const TensorInfo& info, const std::vector<float>& data, const char* name)
+{
+    ConstantLayer* constant = graph.AddLayer<ConstantLayer>(name);
+    constant->m_LayerOutput = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(info, data));
+    constant->GetOutputSlot().SetTensorInfo(info);
+    return constant;
+}
+
+std::vector<float> GetTensorData(const ScopedCpuTensorHandle& handle)
+{
+    const float* data = handle.GetConstTensor<float>();
+    return std::vector<float>(data, data + handle.GetTensorInfo().GetNumElements());
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(FoldScaleShiftIntoConvolution2dTest)
+{
+    Graph graph;
+
+    const TensorInfo inputInfo({ 1, 2, 2, 2 }, DataType::Float32);
+    const TensorInfo outputInfo({ 1, 2, 2, 2 }, DataType::Float32);
+    const TensorInfo perChannelInfo({ 1, 1, 1, 2 }, DataType::Float32);
+
+    Convolution2dDescriptor convolution2dDescriptor;
+    convolution2dDescriptor.m_BiasEnabled = false;
+    convolution2dDescriptor.m_DataLayout  = DataLayout::NHWC;
+
+    // 1x1 convolution with weights [O, H, W, I]
+    const std::vector<float> weightsData{ 1.f, 2.f, 3.f, 4.f };
+    ConstTensor weights(TensorInfo({ 2, 1, 1, 2 }, DataType::Float32), weightsData);
+
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(inputInfo);
+
+    Convolution2dLayer* conv2d = graph.AddLayer<Convolution2dLayer>(convolution2dDescriptor, "conv2d");
+    conv2d->m_Weight = std::make_unique<ScopedCpuTensorHandle>(weights);
+    conv2d->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    ConstantLayer* scale = AddConstantLayer(graph, perChannelInfo, { 2.f, 10.f }, "scale");
+    ConstantLayer* shift = AddConstantLayer(graph, perChannelInfo, { 0.5f, -1.f }, "shift");
+
+    Layer* mul = graph.AddLayer<MultiplicationLayer>("mul");
+    mul->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    Layer* add = graph.AddLayer<AdditionLayer>("add");
+    add->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    Layer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    // Connect up layers - input -> conv2d -> mul -> add -> output
+    input->GetOutputSlot().Connect(conv2d->GetInputSlot(0));
+    conv2d->GetOutputSlot().Connect(mul->GetInputSlot(0));
+    scale->GetOutputSlot().Connect(mul->GetInputSlot(1));
+    shift->GetOutputSlot().Connect(add->GetInputSlot(0));
+    mul->GetOutputSlot().Connect(add->GetInputSlot(1));
+    add->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FoldMultiplicationIntoConvolution2d(),
+                                                           FoldAdditionIntoConvolution2d()));
+
+    auto checkFoldedConv2d = [](const armnn::Layer* const layer) -> bool
+    {
+        if (!IsLayerOfType<armnn::Convolution2dLayer>(layer))
+        {
+            return false;
+        }
+
+        const auto conv2dLayer = static_cast<const armnn::Convolution2dLayer*>(layer);
+        return conv2dLayer->GetParameters().m_BiasEnabled &&
+               GetTensorData(*conv2dLayer->m_Weight) == std::vector<float>({ 2.f, 4.f, 30.f, 40.f }) &&
+               GetTensorData(*conv2dLayer->m_Bias) == std::vector<float>({ 0.5f, -1.f });
+    };
+
+    BOOST_TEST(CheckSequence(graph.cbegin(),
+                             graph.cend(),
+                             &IsLayerOfType<armnn::InputLayer>,
+                             checkFoldedConv2d,
+                             &IsLayerOfType<armnn::OutputLayer>));
+}
+
+BOOST_AUTO_TEST_CASE(FoldScaleIntoFullyConnectedTest)
+{
+    Graph graph;
+
+    const TensorInfo inputInfo({ 1, 3 }, DataType::Float32);
+    const TensorInfo outputInfo({ 1, 2 }, DataType::Float32);
+
+    FullyConnectedDescriptor fullyConnectedDescriptor;
+    fullyConnectedDescriptor.m_BiasEnabled = true;
+    fullyConnectedDescriptor.m_TransposeWeightMatrix = false;
+
+    // Weights are [I, O]
+    const std::vector<float> weightsData{ 1.f, 2.f, 3.f, 4.f, 5.f, 6.f };
+    const std::vector<float> biasData{ 1.f, 1.f };
+
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(inputInfo);
+
+    FullyConnectedLayer* fullyConnected = graph.AddLayer<FullyConnectedLayer>(fullyConnectedDescriptor, "fc");
+    fullyConnected->m_Weight = std::make_unique<ScopedCpuTensorHandle>(
+        ConstTensor(TensorInfo({ 3, 2 }, DataType::Float32), weightsData));
+    fullyConnected->m_Bias = std::make_unique<ScopedCpuTensorHandle>(
+        ConstTensor(TensorInfo({ 2 }, DataType::Float32), biasData));
+    fullyConnected->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    ConstantLayer* scale = AddConstantLayer(graph, TensorInfo({ 1, 2 }, DataType::Float32), { 2.f, 3.f }, "scale");
+
+    Layer* mul = graph.AddLayer<MultiplicationLayer>("mul");
+    mul->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    Layer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot().Connect(fullyConnected->GetInputSlot(0));
+    fullyConnected->GetOutputSlot().Connect(mul->GetInputSlot(0));
+    scale->GetOutputSlot().Connect(mul->GetInputSlot(1));
+    mul->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FoldMultiplicationIntoFullyConnected()));
+
+    auto checkFoldedFullyConnected = [](const armnn::Layer* const layer) -> bool
+    {
+        if (!IsLayerOfType<armnn::FullyConnectedLayer>(layer))
+        {
+            return false;
+        }
+
+        const auto fullyConnectedLayer = static_cast<const armnn::FullyConnectedLayer*>(layer);
+        return layer->GetNameStr() == "folded-mul-into-fc" &&
+               GetTensorData(*fullyConnectedLayer->m_Weight) ==
+                   std::vector<float>({ 2.f, 6.f, 6.f, 12.f, 10.f, 18.f }) &&
+               GetTensorData(*fullyConnectedLayer->m_Bias) == std::vector<float>({ 2.f, 3.f });
+    };
+
+    BOOST_TEST(CheckSequence(graph.cbegin(),
+                             graph.cend(),
+                             &IsLayerOfType<armnn::InputLayer>,
+                             checkFoldedFullyConnected,
+                             &IsLayerOfType<armnn::OutputLayer>));
+}
+
+BOOST_AUTO_TEST_CASE(FoldScaleIntoFullyConnectedNotPerChannelTest)
+{
+    Graph graph;
+
+    const TensorInfo inputInfo({ 2, 3 }, DataType::Float32);
+    const TensorInfo outputInfo({ 2, 2 }, DataType::Float32);
+
+    FullyConnectedDescriptor fullyConnectedDescriptor;
+    fullyConnectedDescriptor.m_BiasEnabled = false;
+
+    const std::vector<float> weightsData{ 1.f, 2.f, 3.f, 4.f, 5.f, 6.f };
+
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(inputInfo);
+
+    FullyConnectedLayer* fullyConnected = graph.AddLayer<FullyConnectedLayer>(fullyConnectedDescriptor, "fc");
+    fullyConnected->m_Weight = std::make_unique<ScopedCpuTensorHandle>(
+        ConstTensor(TensorInfo({ 3, 2 }, DataType::Float32), weightsData));
+    fullyConnected->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    // The scale varies along the batch dimension so it cannot be folded into the weights
+    ConstantLayer* scale = AddConstantLayer(graph, TensorInfo({ 2, 1 }, DataType::Float32), { 2.f, 3.f }, "scale");
+
+    Layer* mul = graph.AddLayer<MultiplicationLayer>("mul");
+    mul->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    Layer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot().Connect(fullyConnected->GetInputSlot(0));
+    fullyConnected->GetOutputSlot().Connect(mul->GetInputSlot(0));
+    scale->GetOutputSlot().Connect(mul->GetInputSlot(1));
+    mul->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FoldMultiplicationIntoFullyConnected()));
+
+    BOOST_TEST(graph.GetNumLayers() == 5);
+    BOOST_TEST(std::any_of(graph.cbegin(), graph.cend(), &IsLayerOfType<armnn::MultiplicationLayer>));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
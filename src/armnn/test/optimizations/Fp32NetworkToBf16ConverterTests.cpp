@@ -0,0 +1,115 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "../TestUtils.hpp"
+
+#include <BFloat16.hpp>
+#include <Optimizer.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace armnn;
+
+BOOST_AUTO_TEST_SUITE(Optimizer)
+using namespace armnn::optimizations;
+
+BOOST_AUTO_TEST_CASE(Fp32NetworkToBf16OptimizationTest)
+{
+    Graph graph;
+
+    const TensorInfo infoFP32({ 1, 3 }, DataType::Float32);
+
+    FullyConnectedDescriptor descriptor;
+    descriptor.m_BiasEnabled = true;
+
+    const std::vector<float> weightsData{ 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f };
+    const std::vector<float> biasData{ 0.5f, 1.5f, 2.5f };
+
+    // input -> fc1 -> floor -> fc2 -> output
+    auto input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(infoFP32);
+
+    std::vector<FullyConnectedLayer*> fullyConnectedLayers;
+    for (const char* name : { "fc1", "fc2" })
+    {
+        auto fullyConnected = graph.AddLayer<FullyConnectedLayer>(descriptor, name);
+        fullyConnected->m_Weight = std::make_unique<ScopedCpuTensorHandle>(
+            ConstTensor(TensorInfo({ 3, 3 }, DataType::Float32), weightsData));
+        fullyConnected->m_Bias = std::make_unique<ScopedCpuTensorHandle>(
+            ConstTensor(TensorInfo({ 3 }, DataType::Float32), biasData));
+        fullyConnected->GetOutputSlot().SetTensorInfo(infoFP32);
+        fullyConnectedLayers.push_back(fullyConnected);
+    }
+
+    auto floor = graph.AddLayer<FloorLayer>("floor");
+    floor->GetOutputSlot().SetTensorInfo(infoFP32);
+
+    auto output = graph.AddLayer<OutputLayer>(1, "output");
+
+    input->GetOutputSlot().Connect(fullyConnectedLayers[0]->GetInputSlot(0));
+    fullyConnectedLayers[0]->GetOutputSlot().Connect(floor->GetInputSlot(0));
+    floor->GetOutputSlot().Connect(fullyConnectedLayers[1]->GetInputSlot(0));
+    fullyConnectedLayers[1]->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    // Run the optimizer
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(Fp32NetworkToBf16Converter()));
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(ConvertConstantsFloatToBFloat()));
+
+    // Only the fully connected layers run in BFloat16, the floor layer is left in Float32
+    BOOST_TEST(CheckSequence(graph.cbegin(), graph.cend(),
+                             &IsLayerOfType<InputLayer>,
+                             &IsLayerOfType<ConvertFp32ToBf16Layer>,
+                             &IsLayerOfType<FullyConnectedLayer>,
+                             &IsLayerOfType<ConvertBf16ToFp32Layer>,
+                             &IsLayerOfType<FloorLayer>,
+                             &IsLayerOfType<ConvertFp32ToBf16Layer>,
+                             &IsLayerOfType<FullyConnectedLayer>,
+                             &IsLayerOfType<ConvertBf16ToFp32Layer>,
+                             &IsLayerOfType<OutputLayer>));
+
+    BOOST_TEST((floor->GetOutputSlot().GetTensorInfo().GetDataType() == DataType::Float32));
+    for (FullyConnectedLayer* fullyConnected : fullyConnectedLayers)
+    {
+        BOOST_TEST((fullyConnected->GetDataType() == DataType::BFloat16));
+        BOOST_TEST((fullyConnected->GetOutputSlot().GetTensorInfo().GetDataType() == DataType::BFloat16));
+        BOOST_TEST((fullyConnected->m_Weight->GetTensorInfo().GetDataType() == DataType::BFloat16));
+        BOOST_TEST((fullyConnected->m_Bias->GetTensorInfo().GetDataType() == DataType::BFloat16));
+
+        const BFloat16* weights = fullyConnected->m_Weight->GetConstTensor<BFloat16>();
+        BOOST_TEST(weights[8].ToFloat32() == 9.f);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(OptimizeInverseConversionsBf16Test)
+{
+    Graph graph;
+
+    const TensorInfo infoFP32({ 1, 3 }, DataType::Float32);
+    const TensorInfo infoBF16({ 1, 3 }, DataType::BFloat16);
+
+    auto input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(infoBF16);
+
+    auto toFp32 = graph.AddLayer<ConvertBf16ToFp32Layer>("toFp32");
+    toFp32->GetOutputSlot().SetTensorInfo(infoFP32);
+
+    auto toBf16 = graph.AddLayer<ConvertFp32ToBf16Layer>("toBf16");
+    toBf16->GetOutputSlot().SetTensorInfo(infoBF16);
+
+    auto output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot().Connect(toFp32->GetInputSlot(0));
+    toFp32->GetOutputSlot().Connect(toBf16->GetInputSlot(0));
+    toBf16->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(OptimizeInverseConversionsBf16()));
+
+    // Widening to Float32 and narrowing back is lossless so both conversions are removed
+    BOOST_TEST(CheckSequence(graph.cbegin(), graph.cend(),
+                             &IsLayerOfType<InputLayer>,
+                             &IsLayerOfType<OutputLayer>));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
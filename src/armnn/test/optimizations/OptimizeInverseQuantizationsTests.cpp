@@ -0,0 +1,159 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "../TestUtils.hpp"
+
+#include <Optimizer.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace armnn;
+
+BOOST_AUTO_TEST_SUITE(Optimizer)
+using namespace armnn::optimizations;
+
+BOOST_AUTO_TEST_CASE(OptimizeInverseQuantizationsTest)
+{
+    armnn::Graph graph;
+
+    const TensorInfo quantizedInfo({ 1, 4 }, DataType::QAsymmU8, 0.5f, 10);
+    const TensorInfo floatInfo({ 1, 4 }, DataType::Float32);
+
+    auto output = graph.AddLayer<armnn::OutputLayer>(0, "output");
+
+    graph.InsertNewLayer<armnn::InputLayer>(output->GetInputSlot(0), 0, "input")
+        ->GetOutputHandler().SetTensorInfo(quantizedInfo);
+
+    // Dequantize followed by a Quantize restoring the original tensor
+    graph.InsertNewLayer<armnn::DequantizeLayer>(output->GetInputSlot(0), "dequantize")
+        ->GetOutputHandler().SetTensorInfo(floatInfo);
+    graph.InsertNewLayer<armnn::QuantizeLayer>(output->GetInputSlot(0), "quantize")
+        ->GetOutputHandler().SetTensorInfo(quantizedInfo);
+
+    BOOST_TEST(CheckSequence(graph.cbegin(), graph.cend(), &IsLayerOfType<armnn::InputLayer>,
+                             &IsLayerOfType<armnn::DequantizeLayer>, &IsLayerOfType<armnn::QuantizeLayer>,
+                             &IsLayerOfType<armnn::OutputLayer>));
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(OptimizeInverseQuantizations()));
+
+    // Check that both quantization layers are removed
+    BOOST_TEST(CheckSequence(graph.cbegin(), graph.cend(), &IsLayerOfType<armnn::InputLayer>,
+                             &IsLayerOfType<armnn::OutputLayer>));
+}
+
+BOOST_AUTO_TEST_CASE(OptimizeDequantizeQuantizeAsRequantizeTest)
+{
+    armnn::Graph graph;
+
+    const TensorInfo inputInfo({ 1, 4 }, DataType::QAsymmU8, 0.5f, 10);
+    const TensorInfo floatInfo({ 1, 4 }, DataType::Float32);
+    const TensorInfo outputInfo({ 1, 4 }, DataType::QAsymmS8, 0.25f, -3);
+
+    auto output = graph.AddLayer<armnn::OutputLayer>(0, "output");
+
+    graph.InsertNewLayer<armnn::InputLayer>(output->GetInputSlot(0), 0, "input")
+        ->GetOutputHandler().SetTensorInfo(inputInfo);
+    graph.InsertNewLayer<armnn::DequantizeLayer>(output->GetInputSlot(0), "dequantize")
+        ->GetOutputHandler().SetTensorInfo(floatInfo);
+    graph.InsertNewLayer<armnn::QuantizeLayer>(output->GetInputSlot(0), "quantize")
+        ->GetOutputHandler().SetTensorInfo(outputInfo);
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(OptimizeInverseQuantizations()));
+
+    auto checkRequantize = [&outputInfo](const armnn::Layer* const layer) -> bool
+    {
+        return IsLayerOfType<armnn::QuantizeLayer>(layer) &&
+               layer->GetNameStr() == "requantize-dequantize-quantize" &&
+               layer->GetInputSlot(0).GetConnectedOutputSlot()->GetTensorInfo().GetDataType() ==
+                   DataType::QAsymmU8 &&
+               layer->GetOutputSlot(0).GetTensorInfo() == outputInfo;
+    };
+
+    // Check that the pair is replaced by a single requantization
+    BOOST_TEST(CheckSequence(graph.cbegin(), graph.cend(), &IsLayerOfType<armnn::InputLayer>,
+                             checkRequantize, &IsLayerOfType<armnn::OutputLayer>));
+}
+
+BOOST_AUTO_TEST_CASE(FuseConsecutiveQuantizationsTest)
+{
+    armnn::Graph graph;
+
+    // Every value of the input is represented exactly by the intermediate tensor
+    const TensorInfo inputInfo({ 1, 4 }, DataType::QAsymmU8, 0.5f, 10);
+    const TensorInfo intermediateInfo({ 1, 4 }, DataType::QSymmS16, 0.25f, 0);
+    const TensorInfo outputInfo({ 1, 4 }, DataType::QAsymmS8, 1.0f, -5);
+
+    auto output = graph.AddLayer<armnn::OutputLayer>(0, "output");
+
+    graph.InsertNewLayer<armnn::InputLayer>(output->GetInputSlot(0), 0, "input")
+        ->GetOutputHandler().SetTensorInfo(inputInfo);
+    graph.InsertNewLayer<armnn::QuantizeLayer>(output->GetInputSlot(0), "quantize1")
+        ->GetOutputHandler().SetTensorInfo(intermediateInfo);
+    graph.InsertNewLayer<armnn::QuantizeLayer>(output->GetInputSlot(0), "quantize2")
+        ->GetOutputHandler().SetTensorInfo(outputInfo);
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FuseConsecutiveQuantizations()));
+
+    auto checkRequantize = [&outputInfo](const armnn::Layer* const layer) -> bool
+    {
+        return IsLayerOfType<armnn::QuantizeLayer>(layer) &&
+               layer->GetNameStr() == "requantize-quantize1-quantize2" &&
+               layer->GetOutputSlot(0).GetTensorInfo() == outputInfo;
+    };
+
+    BOOST_TEST(CheckSequence(graph.cbegin(), graph.cend(), &IsLayerOfType<armnn::InputLayer>,
+                             checkRequantize, &IsLayerOfType<armnn::OutputLayer>));
+}
+
+BOOST_AUTO_TEST_CASE(FuseConsecutiveQuantizationsLossyIntermediateTest)
+{
+    const TensorInfo inputInfo({ 1, 4 }, DataType::QAsymmU8, 0.5f, 10);
+
+    // The intermediate tensor clamps the input from 2 * (255 - 10) = 490, or rounds it to a coarser scale
+    for (const TensorInfo& intermediateInfo : { TensorInfo({ 1, 4 }, DataType::QAsymmS8, 0.25f, 0),
+                                                TensorInfo({ 1, 4 }, DataType::QSymmS16, 1.0f, 0) })
+    {
+        armnn::Graph graph;
+
+        auto output = graph.AddLayer<armnn::OutputLayer>(0, "output");
+
+        graph.InsertNewLayer<armnn::InputLayer>(output->GetInputSlot(0), 0, "input")
+            ->GetOutputHandler().SetTensorInfo(inputInfo);
+        graph.InsertNewLayer<armnn::QuantizeLayer>(output->GetInputSlot(0), "quantize1")
+            ->GetOutputHandler().SetTensorInfo(intermediateInfo);
+        graph.InsertNewLayer<armnn::QuantizeLayer>(output->GetInputSlot(0), "quantize2")
+            ->GetOutputHandler().SetTensorInfo(TensorInfo({ 1, 4 }, DataType::QSymmS16, 0.125f, 0));
+
+        armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FuseConsecutiveQuantizations()));
+
+        // Merging the requantizations would change the results, so both are kept
+        BOOST_TEST(CheckSequence(graph.cbegin(), graph.cend(), &IsLayerOfType<armnn::InputLayer>,
+                                 &IsLayerOfType<armnn::QuantizeLayer>, &IsLayerOfType<armnn::QuantizeLayer>,
+                                 &IsLayerOfType<armnn::OutputLayer>));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(FuseConsecutiveQuantizationsFromFloatTest)
+{
+    armnn::Graph graph;
+
+    auto output = graph.AddLayer<armnn::OutputLayer>(0, "output");
+
+    graph.InsertNewLayer<armnn::InputLayer>(output->GetInputSlot(0), 0, "input")
+        ->GetOutputHandler().SetTensorInfo(TensorInfo({ 1, 4 }, DataType::Float32));
+    graph.InsertNewLayer<armnn::QuantizeLayer>(output->GetInputSlot(0), "quantize1")
+        ->GetOutputHandler().SetTensorInfo(TensorInfo({ 1, 4 }, DataType::QAsymmU8, 0.5f, 10));
+    graph.InsertNewLayer<armnn::QuantizeLayer>(output->GetInputSlot(0), "quantize2")
+        ->GetOutputHandler().SetTensorInfo(TensorInfo({ 1, 4 }, DataType::QSymmS16, 0.125f, 0));
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FuseConsecutiveQuantizations()));
+
+    // The rounding to the intermediate type must be kept
+    BOOST_TEST(CheckSequence(graph.cbegin(), graph.cend(), &IsLayerOfType<armnn::InputLayer>,
+                             &IsLayerOfType<armnn::QuantizeLayer>, &IsLayerOfType<armnn::QuantizeLayer>,
+                             &IsLayerOfType<armnn::OutputLayer>));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
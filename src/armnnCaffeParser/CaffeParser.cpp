@@ -62,65 +62,6 @@ using namespace google::protobuf::io;
 namespace
 {
 
-const float* GetArrayPtrFromBlob(const LayerParameter& layerParam, unsigned int blobIndex)
-{
-    auto nBlobs = layerParam.blobs_size();
-    if (blobIndex >= boost::numeric_cast<unsigned int>(nBlobs))
-    {
-        throw ParseException(
-            boost::str(
-                boost::format(
-                    "Expected data blob at index %1% in layer %2% not found. nBlobs=%2%. %4%") %
-                    blobIndex %
-                    layerParam.name() %
-                    nBlobs %
-                    CHECK_LOCATION().AsString()));
-    }
-
-    const BlobProto& blob = layerParam.blobs(boost::numeric_cast<int>(blobIndex));
-
-    const float* arrayPtr = blob.data().data();
-    return arrayPtr;
-}
-
-void GetDataFromBlob(const LayerParameter& layerParam, vector<float>& outData, unsigned int blobIndex)
-{
-    auto nBlobs = layerParam.blobs_size();
-    if (blobIndex >= boost::numeric_cast<unsigned int>(nBlobs))
-    {
-        throw ParseException(
-            boost::str(
-                boost::format(
-                    "Expected data blob at index %1% in layer %2% not found. %3%") %
-                    blobIndex %
-                    layerParam.name() %
-                    CHECK_LOCATION().AsString()));
-    }
-
-    const BlobProto& blob = layerParam.blobs(boost::numeric_cast<int>(blobIndex));
-
-    size_t blobSize = boost::numeric_cast<size_t>(blob.data_size());
-    if (blobSize != outData.size())
-    {
-        throw ParseException(
-            boost::str(
-                boost::format(
-                    "Data blob at index %1% in layer %2% has an unexpected size. "
-                    "Expected %3% elements but got %4% elements. %5%") %
-                    blobIndex %
-                    layerParam.name() %
-                    outData.size() %
-                    blobSize %
-                    CHECK_LOCATION().AsString()));
-    }
-
-    int outSizeInt = boost::numeric_cast<int>(outData.size());
-    for (int i = 0; i < outSizeInt; ++i)
-    {
-        outData[static_cast<size_t>(i)] = blob.data(i);
-    }
-}
-
 template <typename T>
 size_t SizeOfVectorData(const vector<T>& vec)
 {
@@ -322,6 +263,57 @@ TensorInfo CaffeParserBase::BlobShapeToTensorInfo(const caffe::BlobShape& blobSh
     return TensorInfo(boost::numeric_cast<unsigned int>(shape.size()), shape.data(), DataType::Float32);
 }
 
+const float* CaffeParserBase::GetBlobData(const caffe::LayerParameter& layerParam,
+                                          unsigned int blobIndex,
+                                          size_t numElements)
+{
+    auto nBlobs = layerParam.blobs_size();
+    if (blobIndex >= boost::numeric_cast<unsigned int>(nBlobs))
+    {
+        throw ParseException(
+            boost::str(
+                boost::format(
+                    "Expected data blob at index %1% in layer %2% not found. nBlobs=%3%. %4%") %
+                    blobIndex %
+                    layerParam.name() %
+                    nBlobs %
+                    CHECK_LOCATION().AsString()));
+    }
+
+    const BlobProto& blob = layerParam.blobs(boost::numeric_cast<int>(blobIndex));
+    CheckBlobSize(layerParam, blobIndex, numElements, boost::numeric_cast<size_t>(blob.data_size()));
+
+    return blob.data().data();
+}
+
+void CaffeParserBase::CheckBlobSize(const caffe::LayerParameter& layerParam,
+                                    unsigned int blobIndex,
+                                    size_t expectedNumElements,
+                                    size_t numElements)
+{
+    if (numElements != expectedNumElements)
+    {
+        throw ParseException(
+            boost::str(
+                boost::format(
+                    "Data blob at index %1% in layer %2% has an unexpected size. "
+                    "Expected %3% elements but got %4% elements. %5%") %
+                    blobIndex %
+                    layerParam.name() %
+                    expectedNumElements %
+                    numElements %
+                    CHECK_LOCATION().AsString()));
+    }
+}
+
+void CaffeParserBase::GetDataFromBlob(const caffe::LayerParameter& layerParam,
+                                      vector<float>& outData,
+                                      unsigned int blobIndex)
+{
+    const float* blobData = GetBlobData(layerParam, blobIndex, outData.size());
+    std::copy(blobData, blobData + outData.size(), outData.begin());
+}
+
 BlobShape TensorDescToBlobShape(const TensorInfo& desc)
 {
     BlobShape ret;
@@ -502,13 +494,13 @@ void CaffeParserBase::AddConvLayerWithSplits(const caffe::LayerParameter& layerP
                 static_cast<float>(inputShape.dim(3) + 2 * desc.m_PadRight - kernelW) /
                 static_cast<float>(desc.m_StrideX)) + 1));
 
-    // Load the weight data for ALL groups
-    vector<float> weightData(boost::numeric_cast<size_t>(numGroups *
-                                                         inputShape.dim(1) *  // number of input channels
-                                                         outputShape.dim(1) * // number of output channels
-                                                         kernelH *
-                                                         kernelW));
-    GetDataFromBlob(layerParam, weightData, 0);
+    // Get the weight data for ALL groups
+    const size_t numWeights = boost::numeric_cast<size_t>(numGroups *
+                                                          inputShape.dim(1) *  // number of input channels
+                                                          outputShape.dim(1) * // number of output channels
+                                                          kernelH *
+                                                          kernelW);
+    const float* weightData = GetBlobData(layerParam, 0, numWeights);
 
     const unsigned int weightDimSizes[4] = {
         static_cast<unsigned int>(outputShape.dim(1)),
@@ -517,19 +509,20 @@ void CaffeParserBase::AddConvLayerWithSplits(const caffe::LayerParameter& layerP
         kernelW};
 
     TensorInfo biasInfo;
-    vector<float> biasData;
+    const float* biasData = nullptr;
+    size_t numBiases = 0;
 
     if (desc.m_BiasEnabled)
     {
-        biasData.resize(boost::numeric_cast<size_t>(numGroups * outputShape.dim(1)), 1.f);
-        GetDataFromBlob(layerParam, biasData, 1);
+        numBiases = boost::numeric_cast<size_t>(numGroups * outputShape.dim(1));
+        biasData = GetBlobData(layerParam, 1, numBiases);
 
         const unsigned int biasDimSizes[1] = {static_cast<unsigned int>(outputShape.dim(1))};
         biasInfo = TensorInfo(1, biasDimSizes, DataType::Float32);
     }
 
-    const unsigned int numWeightsPerGroup = boost::numeric_cast<unsigned int>(weightData.size()) / numGroups;
-    const unsigned int numBiasesPerGroup  = boost::numeric_cast<unsigned int>(biasData.size()) / numGroups;
+    const unsigned int numWeightsPerGroup = boost::numeric_cast<unsigned int>(numWeights) / numGroups;
+    const unsigned int numBiasesPerGroup  = boost::numeric_cast<unsigned int>(numBiases) / numGroups;
 
     for (unsigned int g = 0; g < numGroups; ++g)
     {
@@ -538,14 +531,14 @@ void CaffeParserBase::AddConvLayerWithSplits(const caffe::LayerParameter& layerP
 
         // Pulls out the weights for this group from that loaded from the model file earlier.
         ConstTensor weights(TensorInfo(4, weightDimSizes, DataType::Float32),
-                            weightData.data() + numWeightsPerGroup * g);
+                            weightData + numWeightsPerGroup * g);
 
         IConnectableLayer* convLayer = nullptr;
         Optional<ConstTensor> optionalBiases;
         if (desc.m_BiasEnabled)
         {
             // Pulls out the biases for this group from that loaded from the model file earlier.
-            ConstTensor biases(biasInfo, biasData.data() + numBiasesPerGroup * g);
+            ConstTensor biases(biasInfo, biasData + numBiasesPerGroup * g);
             optionalBiases = Optional<ConstTensor>(biases);
         }
         convLayer = m_Network->AddConvolution2dLayer(desc,
@@ -646,11 +639,9 @@ void CaffeParserBase::AddConvLayerWithDepthwiseConv(const caffe::LayerParameter&
                 static_cast<float>(inputShape.dim(3) + 2 * desc.m_PadRight - kernelW) /
                 static_cast<float>(desc.m_StrideX)) + 1));
 
-    // Load the weight data
+    // Get the weight data
     size_t allWeightsSize = boost::numeric_cast<size_t>(inputShape.dim(1) * kernelH * kernelW);
-    vector<float> weightData(allWeightsSize);
-
-    GetDataFromBlob(layerParam, weightData, 0);
+    const float* weightData = GetBlobData(layerParam, 0, allWeightsSize);
 
     // depth multiplier will be 1 for the depthwise convolution
     const unsigned int weightDimSizes[4] = {
@@ -660,20 +651,18 @@ void CaffeParserBase::AddConvLayerWithDepthwiseConv(const caffe::LayerParameter&
         kernelW};
 
     armnn::IConnectableLayer* returnLayer = nullptr;
-    ConstTensor weights(TensorInfo(4, weightDimSizes, DataType::Float32), weightData.data());
+    ConstTensor weights(TensorInfo(4, weightDimSizes, DataType::Float32), weightData);
     Optional<ConstTensor> optionalBiases;
-    vector<float> biasData;
     if (desc.m_BiasEnabled)
     {
         TensorInfo biasInfo;
 
-        biasData.resize(boost::numeric_cast<size_t>(outputShape.dim(1)), 1.f);
-        GetDataFromBlob(layerParam, biasData, 1);
+        const float* biasData = GetBlobData(layerParam, 1, boost::numeric_cast<size_t>(outputShape.dim(1)));
 
         const unsigned int biasDimSizes[1] = {static_cast<unsigned int>(outputShape.dim(1))};
         biasInfo = TensorInfo(1, biasDimSizes, DataType::Float32);
 
-        ConstTensor biases(biasInfo, biasData.data());
+        ConstTensor biases(biasInfo, biasData);
         optionalBiases = Optional<ConstTensor>(biases);
     }
     returnLayer = m_Network->AddDepthwiseConvolution2dLayer(desc,
@@ -822,12 +811,11 @@ void CaffeParserBase::ParseConvLayer(const LayerParameter& layerParam)
                 static_cast<float>(inputShape.dim(3) + 2 * padW - kernelW) /
                 static_cast<float>(strideW)) + 1));
 
-    // Load the weight data for ALL groups
-    vector<float> weightData(boost::numeric_cast<size_t>(inputShape.dim(1) *
-                                                         outputShape.dim(1) *
-                                                         kernelH *
-                                                         kernelW));
-    GetDataFromBlob(layerParam, weightData, 0);
+    // Get the weight data for ALL groups
+    const float* weightData = GetBlobData(layerParam, 0, boost::numeric_cast<size_t>(inputShape.dim(1) *
+                                                                                      outputShape.dim(1) *
+                                                                                      kernelH *
+                                                                                      kernelW));
 
     const unsigned int weightDimSizes[4] = {
         static_cast<unsigned int>(outputShape.dim(1)), // output channels
@@ -838,21 +826,19 @@ void CaffeParserBase::ParseConvLayer(const LayerParameter& layerParam)
     armnn::IConnectableLayer* returnLayer = nullptr;
 
     // Pull out the weights for this group from that loaded from the model file earlier
-    ConstTensor weights(TensorInfo(4, weightDimSizes, DataType::Float32), weightData.data());
+    ConstTensor weights(TensorInfo(4, weightDimSizes, DataType::Float32), weightData);
     Optional<ConstTensor> optionalBiases;
-    vector<float> biasData;
     if (convolution2dDescriptor.m_BiasEnabled)
     {
         TensorInfo biasInfo;
 
-        biasData.resize(boost::numeric_cast<size_t>(outputShape.dim(1)), 1.f);
-        GetDataFromBlob(layerParam, biasData, 1);
+        const float* biasData = GetBlobData(layerParam, 1, boost::numeric_cast<size_t>(outputShape.dim(1)));
 
         const unsigned int biasDimSizes[1] = {static_cast<unsigned int>(outputShape.dim(1))};
         biasInfo = TensorInfo(1, biasDimSizes, DataType::Float32);
 
         // Pull out the biases for this group from that loaded from the model file earlier
-        ConstTensor biases(biasInfo, biasData.data());
+        ConstTensor biases(biasInfo, biasData);
         optionalBiases = Optional<ConstTensor>(biases);
     }
     returnLayer = m_Network->AddConvolution2dLayer(convolution2dDescriptor,
@@ -1170,7 +1156,7 @@ void CaffeParserBase::ParseInnerProductLayer(const LayerParameter& layerParam)
         inputSize *= inputInfo.GetShape()[i];
     }
 
-    const float* weightDataPtr = GetArrayPtrFromBlob(layerParam, 0);
+    const float* weightDataPtr = GetBlobData(layerParam, 0, outputSize * inputSize);
     const unsigned int swTD[2] = { outputSize, inputSize };
     ConstTensor weights(TensorInfo(2, swTD, DataType::Float32), weightDataPtr);
 
@@ -1180,7 +1166,7 @@ void CaffeParserBase::ParseInnerProductLayer(const LayerParameter& layerParam)
     if (tensorFullyConnectedDescriptor.m_BiasEnabled)
     {
         // BIAS VALUE
-        const float* biasDataPtr = GetArrayPtrFromBlob(layerParam, 1);
+        const float* biasDataPtr = GetBlobData(layerParam, 1, outputSize);
 
         const unsigned int sbTD[1] = { outputSize };
 
@@ -1374,8 +1360,7 @@ void CaffeParserBase::ParseBatchNormLayer(const LayerParameter& layerParam)
     GetDataFromBlob(layerParam, varianceData, 1);
 
     // Reads moving average factor and applies scaling (if required).
-    const BlobProto& blob = layerParam.blobs(boost::numeric_cast<int>(2));
-    const float movingAverageFactor = blob.data(boost::numeric_cast<int>(0));
+    const float movingAverageFactor = *GetBlobData(layerParam, 2, 1);
     if(movingAverageFactor != 0.0f)
     {
         const float scaleFactor = 1.0f / movingAverageFactor;
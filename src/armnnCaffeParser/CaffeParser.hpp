@@ -84,6 +84,22 @@ protected:
     /// Converts Caffe's protobuf tensor shape format to ArmNN's
     armnn::TensorInfo BlobShapeToTensorInfo(const caffe::BlobShape& blobShape) const;
 
+    /// Returns the data of the blob at blobIndex in the layer, which must hold numElements values.
+    /// Layers are added to m_Network from this data directly, so the network makes the only copy of it.
+    /// Parsers which keep the blob data out of the LayerParameter override this to return it from where it is.
+    virtual const float* GetBlobData(const caffe::LayerParameter& layerParam,
+                                     unsigned int blobIndex,
+                                     size_t numElements);
+
+    /// Throws if a blob does not have the expected number of elements.
+    static void CheckBlobSize(const caffe::LayerParameter& layerParam,
+                              unsigned int blobIndex,
+                              size_t expectedNumElements,
+                              size_t numElements);
+
+    /// Copies the data of the blob at blobIndex in the layer, for layers which modify it before adding it.
+    void GetDataFromBlob(const caffe::LayerParameter& layerParam, std::vector<float>& outData, unsigned int blobIndex);
+
     void TrackInputBinding(armnn::IConnectableLayer* layer,
                            armnn::LayerBindingId id,
                            const armnn::TensorInfo& tensorInfo);
@@ -10,27 +10,27 @@
 
 
 #include "GraphTopologicalSort.hpp"
+#include "MemoryMappedFile.hpp"
+#include "Network.hpp"
 
 #include <boost/numeric/conversion/cast.hpp>
+#include <boost/polymorphic_cast.hpp>
 
-// Caffe
-#include <google/protobuf/wire_format.h>
+// ProtoBuf
+#include <google/protobuf/io/coded_stream.h>
 
-
-//#include <stdio.h>
 #include <limits.h>
+#include <cstring>
 #include <sstream>
-//#include <iostream>
-#include <fstream>
 
 namespace armnnCaffeParser
 {
-// class which holds information on the absolute position in the stream
+// class which holds information on the absolute position in the file
 // of the data and the length of the data record.
 class VarLenDataInfo
 {
 public:
-    VarLenDataInfo(std::streamoff positionOfData, size_t sizeOfData) :
+    VarLenDataInfo(size_t positionOfData, size_t sizeOfData) :
         m_PositionOfData(positionOfData), m_SizeOfData(sizeOfData) {}
 
     VarLenDataInfo(const VarLenDataInfo& x) :
@@ -45,11 +45,11 @@ public:
         m_PositionOfData = x.PositionOfData(); m_SizeOfData = x.SizeOfData(); return *this;
     }
 
-    std::streamoff PositionOfData() const {return m_PositionOfData;}
+    size_t PositionOfData() const {return m_PositionOfData;}
     size_t SizeOfData() const {return m_SizeOfData;}
 
 private:
-    std::streamoff m_PositionOfData;
+    size_t m_PositionOfData;
     size_t m_SizeOfData;
 
 };
@@ -67,7 +67,7 @@ public:
         VarLenDataInfo(varLenDataInfo.PositionOfData(), varLenDataInfo.SizeOfData()),
         m_newTops(false), m_newBottoms(false) {}
 
-    LayerParameterInfo(std::streamoff positionOfData, size_t sizeOfData) :
+    LayerParameterInfo(size_t positionOfData, size_t sizeOfData) :
         VarLenDataInfo(positionOfData, sizeOfData), m_newTops(false), m_newBottoms(false) {}
 
     LayerParameterInfo(const LayerParameterInfo& x) :
@@ -95,24 +95,11 @@ public:
     }
 
     const std::string name() const {return m_name;}
-    void set_name(const std::unique_ptr<char[]>& theName, size_t length)
-    {
-        m_name = std::string(theName.get(), length);
-    }
     void set_name(const std::string& theName) {m_name = theName;}
 
     const std::string type() const {return m_type;}
-    void set_type(const std::unique_ptr<char[]>& theType, size_t length)
-    {
-        m_type = std::string(theType.get(), length);
-    }
     void set_type(const std::string& theType) {m_type = theType;}
 
-    void add_top(const std::unique_ptr<char[]>& top, size_t length)
-    {
-        std::string topName(top.get(), length);
-        m_tops.push_back(topName);
-    }
     void add_top(const std::string& topName)
     {
         m_tops.push_back(topName);
@@ -122,9 +109,8 @@ public:
     void set_top(unsigned long i, const std::string& newName) {m_tops[i] = newName; m_newTops = true;}
     bool new_tops() const {return m_newTops;}
 
-    void add_bottom(const std::unique_ptr<char[]>& bottom, size_t length)
+    void add_bottom(const std::string& bottomName)
     {
-        std::string bottomName(bottom.get(), length);
         m_bottoms.push_back(bottomName);
     }
     unsigned long bottom_size() const {return m_bottoms.size();}
@@ -160,19 +146,131 @@ class ProtobufFieldInfo
 {
 public:
     ProtobufFieldInfo(int field_type, int field_id) :
-        m_eof(false), m_field_type(field_type), m_field_id(field_id) {}
-    ProtobufFieldInfo() : m_eof(true), m_field_type(0), m_field_id(0) {}
+        m_field_type(field_type), m_field_id(field_id) {}
 
-    bool eof() {return m_eof;}
-    int field_type() {return m_field_type;}
-    int field_id() {return m_field_id;}
+    int field_type() const {return m_field_type;}
+    int field_id() const {return m_field_id;}
 
 private:
-    bool m_eof;
     int m_field_type;
     int m_field_id;
 };
 
+// class which decodes protobuf messages, as per the binary encoding described in
+// https://developers.google.com/protocol-buffers/docs/encoding
+// from the part [position, end) of data held in memory, i.e. the memory mapped model file.
+class ProtobufReader
+{
+public:
+    ProtobufReader(const uint8_t* data, size_t position, size_t end) :
+        m_Data(data), m_Position(position), m_End(end) {}
+
+    ProtobufReader(const uint8_t* data, const VarLenDataInfo& dataInfo) :
+        ProtobufReader(data, dataInfo.PositionOfData(), dataInfo.PositionOfData() + dataInfo.SizeOfData()) {}
+
+    bool AtEnd() const {return m_Position >= m_End;}
+    size_t Position() const {return m_Position;}
+
+    ProtobufFieldInfo ReadFieldInfo()
+    {
+        // the key of a field is a varint holding the field id and its wire type in the lowest three bits
+        uint64_t key = ReadVarint();
+        if ((key >> 3) > INT_MAX)
+        {
+            throw armnn::ParseException("Encountered a field id which is out of range");
+        }
+        return ProtobufFieldInfo(static_cast<int>(key & 7), static_cast<int>(key >> 3));
+    }
+
+    uint64_t ReadVarint()
+    {
+        uint64_t result = 0;
+        for (unsigned int shift_by = 0; shift_by < 64; shift_by += 7)
+        {
+            uint8_t a_byte = ReadByte();
+            result |= static_cast<uint64_t>(a_byte & 127) << shift_by;
+            if ((a_byte & 128) != 128)
+            {
+                return result;
+            }
+        }
+        throw armnn::ParseException("ReadVarint exceeded the maximum number of bytes expected for an integer");
+    }
+
+    // reads the size of a length delimited field and skips over its data, returning where the data is
+    VarLenDataInfo ReadLengthDelimited()
+    {
+        uint64_t size = ReadVarint();
+        size_t positionOfData = m_Position;
+        Advance(size);
+        return VarLenDataInfo(positionOfData, static_cast<size_t>(size));
+    }
+
+    std::string ReadString()
+    {
+        VarLenDataInfo dataInfo = ReadLengthDelimited();
+        return std::string(reinterpret_cast<const char*>(m_Data + dataInfo.PositionOfData()), dataInfo.SizeOfData());
+    }
+
+    void SkipField(const ProtobufFieldInfo& fieldInfo)
+    {
+        switch (fieldInfo.field_type())
+        {
+            case 0:
+            {
+                ReadVarint();
+                break;
+            }
+            case 1:
+            {
+                // 64 bit
+                Advance(8);
+                break;
+            }
+            case 2:
+            {
+                ReadLengthDelimited();
+                break;
+            }
+            case 5:
+            {
+                // 32 bit
+                Advance(4);
+                break;
+            }
+            default:
+            {
+                throw armnn::ParseException("Encountered an unknown field type");
+            }
+        }
+    }
+
+private:
+    uint8_t ReadByte()
+    {
+        if (m_Position >= m_End)
+        {
+            throw armnn::ParseException("Unexpected end of data in binary caffe file");
+        }
+        return m_Data[m_Position++];
+    }
+
+    void Advance(uint64_t numBytes)
+    {
+        if (numBytes > m_End - m_Position)
+        {
+            std::stringstream ss;
+            ss << "failed to skip " << numBytes << " bytes at position " << m_Position << " in binary caffe file";
+            throw armnn::ParseException(ss.str());
+        }
+        m_Position += static_cast<size_t>(numBytes);
+    }
+
+    const uint8_t* m_Data;
+    size_t m_Position;
+    size_t m_End;
+};
+
 
 // There are some NetParameter level data which are required
 // to correctly processes some Caffe models. Specifically those which
@@ -183,14 +281,10 @@ class NetParameterInfo
 {
 public:
     const std::string name() const {return m_name;}
-    void set_name(const std::unique_ptr<char[]>&  theName, size_t length)
-    {
-        m_name = std::string(theName.get(), length);
-    }
+    void set_name(const std::string& theName) {m_name = theName;}
 
-    void add_input(const std::unique_ptr<char[]>&  input, size_t length)
+    void add_input(const std::string& inputName)
     {
-        std::string inputName(input.get(), length);
         m_inputs.push_back(inputName);
     }
     const std::string input(unsigned long i) const {return m_inputs[i];}
@@ -226,193 +320,65 @@ const std::string LayerParameterInfo::INPUT = "Input";
 namespace
 {
 
-ProtobufFieldInfo readFieldInfo(std::ifstream& ifs)
+void ReadTopologicalInfoForLayerParameter(LayerParameterInfo& layerInfo, const uint8_t* data)
 {
-    unsigned char first_byte = static_cast<unsigned char>(ifs.get());
-    if (!ifs.good())
-    {
-        ProtobufFieldInfo eof;
-        return eof;
-    }
-    int field_type = first_byte&7;
-    int field_id = first_byte>>3;
-    if ((field_id & 16) == 16)
+    ProtobufReader reader(data, layerInfo);
+    while (!reader.AtEnd())
     {
-        unsigned char second_byte = static_cast<unsigned char>(ifs.get());
-        if (!ifs.good())
+        // read the information for the next field.
+        ProtobufFieldInfo fieldInfo = reader.ReadFieldInfo();
+        //optional string name = 1; // the layer name
+        //optional string type = 2; // the layer type
+        //repeated string bottom = 3; // the name of each bottom blob
+        //repeated string top = 4; // the name of each top blob
+        if (fieldInfo.field_type() != 2 || fieldInfo.field_id() > 4)
         {
-            ProtobufFieldInfo eof;
-            return eof;
+            reader.SkipField(fieldInfo);
         }
-        field_id = (field_id-16) + ((second_byte&127)<<4);
-    }
-    ProtobufFieldInfo fieldInfo(field_type, field_id);
-    return fieldInfo;
-}
-
-const static int MAX_NUM_BYTES = 5;
-
-int ReadBase128(std::ifstream& ifs)
-{
-    int result = 0;
-    unsigned int shift_by = 0;
-    int bytesRead = 0;
-    while (true)
-    {
-        unsigned char a_byte = static_cast<unsigned char>(ifs.get());
-        ++bytesRead;
-        if (bytesRead > MAX_NUM_BYTES)
+        else if (fieldInfo.field_id() == 1)
         {
-            throw armnn::ParseException(
-                "ReadBase128 exceeded the maximum number of bytes expected for an integer representation");
+            layerInfo.set_name(reader.ReadString());
+        }
+        else if (fieldInfo.field_id() == 2)
+        {
+            layerInfo.set_type(reader.ReadString());
+        }
+        else if (fieldInfo.field_id() == 3)
+        {
+            layerInfo.add_bottom(reader.ReadString());
         }
-        result += (a_byte & 127) << shift_by;
-        shift_by += 7;
-        if ((a_byte & 128) != 128)
+        else if (fieldInfo.field_id() == 4)
+        {
+            layerInfo.add_top(reader.ReadString());
+        }
+        else
         {
-            break;
+            reader.SkipField(fieldInfo);
         }
     }
-    return result;
 }
 
-
-std::unique_ptr<char[]> AllocateBuffer(std::ifstream& ifs, VarLenDataInfo& dataInfo)
+// parses the encoding of some of the fields of a message into it, keeping the fields it already has.
+void MergeFieldsFromArray(google::protobuf::MessageLite& message, const uint8_t* data, size_t size)
 {
-    std::unique_ptr<char[]> ptr(new char[dataInfo.SizeOfData()]);
-    ifs.clear();
-    ifs.seekg(dataInfo.PositionOfData(), std::ios_base::beg);
-    ifs.read(ptr.get(), boost::numeric_cast<std::streamsize>(dataInfo.SizeOfData()));
-    return ptr;
-}
-
-VarLenDataInfo CreateVarLenDataInfo(std::streamoff bufferStart, std::streamoff endOfLayer) {
-    std::streamoff sizeOfLayer = endOfLayer - bufferStart;
-    if (sizeOfLayer < 0)
-    {
-        std::stringstream ss;
-        ss << "error when determining buffer size, negative value [" << sizeOfLayer << "]";
-        throw armnn::ParseException(ss.str());
-    }
-    // NOTE: as some of the data being read in will be translated into strings (names of layers etc)
-    //       the maximum size we can deal with is the upper size limit of a string i.e. size_t
-    // on the platform in which I am currently compiling std::streamoff is signed long int and
-    // size_t is unsigned long int so there is no way this error condition can fire but this stuff
-    // is supposed to be portable so the check remains in place
-    if (boost::numeric_cast<size_t>(sizeOfLayer) > SIZE_MAX) {
-        std::stringstream ss;
-        ss << "layer is greater than " << SIZE_MAX << " in size cannot process. layer size = [" << sizeOfLayer << "]";
-        throw armnn::ParseException(ss.str());
-    }
-    LayerParameterInfo info(bufferStart, boost::numeric_cast<size_t>(sizeOfLayer));
-    return info;
+    if (size == 0)
+    {
+        return;
+    }
+    google::protobuf::io::CodedInputStream input(data, boost::numeric_cast<int>(size));
+    input.SetTotalBytesLimit(INT_MAX, INT_MAX);
+    if (!message.MergePartialFromCodedStream(&input))
+    {
+        throw armnn::ParseException("Failed to parse " + message.GetTypeName() + " from binary caffe file");
+    }
 }
 
-void ReadTopologicalInfoForLayerParameter(LayerParameterInfo& layerInfo, std::ifstream& ifs)
+bool IsLittleEndian()
 {
-    // position the file pointer to the start of the layer data
-    ifs.clear();
-    ifs.seekg(layerInfo.PositionOfData(), std::ios_base::beg);
-    std::streamoff endOfLayer = layerInfo.PositionOfData() +
-        boost::numeric_cast<std::streamoff>(layerInfo.SizeOfData());
-    while(true)
-    {
-        // check to see if we have reached the end of the record
-        std::streamoff currentPosition = ifs.tellg();
-        if (currentPosition >= endOfLayer) {
-            return;
-        }
-        // read the information for the next field.
-        ProtobufFieldInfo fieldInfo = readFieldInfo(ifs);
-        if (fieldInfo.eof())
-        {
-            return;
-            // TODO: figure out whether this is an error condition or not...
-            //throw armnn::ParseException("failed to read field from LayerParameter data");
-        }
-        // process the field
-        switch (fieldInfo.field_type())
-        {
-            case 0:
-            {
-                ReadBase128(ifs);
-                break;
-            }
-            case 2:
-            {
-                int size = ReadBase128(ifs);
-                std::streamoff posStartOfData = ifs.tellg();
-                VarLenDataInfo dataInfo(posStartOfData, boost::numeric_cast<size_t>(size));
-                //optional string name = 1; // the layer name
-                //optional string type = 2; // the layer type
-                //repeated string bottom = 3; // the name of each bottom blob
-                //repeated string top = 4; // the name of each top blob
-                if (fieldInfo.field_id() == 1)
-                {
-                    // read and set the name of the layer
-                    auto layerName = AllocateBuffer(ifs, dataInfo);
-                    layerInfo.set_name(layerName, dataInfo.SizeOfData());
-                }
-                else if (fieldInfo.field_id() == 2)
-                {
-                    // read and set the type of the layer
-                    auto layerType = AllocateBuffer(ifs, dataInfo);
-                    layerInfo.set_type(layerType, dataInfo.SizeOfData());
-                }
-                else if (fieldInfo.field_id() == 3)
-                {
-                    // read and add a bottom to the layer
-                    auto bottom = AllocateBuffer(ifs, dataInfo);
-                    layerInfo.add_bottom(bottom, dataInfo.SizeOfData());
-                }
-                else if (fieldInfo.field_id() == 4)
-                {
-                    // read and add a top to the layer
-                    auto top = AllocateBuffer(ifs, dataInfo);
-                    layerInfo.add_top(top, dataInfo.SizeOfData());
-                }
-                else
-                {
-                    ifs.seekg(size, std::ios_base::cur);
-                    if (!ifs.good())
-                    {
-                        // TODO: error out?
-                        return;
-                    }
-                }
-                break;
-            }
-            case 1:
-            {
-                // 64 bit
-                // advance by eight bytes
-                ifs.seekg(8, std::ios_base::cur);
-                if (!ifs.good())
-                {
-                    // TODO: error out?
-                    return;
-                }
-                break;
-            }
-            case 5:
-            {
-                // 32 bit
-                // advance by four bytes
-                ifs.seekg(4, std::ios_base::cur);
-                if (!ifs.good())
-                {
-                    // TODO: error out?
-                    return;
-                }
-                break;
-            }
-            default:
-            {
-                throw armnn::ParseException("Encounted an unknown field type");
-                break;
-            }
-        }
-    }
+    const uint16_t one = 1;
+    uint8_t firstByte;
+    std::memcpy(&firstByte, &one, 1);
+    return firstByte == 1;
 }
 
 void ResolveInPlaceLayers(std::vector<LayerParameterInfo>& layerInfo)
@@ -458,7 +424,9 @@ void ResolveInPlaceLayers(std::vector<LayerParameterInfo>& layerInfo)
 
 } // anonymous namespace, can't be seen outside this source file
 
-RecordByRecordCaffeParser::RecordByRecordCaffeParser() : CaffeParserBase()
+RecordByRecordCaffeParser::RecordByRecordCaffeParser()
+    : CaffeParserBase()
+    , m_NetworkReferencesFile(false)
 {}
 
 armnn::INetworkPtr RecordByRecordCaffeParser::CreateNetworkFromBinaryFile(
@@ -474,104 +442,86 @@ armnn::INetworkPtr RecordByRecordCaffeParser::CreateNetworkFromBinaryFile(
     }
     m_RequestedOutputs = requestedOutputs;
 
-    std::ifstream ifs(graphFile, std::ifstream::in|std::ifstream::binary);
-    if (ifs.fail())
-    {
-        throw armnn::FileNotFoundException("Failed to open graph file '" + std::string(graphFile) + "'");
-    }
+    m_File = std::make_shared<const armnnUtils::MemoryMappedFile>(graphFile);
+    const uint8_t* data = m_File->GetData();
 
     std::vector<LayerParameterInfo> layerInfo;
     NetParameterInfo netParameterInfo;
-    while(true)
+    ProtobufReader reader(data, 0, m_File->GetSize());
+    while (!reader.AtEnd())
     {
-        ProtobufFieldInfo fieldInfo = readFieldInfo(ifs);
-        if (fieldInfo.eof())
+        ProtobufFieldInfo fieldInfo = reader.ReadFieldInfo();
+
+        // The values of interest from the caffe.proto schema are:
+        // optional string name = 1; // consider giving the network a name
+        // DEPRECATED. See InputParameter. The input blobs to the network.
+        // repeated string input = 3;
+        // DEPRECATED. See InputParameter. The shape of the input blobs.
+        // repeated BlobShape input_shape = 8;
+
+        // 4D input dimensions -- deprecated.  Use "input_shape" instead.
+        // If specified, for each input blob there should be four
+        // values specifying the num, channels, height and width of the input blob.
+        // Thus, there should be a total of (4 * #input) numbers.
+        // repeated int32 input_dim = 4;
+
+        // The layers that make up the net.  Each of their configurations, including
+        // connectivity and behavior, is specified as a LayerParameter.
+        // repeated LayerParameter layer = 100;  // ID 100 so layers are printed last.
+
+        // The first four will (if present) be read into the NetParameterInfo
+        // the LayerParameters will be read into the LayerParameterInfo vector.
+        if (fieldInfo.field_type() == 0 && fieldInfo.field_id() == 4)
         {
-            break;
+            netParameterInfo.add_input_dimension(static_cast<int>(reader.ReadVarint()));
         }
-        switch(fieldInfo.field_type())
+        else if (fieldInfo.field_type() != 2)
         {
-            case 0:
+            reader.SkipField(fieldInfo);
+        }
+        else if (fieldInfo.field_id() == 1)
+        {
+            netParameterInfo.set_name(reader.ReadString());
+        }
+        else if (fieldInfo.field_id() == 3)
+        {
+            netParameterInfo.add_input(reader.ReadString());
+        }
+        else if (fieldInfo.field_id() == 4)
+        {
+            // packed input dimensions
+            ProtobufReader dimensionsReader(data, reader.ReadLengthDelimited());
+            while (!dimensionsReader.AtEnd())
             {
-                ReadBase128(ifs);
-                break;
+                netParameterInfo.add_input_dimension(static_cast<int>(dimensionsReader.ReadVarint()));
             }
-            case 2:
+        }
+        else if (fieldInfo.field_id() == 8)
+        {
+            VarLenDataInfo dataInfo = reader.ReadLengthDelimited();
+            caffe::BlobShape blobShape;
+            bool bRet = blobShape.ParseFromArray(data + dataInfo.PositionOfData(),
+                                                 boost::numeric_cast<int>(dataInfo.SizeOfData()));
+            if (!bRet)
             {
-                // The values of interest from the caffe.proto schema are:
-                // optional string name = 1; // consider giving the network a name
-                // DEPRECATED. See InputParameter. The input blobs to the network.
-                // repeated string input = 3;
-                // DEPRECATED. See InputParameter. The shape of the input blobs.
-                // repeated BlobShape input_shape = 8;
-
-                // 4D input dimensions -- deprecated.  Use "input_shape" instead.
-                // If specified, for each input blob there should be four
-                // values specifying the num, channels, height and width of the input blob.
-                // Thus, there should be a total of (4 * #input) numbers.
-                // repeated int32 input_dim = 4;
-
-                // The layers that make up the net.  Each of their configurations, including
-                // connectivity and behavior, is specified as a LayerParameter.
-                // repeated LayerParameter layer = 100;  // ID 100 so layers are printed last.
-
-                // The first four will (if present) be read into the NetParameterInfo
-                // the LayerParameters will be read into the LayerParameterInfo vector.
-
-                int size = ReadBase128(ifs);
-                std::streamoff posStartOfData = ifs.tellg();
-                ifs.seekg(size, std::ios_base::cur);
-                if(!ifs.good())
-                {
-                    throw armnn::ParseException("failed to seek ahead in binary caffe file");
-                }
-                std::streamoff endOfLayer = ifs.tellg();
-                if (fieldInfo.field_id() == 1)
-                {
-                    VarLenDataInfo dataInfo = CreateVarLenDataInfo(posStartOfData, endOfLayer);
-                    auto graphName = AllocateBuffer(ifs, dataInfo);
-                    netParameterInfo.set_name(graphName, dataInfo.SizeOfData());
-                }
-                if (fieldInfo.field_id() == 3)
-                {
-                    VarLenDataInfo dataInfo = CreateVarLenDataInfo(posStartOfData, endOfLayer);
-                    auto inputName = AllocateBuffer(ifs, dataInfo);
-                    netParameterInfo.add_input(inputName, dataInfo.SizeOfData());
-                }
-                if (fieldInfo.field_id() == 8)
-                {
-                    VarLenDataInfo dataInfo = CreateVarLenDataInfo(posStartOfData, endOfLayer);
-                    auto inputShape = AllocateBuffer(ifs, dataInfo);
-                    caffe::BlobShape blobShape;
-                    bool bRet = blobShape.ParseFromArray(inputShape.get(), static_cast<int>(dataInfo.SizeOfData()));
-                    if (!bRet)
-                    {
-                        throw armnn::ParseException("Failed to parse input shape");
-                    }
-                    netParameterInfo.add_blob_shape(blobShape);
-                }
-                if (fieldInfo.field_id() == 4)
-                {
-                    int input_dim = ReadBase128(ifs);
-                    netParameterInfo.add_input_dimension(input_dim);
-                }
-                if (fieldInfo.field_id() == 100)
-                {
-                    LayerParameterInfo info(CreateVarLenDataInfo(posStartOfData, endOfLayer));
-                    ReadTopologicalInfoForLayerParameter(info, ifs);
-                    layerInfo.push_back(info);
-                }
-                break;
-            }
-            default:
-            {
-                break;
+                throw armnn::ParseException("Failed to parse input shape");
             }
+            netParameterInfo.add_blob_shape(blobShape);
+        }
+        else if (fieldInfo.field_id() == 100)
+        {
+            LayerParameterInfo info(reader.ReadLengthDelimited());
+            ReadTopologicalInfoForLayerParameter(info, data);
+            layerInfo.push_back(info);
+        }
+        else
+        {
+            reader.SkipField(fieldInfo);
         }
     }
     std::vector<const LayerParameterInfo*> sortedNodes;
     ProcessLayers(netParameterInfo, layerInfo, m_RequestedOutputs, sortedNodes);
-    armnn::INetworkPtr networkPtr = LoadLayers(ifs, sortedNodes, netParameterInfo);
+    armnn::INetworkPtr networkPtr = LoadLayers(sortedNodes, netParameterInfo);
     return networkPtr;
 
 }
@@ -649,8 +599,7 @@ std::vector<const LayerParameterInfo*> RecordByRecordCaffeParser::GetInputs(
     return ret;
 }
 
-armnn::INetworkPtr RecordByRecordCaffeParser::LoadLayers(std::ifstream& ifs,
-                                                         std::vector<const LayerParameterInfo *>& sortedNodes,
+armnn::INetworkPtr RecordByRecordCaffeParser::LoadLayers(std::vector<const LayerParameterInfo *>& sortedNodes,
                                                          const NetParameterInfo& netParameterInfo)
 {
 
@@ -658,6 +607,7 @@ armnn::INetworkPtr RecordByRecordCaffeParser::LoadLayers(std::ifstream& ifs,
     m_NetworkOutputsBindingInfo.clear();
 
     m_Network = armnn::INetwork::Create();
+    m_NetworkReferencesFile = false;
 
     for (auto info : sortedNodes)
     {
@@ -681,16 +631,7 @@ armnn::INetworkPtr RecordByRecordCaffeParser::LoadLayers(std::ifstream& ifs,
         }
         else
         {
-            char *buffer = new char[info->SizeOfData()];
-            ifs.clear();
-            ifs.seekg(info->PositionOfData(), std::ios_base::beg);
-            ifs.read(buffer, boost::numeric_cast<std::streamsize>(info->SizeOfData()));
-            bool bRet = layer.ParseFromArray(buffer, static_cast<int>(info->SizeOfData()));
-            delete[] buffer;
-            if (!bRet)
-            {
-                throw armnn::ParseException("Failed to parse layer [" + info->name() + "]");
-            }
+            ParseLayerParameter(*info, layer);
         }
 
         if (info->new_tops())
@@ -712,7 +653,11 @@ armnn::INetworkPtr RecordByRecordCaffeParser::LoadLayers(std::ifstream& ifs,
         auto func = it->second;
         (this->*func)(layer);
     }
-    ifs.close();
+
+    // The network holds on to the file if it references it
+    m_BlobData.clear();
+    m_UnalignedBlobData.clear();
+    m_File.reset();
 
     // Add ArmNN output layers connected to each requested output
     for (const std::string& requestedOutput : m_RequestedOutputs)
@@ -731,3 +676,109 @@ armnn::INetworkPtr RecordByRecordCaffeParser::LoadLayers(std::ifstream& ifs,
 
     return move(m_Network);
 }
+
+void RecordByRecordCaffeParser::ParseLayerParameter(const LayerParameterInfo& info, caffe::LayerParameter& layer)
+{
+    m_BlobData.clear();
+    m_UnalignedBlobData.clear();
+
+    // The fields around the blobs are parsed as they are, while each blob is parsed on its own.
+    const uint8_t* data = m_File->GetData();
+    ProtobufReader reader(data, info);
+    size_t startOfFields = reader.Position();
+    while (!reader.AtEnd())
+    {
+        size_t startOfField = reader.Position();
+        ProtobufFieldInfo fieldInfo = reader.ReadFieldInfo();
+        // repeated BlobProto blobs = 7;
+        if (fieldInfo.field_type() == 2 && fieldInfo.field_id() == 7)
+        {
+            VarLenDataInfo blobInfo = reader.ReadLengthDelimited();
+            MergeFieldsFromArray(layer, data + startOfFields, startOfField - startOfFields);
+            ParseBlobProto(blobInfo, *layer.add_blobs());
+            startOfFields = reader.Position();
+        }
+        else
+        {
+            reader.SkipField(fieldInfo);
+        }
+    }
+    MergeFieldsFromArray(layer, data + startOfFields, reader.Position() - startOfFields);
+
+    if (!layer.IsInitialized())
+    {
+        throw armnn::ParseException("Failed to parse layer [" + info.name() + "]");
+    }
+}
+
+void RecordByRecordCaffeParser::ParseBlobProto(const VarLenDataInfo& info, caffe::BlobProto& blob)
+{
+    // repeated float data = 5 [packed = true];
+    // Packed floats are stored as they are in memory on little endian targets, so unless the data is split
+    // into several fields it can be used from the file rather than being parsed into the blob.
+    const uint8_t* data = m_File->GetData();
+    ProtobufReader reader(data, info);
+    unsigned int numDataFields = 0;
+    bool isPacked = false;
+    size_t startOfDataField = 0;
+    VarLenDataInfo dataInfo(0, 0);
+    while (!reader.AtEnd())
+    {
+        size_t startOfField = reader.Position();
+        ProtobufFieldInfo fieldInfo = reader.ReadFieldInfo();
+        if (fieldInfo.field_id() == 5)
+        {
+            ++numDataFields;
+            if (fieldInfo.field_type() == 2)
+            {
+                isPacked = true;
+                startOfDataField = startOfField;
+                dataInfo = reader.ReadLengthDelimited();
+                continue;
+            }
+        }
+        reader.SkipField(fieldInfo);
+    }
+
+    const size_t endOfData = dataInfo.PositionOfData() + dataInfo.SizeOfData();
+    if (numDataFields != 1 || !isPacked || dataInfo.SizeOfData() % sizeof(float) != 0 || !IsLittleEndian())
+    {
+        MergeFieldsFromArray(blob, data + info.PositionOfData(), info.SizeOfData());
+        m_BlobData.push_back({ nullptr, 0 });
+        return;
+    }
+
+    MergeFieldsFromArray(blob, data + info.PositionOfData(), startOfDataField - info.PositionOfData());
+    MergeFieldsFromArray(blob, data + endOfData, info.PositionOfData() + info.SizeOfData() - endOfData);
+    m_BlobData.push_back({ data + dataInfo.PositionOfData(), dataInfo.SizeOfData() / sizeof(float) });
+}
+
+const float* RecordByRecordCaffeParser::GetBlobData(const caffe::LayerParameter& layerParam,
+                                                    unsigned int blobIndex,
+                                                    size_t numElements)
+{
+    if (blobIndex >= m_BlobData.size() || m_BlobData[blobIndex].m_Data == nullptr)
+    {
+        // The blob data was parsed into the LayerParameter
+        return CaffeParserBase::GetBlobData(layerParam, blobIndex, numElements);
+    }
+
+    const BlobDataInfo& blobData = m_BlobData[blobIndex];
+    CheckBlobSize(layerParam, blobIndex, numElements, blobData.m_NumElements);
+
+    if (reinterpret_cast<uintptr_t>(blobData.m_Data) % alignof(float) != 0)
+    {
+        m_UnalignedBlobData.emplace_back(numElements);
+        std::memcpy(m_UnalignedBlobData.back().data(), blobData.m_Data, numElements * sizeof(float));
+        return m_UnalignedBlobData.back().data();
+    }
+
+    // The network references the weights in the file, instead of copying them, once it holds on to it
+    if (!m_NetworkReferencesFile)
+    {
+        boost::polymorphic_downcast<armnn::Network*>(m_Network.get())->AddConstTensorStorage(
+            m_File, m_File->GetData(), m_File->GetSize());
+        m_NetworkReferencesFile = true;
+    }
+    return reinterpret_cast<const float*>(blobData.m_Data);
+}
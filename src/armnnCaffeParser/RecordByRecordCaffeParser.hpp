@@ -5,23 +5,30 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
-#include <iostream>
 
 #include "caffe/proto/caffe.pb.h"
 
 #include "CaffeParser.hpp"
 
-
+namespace armnnUtils
+{
+class MemoryMappedFile;
+}
 
 namespace armnnCaffeParser
 {
 
 class NetParameterInfo;
 class LayerParameterInfo;
+class VarLenDataInfo;
 
 
+/// Parses a binary Caffe model one layer record at a time, straight from the memory mapped file, so the whole
+/// NetParameter is never held in memory. The packed data of blobs is not parsed into the LayerParameters: layers
+/// are added from the mapped file, which the network then references instead of copying the weights.
 class RecordByRecordCaffeParser : public CaffeParserBase
 {
 public:
@@ -34,20 +41,47 @@ public:
 
     RecordByRecordCaffeParser();
 
+protected:
+    /// Returns blob data from the mapped file when it was not parsed into the LayerParameter.
+    virtual const float* GetBlobData(const caffe::LayerParameter& layerParam,
+                                     unsigned int blobIndex,
+                                     size_t numElements) override;
+
 private:
+    /// The packed data of a blob in the mapped file, or nullptr if it was parsed into the BlobProto
+    struct BlobDataInfo
+    {
+        const uint8_t* m_Data;
+        size_t         m_NumElements;
+    };
+
     void ProcessLayers(const NetParameterInfo& netParameterInfo,
                        std::vector<LayerParameterInfo>& layerInfo,
                        const std::vector<std::string>& m_RequestedOutputs,
                        std::vector<const LayerParameterInfo*>& sortedNodes);
-    armnn::INetworkPtr LoadLayers(std::ifstream& ifs,
-                                  std::vector<const LayerParameterInfo *>& sortedNodes,
+    armnn::INetworkPtr LoadLayers(std::vector<const LayerParameterInfo *>& sortedNodes,
                                   const NetParameterInfo& netParameterInfo);
     std::vector<const LayerParameterInfo*> GetInputs(
         const LayerParameterInfo& layerParam);
 
+    /// Parses a LayerParameter record from the mapped file, leaving the packed data of its blobs out of it.
+    void ParseLayerParameter(const LayerParameterInfo& info, caffe::LayerParameter& layer);
+    void ParseBlobProto(const VarLenDataInfo& info, caffe::BlobProto& blob);
+
     std::map<std::string, const LayerParameterInfo*> m_CaffeLayersByTopName;
     std::vector<std::string> m_RequestedOutputs;
+
+    /// The model file being parsed
+    std::shared_ptr<const armnnUtils::MemoryMappedFile> m_File;
+
+    /// Whether m_Network references m_File yet, which it does once a blob is added from it
+    bool m_NetworkReferencesFile;
+
+    /// The blob data of the layer being parsed, by blob index
+    std::vector<BlobDataInfo> m_BlobData;
+
+    /// Copies of the blob data of the layer being parsed which is not aligned for floats in the file
+    std::vector<std::vector<float>> m_UnalignedBlobData;
 };
 
 } // namespace armnnCaffeParser
-
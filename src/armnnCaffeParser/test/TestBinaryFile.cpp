@@ -0,0 +1,115 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include <boost/test/unit_test.hpp>
+#include "armnnCaffeParser/ICaffeParser.hpp"
+
+#include <armnn/IRuntime.hpp>
+
+#include "caffe/proto/caffe.pb.h"
+#include <google/protobuf/text_format.h>
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(CaffeParser)
+
+namespace
+{
+
+struct BinaryFileFixture
+{
+    BinaryFileFixture()
+        : m_Path(boost::filesystem::temp_directory_path() /
+                 boost::filesystem::unique_path("%%%%-%%%%-%%%%.caffemodel"))
+    {
+        // A convolution with two groups, whose weights are added for each group from the mapped file
+        const std::string prototext = R"(
+            name: "BinaryFileTest"
+            layer {
+                name: "input1"
+                type: "Input"
+                top: "input1"
+                input_param { shape: { dim: 1 dim: 2 dim: 2 dim: 2 } }
+            }
+            layer {
+                name: "conv1"
+                type: "Convolution"
+                bottom: "input1"
+                top: "conv1"
+                blobs: { data: 1 data: 1 data: 1 data: 1 data: 2 data: 2 data: 2 data: 2 }
+                blobs: { data: 0 data: 1 }
+                convolution_param {
+                    num_output: 2
+                    pad: 0
+                    kernel_size: 2
+                    stride: 1
+                    group: 2
+                }
+            }
+        )";
+
+        caffe::NetParameter netParameter;
+        BOOST_REQUIRE(google::protobuf::TextFormat::ParseFromString(prototext, &netParameter));
+
+        std::ofstream file(m_Path.c_str(), std::ios::binary);
+        BOOST_REQUIRE(netParameter.SerializeToOstream(&file));
+    }
+
+    ~BinaryFileFixture()
+    {
+        boost::system::error_code error;
+        boost::filesystem::remove(m_Path, error);
+    }
+
+    boost::filesystem::path m_Path;
+};
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_CASE(CreateNetworkFromBinaryFile, BinaryFileFixture)
+{
+    armnnCaffeParser::ICaffeParserPtr parser = armnnCaffeParser::ICaffeParser::Create();
+    armnn::INetworkPtr network = parser->CreateNetworkFromBinaryFile(m_Path.c_str(), {}, { "conv1" });
+    BOOST_TEST(network.get());
+
+    armnnCaffeParser::BindingPointInfo inputBinding  = parser->GetNetworkInputBindingInfo("input1");
+    armnnCaffeParser::BindingPointInfo outputBinding = parser->GetNetworkOutputBindingInfo("conv1");
+
+    // The weights stay valid once the parser and the file are gone
+    parser.reset();
+    boost::filesystem::remove(m_Path);
+
+    armnn::IRuntimePtr runtime = armnn::IRuntime::Create(armnn::IRuntime::CreationOptions());
+    armnn::IOptimizedNetworkPtr optimized = armnn::Optimize(*network, { armnn::Compute::CpuRef },
+                                                            runtime->GetDeviceSpec());
+    network.reset();
+
+    armnn::NetworkId networkId;
+    BOOST_TEST(runtime->LoadNetwork(networkId, std::move(optimized)) == armnn::Status::Success);
+
+    std::vector<float> inputData{ 1, 2, 3, 4, 5, 6, 7, 8 };
+    std::vector<float> outputData(2);
+    armnn::InputTensors inputTensors{ { inputBinding.first,
+                                        armnn::ConstTensor(inputBinding.second, inputData.data()) } };
+    armnn::OutputTensors outputTensors{ { outputBinding.first,
+                                          armnn::Tensor(outputBinding.second, outputData.data()) } };
+    BOOST_TEST(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == armnn::Status::Success);
+
+    // Each group applies its filter to its channel, then adds its bias
+    const std::vector<float> expectedOutput{ 10, 53 };
+    BOOST_TEST(outputData == expectedOutput, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(CreateNetworkFromMissingBinaryFile)
+{
+    armnnCaffeParser::ICaffeParserPtr parser = armnnCaffeParser::ICaffeParser::Create();
+    BOOST_CHECK_THROW(parser->CreateNetworkFromBinaryFile("missing.caffemodel", {}, { "conv1" }),
+                      armnn::FileNotFoundException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -10,9 +10,15 @@
 #include <armnn/TypesUtils.hpp>
 #include <armnn/LstmParams.hpp>
 #include <armnn/QuantizedLstmParams.hpp>
+#include <armnn/BackendRegistry.hpp>
+#include <armnn/Version.hpp>
 
 #include <armnnUtils/Permute.hpp>
 
+#include <Graph.hpp>
+#include <MemoryMappedFile.hpp>
+#include <Network.hpp>
+
 #include <ParserHelper.hpp>
 #include <VerificationHelpers.hpp>
 
@@ -185,7 +191,9 @@ bool CheckShape(const armnn::TensorShape& actual, const std::vector<uint32_t>& e
 Deserializer::Deserializer()
 : m_Network(nullptr, nullptr),
 //May require LayerType_Max to be included
-m_ParserFunctions(Layer_MAX+1, &Deserializer::ParseUnsupportedLayer)
+m_ParserFunctions(Layer_MAX+1, &Deserializer::ParseUnsupportedLayer),
+m_ExternalData(nullptr),
+m_ExternalDataSize(0)
 {
     // register supported layers
     m_ParserFunctions[Layer_AbsLayer]                    = &Deserializer::ParseAbs;
@@ -241,6 +249,14 @@ m_ParserFunctions(Layer_MAX+1, &Deserializer::ParseUnsupportedLayer)
     m_ParserFunctions[Layer_SubtractionLayer]            = &Deserializer::ParseSubtraction;
     m_ParserFunctions[Layer_SwitchLayer]                 = &Deserializer::ParseSwitch;
     m_ParserFunctions[Layer_TransposeConvolution2dLayer] = &Deserializer::ParseTransposeConvolution2d;
+
+    // Layers inserted by the optimizer
+    m_ParserFunctions[Layer_MemCopyLayer]                = &Deserializer::ParseOptimizerInsertedLayer;
+    m_ParserFunctions[Layer_MemImportLayer]              = &Deserializer::ParseOptimizerInsertedLayer;
+    m_ParserFunctions[Layer_ConvertFp16ToFp32Layer]      = &Deserializer::ParseOptimizerInsertedLayer;
+    m_ParserFunctions[Layer_ConvertFp32ToFp16Layer]      = &Deserializer::ParseOptimizerInsertedLayer;
+    m_ParserFunctions[Layer_ConvertBf16ToFp32Layer]      = &Deserializer::ParseOptimizerInsertedLayer;
+    m_ParserFunctions[Layer_ConvertFp32ToBf16Layer]      = &Deserializer::ParseOptimizerInsertedLayer;
 }
 
 Deserializer::LayerBaseRawPtr Deserializer::GetBaseLayer(const GraphPtr& graphPtr, unsigned int layerIndex)
@@ -267,6 +283,14 @@ Deserializer::LayerBaseRawPtr Deserializer::GetBaseLayer(const GraphPtr& graphPt
             return graphPtr->layers()->Get(layerIndex)->layer_as_ConcatLayer()->base();
         case Layer::Layer_ConstantLayer:
             return graphPtr->layers()->Get(layerIndex)->layer_as_ConstantLayer()->base();
+        case Layer::Layer_ConvertBf16ToFp32Layer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_ConvertBf16ToFp32Layer()->base();
+        case Layer::Layer_ConvertFp16ToFp32Layer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_ConvertFp16ToFp32Layer()->base();
+        case Layer::Layer_ConvertFp32ToBf16Layer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_ConvertFp32ToBf16Layer()->base();
+        case Layer::Layer_ConvertFp32ToFp16Layer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_ConvertFp32ToFp16Layer()->base();
         case Layer::Layer_Convolution2dLayer:
             return graphPtr->layers()->Get(layerIndex)->layer_as_Convolution2dLayer()->base();
         case Layer::Layer_DepthToSpaceLayer:
@@ -301,6 +325,10 @@ Deserializer::LayerBaseRawPtr Deserializer::GetBaseLayer(const GraphPtr& graphPt
             return graphPtr->layers()->Get(layerIndex)->layer_as_LstmLayer()->base();
         case Layer::Layer_MeanLayer:
             return graphPtr->layers()->Get(layerIndex)->layer_as_MeanLayer()->base();
+        case Layer::Layer_MemCopyLayer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_MemCopyLayer()->base();
+        case Layer::Layer_MemImportLayer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_MemImportLayer()->base();
         case Layer::Layer_MinimumLayer:
             return graphPtr->layers()->Get(layerIndex)->layer_as_MinimumLayer()->base();
         case Layer::Layer_MaximumLayer:
@@ -477,6 +505,22 @@ armnn::UnaryOperation ToUnaryOperation(armnnSerializer::UnaryOperation operation
     }
 }
 
+armnn::EdgeStrategy ToEdgeStrategy(armnnSerializer::EdgeStrategy edgeStrategy)
+{
+    switch (edgeStrategy)
+    {
+        case armnnSerializer::EdgeStrategy_DirectCompatibility:
+            return armnn::EdgeStrategy::DirectCompatibility;
+        case armnnSerializer::EdgeStrategy_ExportToTarget:
+            return armnn::EdgeStrategy::ExportToTarget;
+        case armnnSerializer::EdgeStrategy_CopyToTarget:
+            return armnn::EdgeStrategy::CopyToTarget;
+        case armnnSerializer::EdgeStrategy_Undefined:
+        default:
+            return armnn::EdgeStrategy::Undefined;
+    }
+}
+
 armnn::ResizeMethod ToResizeMethod(armnnSerializer::ResizeMethod method)
 {
     switch (method)
@@ -514,6 +558,9 @@ armnn::TensorInfo ToTensorInfo(Deserializer::TensorRawPtr tensorPtr)
         case DataType_Float16:
             type = armnn::DataType::Float16;
             break;
+        case DataType_BFloat16:
+            type = armnn::DataType::BFloat16;
+            break;
         case DataType_Boolean:
             type = armnn::DataType::Boolean;
             break;
@@ -544,7 +591,7 @@ armnn::TensorInfo ToTensorInfo(Deserializer::TensorRawPtr tensorPtr)
     return result;
 }
 
-armnn::ConstTensor ToConstTensor(Deserializer::ConstTensorRawPtr constTensorPtr)
+armnn::ConstTensor Deserializer::ToConstTensor(ConstTensorRawPtr constTensorPtr) const
 {
     CHECK_CONST_TENSOR_PTR(constTensorPtr);
     armnn::TensorInfo tensorInfo = ToTensorInfo(constTensorPtr->info());
@@ -575,6 +622,24 @@ armnn::ConstTensor ToConstTensor(Deserializer::ConstTensorRawPtr constTensorPtr)
             CHECK_CONST_TENSOR_SIZE(longData->size(), tensorInfo.GetNumElements());
             return armnn::ConstTensor(tensorInfo, longData->data());
         }
+        case ConstTensorData_ExternalData:
+        {
+            auto externalData = constTensorPtr->data_as_ExternalData();
+            if (m_ExternalData == nullptr ||
+                externalData->offset() > m_ExternalDataSize ||
+                externalData->numBytes() > m_ExternalDataSize - externalData->offset())
+            {
+                throw ParseException(
+                        boost::str(boost::format("Constant tensor data is outside of the external data section. "
+                                                 "offset:%1% size:%2% %3%") %
+                                   externalData->offset() %
+                                   externalData->numBytes() %
+                                   CHECK_LOCATION().AsString()));
+            }
+            CHECK_CONST_TENSOR_SIZE(boost::numeric_cast<unsigned int>(externalData->numBytes()),
+                                    tensorInfo.GetNumBytes());
+            return armnn::ConstTensor(tensorInfo, m_ExternalData + externalData->offset());
+        }
         default:
         {
             CheckLocation location = CHECK_LOCATION();
@@ -640,6 +705,10 @@ void Deserializer::ResetParser()
     m_Network = armnn::INetworkPtr(nullptr, nullptr);
     m_InputBindings.clear();
     m_OutputBindings.clear();
+    m_LayerIndexOfGuid.clear();
+    m_MappedFile.reset();
+    m_ExternalData = nullptr;
+    m_ExternalDataSize = 0;
 }
 
 IDeserializer* IDeserializer::CreateRaw()
@@ -661,6 +730,7 @@ INetworkPtr Deserializer::CreateNetworkFromBinary(const std::vector<uint8_t>& bi
 {
      ResetParser();
      GraphPtr graph = LoadGraphFromBinary(binaryContent.data(), binaryContent.size());
+     LoadExternalDataSection(graph, binaryContent.data(), binaryContent.size());
      return CreateNetworkFromGraph(graph);
 }
 
@@ -669,9 +739,38 @@ armnn::INetworkPtr Deserializer::CreateNetworkFromBinary(std::istream& binaryCon
     ResetParser();
     std::vector<uint8_t> content((std::istreambuf_iterator<char>(binaryContent)), std::istreambuf_iterator<char>());
     GraphPtr graph = LoadGraphFromBinary(content.data(), content.size());
+    LoadExternalDataSection(graph, content.data(), content.size());
     return CreateNetworkFromGraph(graph);
 }
 
+INetworkPtr Deserializer::CreateNetworkFromBinaryFile(const char* graphFile)
+{
+    ResetParser();
+    m_MappedFile = std::make_shared<const armnnUtils::MemoryMappedFile>(graphFile);
+    GraphPtr graph = LoadGraphFromBinary(m_MappedFile->GetData(), m_MappedFile->GetSize());
+    LoadExternalDataSection(graph, m_MappedFile->GetData(), m_MappedFile->GetSize());
+    INetworkPtr network = CreateNetworkFromGraph(graph);
+    m_MappedFile.reset();
+    return network;
+}
+
+armnn::IOptimizedNetworkPtr Deserializer::CreateOptimizedNetworkFromBinary(const std::vector<uint8_t>& binaryContent)
+{
+    ResetParser();
+    GraphPtr graph = LoadGraphFromBinary(binaryContent.data(), binaryContent.size());
+    LoadExternalDataSection(graph, binaryContent.data(), binaryContent.size());
+    return CreateOptimizedNetworkFromGraph(graph);
+}
+
+armnn::IOptimizedNetworkPtr Deserializer::CreateOptimizedNetworkFromBinary(std::istream& binaryContent)
+{
+    ResetParser();
+    std::vector<uint8_t> content((std::istreambuf_iterator<char>(binaryContent)), std::istreambuf_iterator<char>());
+    GraphPtr graph = LoadGraphFromBinary(content.data(), content.size());
+    LoadExternalDataSection(graph, content.data(), content.size());
+    return CreateOptimizedNetworkFromGraph(graph);
+}
+
 Deserializer::GraphPtr Deserializer::LoadGraphFromBinary(const uint8_t* binaryContent, size_t len)
 {
     if (binaryContent == nullptr)
@@ -691,10 +790,41 @@ Deserializer::GraphPtr Deserializer::LoadGraphFromBinary(const uint8_t* binaryCo
     return GetSerializedGraph(binaryContent);
 }
 
+void Deserializer::LoadExternalDataSection(GraphPtr graph, const uint8_t* binaryContent, size_t len)
+{
+    m_ExternalData = nullptr;
+    m_ExternalDataSize = 0;
+
+    auto externalDataSection = graph->externalDataSection();
+    if (externalDataSection == nullptr)
+    {
+        return;
+    }
+
+    // The section is at the end of the binary content, after the flatbuffer
+    if (externalDataSection->size() > len)
+    {
+        throw ParseException(
+                boost::str(boost::format("The external data section of %1% bytes is missing or truncated. "
+                                         "size:%2% %3%") %
+                           externalDataSection->size() %
+                           len %
+                           CHECK_LOCATION().AsString()));
+    }
+    m_ExternalDataSize = boost::numeric_cast<size_t>(externalDataSection->size());
+    m_ExternalData = binaryContent + (len - m_ExternalDataSize);
+}
+
 INetworkPtr Deserializer::CreateNetworkFromGraph(GraphPtr graph)
 {
     m_Network = INetwork::Create();
     BOOST_ASSERT(graph != nullptr);
+    if (m_MappedFile)
+    {
+        // Constant tensors point into the flatbuffer, which the layers can reference instead of copying
+        boost::polymorphic_downcast<armnn::Network*>(m_Network.get())->AddConstTensorStorage(
+            m_MappedFile, m_MappedFile->GetData(), m_MappedFile->GetSize());
+    }
     unsigned int layerIndex = 0;
     for (AnyLayer const* layer : *graph->layers())
     {
@@ -732,6 +862,114 @@ INetworkPtr Deserializer::CreateNetworkFromGraph(GraphPtr graph)
     return std::move(m_Network);
 }
 
+void Deserializer::CheckOptimizedNetworkCompatibility(GraphPtr graph)
+{
+    CHECK_GRAPH(graph, 0);
+    if (graph->optimizedNetworkInfo() == nullptr)
+    {
+        throw ParseException(boost::str(boost::format("The serialized network has not been optimized, use "
+                                                      "CreateNetworkFromBinary and Optimize() instead %1%") %
+                                        CHECK_LOCATION().AsString()));
+    }
+
+    const unsigned int scheme = GetFeatureVersions(graph).m_OptimizedNetworkScheme;
+    if (scheme != 1)
+    {
+        throw ParseException(boost::str(boost::format("Unsupported optimized network scheme version %1% %2%") %
+                                        scheme %
+                                        CHECK_LOCATION().AsString()));
+    }
+
+    // Backend assignments and memory strategies are only valid for the version of Arm NN and its backends
+    // that produced them
+    const flatbuffers::String* armnnVersion = graph->optimizedNetworkInfo()->armnnVersion();
+    if (armnnVersion == nullptr || armnnVersion->str() != ARMNN_VERSION)
+    {
+        throw ParseException(boost::str(boost::format("The network was optimized by Arm NN version %1%, which "
+                                                      "differs from the running version %2%. Re-run Optimize() "
+                                                      "and serialize the network again %3%") %
+                                        (armnnVersion ? armnnVersion->str() : std::string("unknown")) %
+                                        ARMNN_VERSION %
+                                        CHECK_LOCATION().AsString()));
+    }
+
+    for (unsigned int i = 0; i < graph->layers()->size(); ++i)
+    {
+        LayerBaseRawPtr baseLayer = GetBaseLayer(graph, i);
+        if (baseLayer->backendId() == nullptr)
+        {
+            throw ParseException(boost::str(boost::format("No backend assigned to layer %1% %2%") %
+                                            baseLayer->layerName()->str() %
+                                            CHECK_LOCATION().AsString()));
+        }
+
+        const armnn::BackendId backendId(baseLayer->backendId()->str());
+        if (!armnn::BackendRegistryInstance().IsBackendRegistered(backendId))
+        {
+            throw ParseException(boost::str(boost::format("Layer %1% is assigned to the backend %2% which is not "
+                                                          "available %3%") %
+                                            baseLayer->layerName()->str() %
+                                            backendId %
+                                            CHECK_LOCATION().AsString()));
+        }
+    }
+}
+
+armnn::IOptimizedNetworkPtr Deserializer::CreateOptimizedNetworkFromGraph(GraphPtr graph)
+{
+    CheckOptimizedNetworkCompatibility(graph);
+
+    INetworkPtr network = CreateNetworkFromGraph(graph);
+    const armnn::Network& inNetwork = *boost::polymorphic_downcast<const armnn::Network*>(network.get());
+
+    // Cloned layers keep their guids, which identify the serialized layer they were created from
+    auto optimizedNetwork = IOptimizedNetworkPtr(new armnn::OptimizedNetwork(
+                                                     std::make_unique<armnn::Graph>(inNetwork.GetGraph())),
+                                                 &IOptimizedNetwork::Destroy);
+    armnn::Graph& optimizedGraph =
+        boost::polymorphic_downcast<armnn::OptimizedNetwork*>(optimizedNetwork.get())->GetGraph();
+
+    auto getBaseLayer = [&](const armnn::Layer& layer)
+    {
+        auto it = m_LayerIndexOfGuid.find(layer.GetGuid());
+        if (it == m_LayerIndexOfGuid.end())
+        {
+            throw ParseException(boost::str(boost::format("Layer %1% was not deserialized %2%") %
+                                            layer.GetNameStr() %
+                                            CHECK_LOCATION().AsString()));
+        }
+        return GetBaseLayer(graph, it->second);
+    };
+
+    // Restores the backend assignment and the memory strategies chosen by Optimize()
+    for (armnn::Layer* layer : optimizedGraph)
+    {
+        LayerBaseRawPtr baseLayer = getBaseLayer(*layer);
+        layer->SetBackendId(armnn::BackendId(baseLayer->backendId()->str()));
+
+        for (unsigned int slotIndex = 0; slotIndex < layer->GetNumOutputSlots(); ++slotIndex)
+        {
+            armnn::OutputSlot& outputSlot = layer->GetOutputSlot(slotIndex);
+
+            auto fbOutputSlot = baseLayer->outputSlots()->Get(slotIndex);
+            if (fbOutputSlot->tensorHandleFactoryId() != nullptr)
+            {
+                outputSlot.SetTensorHandleFactory(fbOutputSlot->tensorHandleFactoryId()->str());
+            }
+
+            for (unsigned int connectionIndex = 0; connectionIndex < outputSlot.GetNumConnections(); ++connectionIndex)
+            {
+                const armnn::InputSlot* destination = outputSlot.GetConnection(connectionIndex);
+                LayerBaseRawPtr destinationBaseLayer = getBaseLayer(destination->GetOwningLayer());
+                auto fbInputSlot = destinationBaseLayer->inputSlots()->Get(destination->GetSlotIndex());
+                outputSlot.SetEdgeStrategy(connectionIndex, ToEdgeStrategy(fbInputSlot->edgeStrategy()));
+            }
+        }
+    }
+
+    return optimizedNetwork;
+}
+
 BindingPointInfo Deserializer::GetNetworkInputBindingInfo(unsigned int layerIndex,
                                                           const std::string& name) const
 {
@@ -822,6 +1060,7 @@ Deserializer::FeatureVersions Deserializer::GetFeatureVersions(GraphPtr graph)
     if (graph->featureVersions())
     {
         versions.m_BindingIdScheme = graph->featureVersions()->bindingIdsScheme();
+        versions.m_OptimizedNetworkScheme = graph->featureVersions()->optimizedNetworkScheme();
     }
 
     return versions;
@@ -914,6 +1153,7 @@ void Deserializer::RegisterOutputSlots(GraphPtr graph,
 {
     CHECK_LAYERS(graph, 0, layerIndex);
     BOOST_ASSERT(layer != nullptr);
+    m_LayerIndexOfGuid[layer->GetGuid()] = layerIndex;
     LayerBaseRawPtr baseLayer = GetBaseLayer(graph, layerIndex);
     if (baseLayer->outputSlots()->size() != layer->GetNumOutputSlots())
     {
@@ -941,6 +1181,7 @@ void Deserializer::RegisterInputSlots(GraphPtr graph,
 {
     CHECK_LAYERS(graph, 0, layerIndex);
     BOOST_ASSERT(layer != nullptr);
+    m_LayerIndexOfGuid[layer->GetGuid()] = layerIndex;
     LayerBaseRawPtr baseLayer = GetBaseLayer(graph, layerIndex);
     if (baseLayer->inputSlots()->size() != layer->GetNumInputSlots())
     {
@@ -2238,6 +2479,61 @@ void Deserializer::ParseNormalization(GraphPtr graph, unsigned int layerIndex)
     RegisterOutputSlots(graph, layerIndex, layer);
 }
 
+void Deserializer::ParseOptimizerInsertedLayer(GraphPtr graph, unsigned int layerIndex)
+{
+    CHECK_LAYERS(graph, 0, layerIndex);
+
+    // These layers have no INetwork factory method and only appear in optimized networks
+    if (graph->optimizedNetworkInfo() == nullptr)
+    {
+        throw ParseException(boost::str(boost::format("Layer %1% can only be deserialized as part of an optimized "
+                                                      "network %2%") %
+                                        GetLayerName(graph, layerIndex) %
+                                        CHECK_LOCATION().AsString()));
+    }
+
+    auto inputs = GetInputs(graph, layerIndex);
+    CHECK_VALID_SIZE(inputs.size(), 1);
+
+    auto outputs = GetOutputs(graph, layerIndex);
+    CHECK_VALID_SIZE(outputs.size(), 1);
+
+    auto layerName = GetLayerName(graph, layerIndex);
+    armnn::Graph& networkGraph = boost::polymorphic_downcast<armnn::Network*>(m_Network.get())->GetGraph();
+
+    armnn::Layer* layer = nullptr;
+    switch (graph->layers()->Get(layerIndex)->layer_type())
+    {
+        case Layer_MemCopyLayer:
+            layer = networkGraph.AddLayer<armnn::MemCopyLayer>(layerName.c_str());
+            break;
+        case Layer_MemImportLayer:
+            layer = networkGraph.AddLayer<armnn::MemImportLayer>(layerName.c_str());
+            break;
+        case Layer_ConvertFp16ToFp32Layer:
+            layer = networkGraph.AddLayer<armnn::ConvertFp16ToFp32Layer>(layerName.c_str());
+            break;
+        case Layer_ConvertFp32ToFp16Layer:
+            layer = networkGraph.AddLayer<armnn::ConvertFp32ToFp16Layer>(layerName.c_str());
+            break;
+        case Layer_ConvertBf16ToFp32Layer:
+            layer = networkGraph.AddLayer<armnn::ConvertBf16ToFp32Layer>(layerName.c_str());
+            break;
+        case Layer_ConvertFp32ToBf16Layer:
+            layer = networkGraph.AddLayer<armnn::ConvertFp32ToBf16Layer>(layerName.c_str());
+            break;
+        default:
+            throw ParseException(boost::str(boost::format("Layer %1% was not inserted by the optimizer %2%") %
+                                            layerName %
+                                            CHECK_LOCATION().AsString()));
+    }
+
+    layer->GetOutputSlot(0).SetTensorInfo(ToTensorInfo(outputs[0]));
+
+    RegisterInputSlots(graph, layerIndex, layer);
+    RegisterOutputSlots(graph, layerIndex, layer);
+}
+
 void Deserializer::ParseRsqrt(GraphPtr graph, unsigned int layerIndex)
 {
     CHECK_LAYERS(graph, 0, layerIndex);
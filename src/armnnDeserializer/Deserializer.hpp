@@ -9,8 +9,14 @@
 #include "armnnDeserializer/IDeserializer.hpp"
 #include <ArmnnSchema_generated.h>
 
+#include <memory>
 #include <unordered_map>
 
+namespace armnnUtils
+{
+class MemoryMappedFile;
+}
+
 namespace armnnDeserializer
 {
 class Deserializer : public IDeserializer
@@ -38,6 +44,15 @@ public:
     /// Create an input network from a binary input stream
     armnn::INetworkPtr CreateNetworkFromBinary(std::istream& binaryContent) override;
 
+    /// Create the network from a binary file on disk, referencing its constant tensors in place
+    armnn::INetworkPtr CreateNetworkFromBinaryFile(const char* graphFile) override;
+
+    /// Create an optimized network from the binary contents of a network serialized after Optimize()
+    armnn::IOptimizedNetworkPtr CreateOptimizedNetworkFromBinary(const std::vector<uint8_t>& binaryContent) override;
+
+    /// Create an optimized network from a binary input stream of a network serialized after Optimize()
+    armnn::IOptimizedNetworkPtr CreateOptimizedNetworkFromBinary(std::istream& binaryContent) override;
+
     /// Retrieve binding info (layer id and tensor info) for the network input identified by the given layer name
     BindingPointInfo GetNetworkInputBindingInfo(unsigned int layerId, const std::string& name) const override;
 
@@ -73,6 +88,18 @@ private:
     /// Create the network from an already loaded flatbuffers graph
     armnn::INetworkPtr CreateNetworkFromGraph(GraphPtr graph);
 
+    /// Locates the external data section of the graph at the end of the binary content, if it has one
+    void LoadExternalDataSection(GraphPtr graph, const uint8_t* binaryContent, size_t len);
+
+    /// Creates a ConstTensor referencing the data of the serialized tensor, inline or in the external data section
+    armnn::ConstTensor ToConstTensor(ConstTensorRawPtr constTensorPtr) const;
+
+    /// Create the optimized network from an already loaded flatbuffers graph of an optimized network
+    armnn::IOptimizedNetworkPtr CreateOptimizedNetworkFromGraph(GraphPtr graph);
+
+    /// Throws if the optimized network cannot be loaded by this version of Arm NN on the available backends
+    void CheckOptimizedNetworkCompatibility(GraphPtr graph);
+
     // signature for the parser functions
     using LayerParsingFunction = void(Deserializer::*)(GraphPtr graph, unsigned int layerIndex);
 
@@ -107,6 +134,7 @@ private:
     void ParseMerge(GraphPtr graph, unsigned int layerIndex);
     void ParseMultiplication(GraphPtr graph, unsigned int layerIndex);
     void ParseNormalization(GraphPtr graph, unsigned int layerIndex);
+    void ParseOptimizerInsertedLayer(GraphPtr graph, unsigned int layerIndex);
     void ParseLstm(GraphPtr graph, unsigned int layerIndex);
     void ParseQuantizedLstm(GraphPtr graph, unsigned int layerIndex);
     void ParsePad(GraphPtr graph, unsigned int layerIndex);
@@ -155,6 +183,7 @@ private:
     {
         // Default values to zero for backward compatibility
         unsigned int m_BindingIdScheme = 0;
+        unsigned int m_OptimizedNetworkScheme = 0;
     };
 
     FeatureVersions GetFeatureVersions(GraphPtr graph);
@@ -179,6 +208,16 @@ private:
 
     /// Maps layer index (index property in flatbuffer object) to Connections for each layer
     std::unordered_map<unsigned int, Connections> m_GraphConnections;
+
+    /// Maps the guid of each layer added to the network to its index in the flatbuffer layers vector
+    std::unordered_map<armnn::LayerGuid, unsigned int> m_LayerIndexOfGuid;
+
+    /// The file the network is being deserialized from, when it is referenced in place
+    std::shared_ptr<const armnnUtils::MemoryMappedFile> m_MappedFile;
+
+    /// The external data section of the graph being deserialized, or null if it has none
+    const uint8_t* m_ExternalData;
+    size_t m_ExternalDataSize;
 };
 
 } // namespace armnnDeserializer
@@ -6,14 +6,18 @@
 
 #include <armnn/Descriptors.hpp>
 #include <armnn/Utils.hpp>
+#include <MemoryMappedFile.hpp>
+#include <Network.hpp>
 #include <VerificationHelpers.hpp>
 
 #include <boost/format.hpp>
 #include <boost/numeric/conversion/cast.hpp>
+#include <boost/polymorphic_cast.hpp>
 
 #include <google/protobuf/text_format.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 
+#include <cctype>
 #include <numeric>
 
 using namespace armnn;
@@ -48,6 +52,55 @@ void CheckValidDataType(std::initializer_list<onnx::TensorProto::DataType> valid
 #define CHECK_VALID_DATATYPE(NODE, TENSOR, ACTUAL, ...) \
 CheckValidDataType({__VA_ARGS__}, ACTUAL, #__VA_ARGS__, NODE, TENSOR, CHECK_LOCATION())
 
+/// Returns the directory of a file, with a trailing separator, or an empty string for the current directory
+std::string GetDirectory(const char* file)
+{
+    const std::string path(file);
+    const size_t separator = path.find_last_of("/\\");
+    return separator == std::string::npos ? std::string() : path.substr(0, separator + 1);
+}
+
+uint64_t ReadExternalDataValue(const onnx::StringStringEntryProto& entry, const std::string& tensorName)
+{
+    const std::string& value = entry.value();
+    if (value.empty() || value.size() > 19 ||
+        !std::all_of(value.begin(), value.end(), [](char c) { return std::isdigit(static_cast<unsigned char>(c)); }))
+    {
+        throw ParseException(boost::str(
+            boost::format("Invalid external data %1% '%2%' for tensor '%3%' %4%")
+                          % entry.key()
+                          % value
+                          % tensorName
+                          % CHECK_LOCATION().AsString()));
+    }
+    return std::stoull(value);
+}
+
+/// External data must be in files next to the model, or in directories below it
+bool IsRelativeLocation(const std::string& location)
+{
+    if (location.empty() || location[0] == '/' || location[0] == '\\' || location.find(':') != std::string::npos)
+    {
+        return false;
+    }
+
+    size_t begin = 0;
+    while (begin <= location.size())
+    {
+        size_t end = location.find_first_of("/\\", begin);
+        if (end == std::string::npos)
+        {
+            end = location.size();
+        }
+        if (location.compare(begin, end - begin, "..") == 0)
+        {
+            return false;
+        }
+        begin = end + 1;
+    }
+    return true;
+}
+
 using StrTypeListPair = std::pair<const char*, std::initializer_list<onnx::TensorProto::DataType>>;
 #define STR_LIST(...) StrTypeListPair(#__VA_ARGS__, {__VA_ARGS__})
 
@@ -440,6 +493,8 @@ void OnnxParser::ResetParser()
 {
     m_Network = armnn::INetworkPtr(nullptr, nullptr);
     m_Graph = nullptr;
+    m_ExternalDataDirectory.clear();
+    m_ExternalDataFiles.clear();
 }
 
 void OnnxParser::Cleanup()
@@ -448,12 +503,87 @@ void OnnxParser::Cleanup()
     m_TensorsInfo.clear();
     m_OutputsMap.clear();
     m_OutputsFusedAndUsed.clear();
+    m_ExternalDataFiles.clear();
+}
+
+const void* OnnxParser::GetExternalTensorData(const std::string& name,
+                                              const onnx::TensorProto& tensor,
+                                              size_t numBytes)
+{
+    std::string location;
+    uint64_t offset = 0;
+    uint64_t length = numBytes;
+    for (const onnx::StringStringEntryProto& entry : tensor.external_data())
+    {
+        if (entry.key() == "location")
+        {
+            location = entry.value();
+        }
+        else if (entry.key() == "offset")
+        {
+            offset = ReadExternalDataValue(entry, name);
+        }
+        else if (entry.key() == "length")
+        {
+            length = ReadExternalDataValue(entry, name);
+        }
+    }
+
+    if (!IsRelativeLocation(location))
+    {
+        throw ParseException(boost::str(
+            boost::format("The external data location '%1%' of tensor '%2%' must be a path relative to the model %3%")
+                          % location
+                          % name
+                          % CHECK_LOCATION().AsString()));
+    }
+
+    auto it = m_ExternalDataFiles.find(location);
+    if (it == m_ExternalDataFiles.end())
+    {
+        const std::string path = m_ExternalDataDirectory + location;
+        auto file = std::make_shared<const armnnUtils::MemoryMappedFile>(path.c_str());
+        boost::polymorphic_downcast<armnn::Network*>(m_Network.get())->AddConstTensorStorage(
+            file, file->GetData(), file->GetSize());
+        it = m_ExternalDataFiles.emplace(location, std::move(file)).first;
+    }
+
+    const armnnUtils::MemoryMappedFile& file = *it->second;
+    if (length != numBytes || offset > file.GetSize() || length > file.GetSize() - offset)
+    {
+        throw ParseException(boost::str(
+            boost::format("The external data of tensor '%1%' (%2% bytes at offset %3% of '%4%') does not match "
+                          "its %5% bytes or lies outside the file %6%")
+                          % name
+                          % length
+                          % offset
+                          % location
+                          % numBytes
+                          % CHECK_LOCATION().AsString()));
+    }
+
+    return file.GetData() + offset;
 }
 
 std::pair<ConstTensor, std::unique_ptr<float[]>> OnnxParser::CreateConstTensor(const std::string name)
 {
     const TensorInfo tensorInfo = *m_TensorsInfo[name].m_info;
-    onnx::TensorProto onnxTensor = *m_TensorsInfo[name].m_tensor;
+    const onnx::TensorProto& onnxTensor = *m_TensorsInfo[name].m_tensor;
+
+    if (onnxTensor.data_location() == onnx::TensorProto::EXTERNAL && tensorInfo.GetNumElements() != 0)
+    {
+        const void* externalData = GetExternalTensorData(name, onnxTensor, tensorInfo.GetNumBytes());
+
+        // The network references the mapped data instead of copying it, unless it is misaligned
+        if (reinterpret_cast<uintptr_t>(externalData) % alignof(float) == 0)
+        {
+            return std::make_pair(ConstTensor(tensorInfo, externalData), std::unique_ptr<float[]>());
+        }
+
+        std::unique_ptr<float[]> tensorData(new float[tensorInfo.GetNumElements()]);
+        ::memcpy(tensorData.get(), externalData, tensorInfo.GetNumBytes());
+        return std::make_pair(ConstTensor(tensorInfo, tensorData.get()), std::move(tensorData));
+    }
 
     auto srcData = onnxTensor.float_data().data();
     std::unique_ptr<float[]> tensorData(new float[tensorInfo.GetNumElements()]);
@@ -520,6 +650,7 @@ INetworkPtr OnnxParser::CreateNetworkFromTextFile(const char* graphFile)
 {
     ResetParser();
     ModelPtr modelProto = LoadModelFromTextFile(graphFile);
+    m_ExternalDataDirectory = GetDirectory(graphFile);
     return CreateNetworkFromModel(*modelProto);
 }
 
@@ -558,6 +689,7 @@ INetworkPtr OnnxParser::CreateNetworkFromBinaryFile(const char* graphFile)
 {
     ResetParser();
     ModelPtr modelProto = LoadModelFromBinaryFile(graphFile);
+    m_ExternalDataDirectory = GetDirectory(graphFile);
     return CreateNetworkFromModel(*modelProto);
 }
 
@@ -593,7 +725,9 @@ INetworkPtr OnnxParser::CreateNetworkFromModel(onnx::ModelProto& model)
     m_Network = INetwork::Create();
     try
     {
-        m_Graph = std::make_unique<onnx::GraphProto>(*model.mutable_graph());
+        // The model is not used any more, so take its graph rather than copying it with all the tensor data
+        m_Graph = std::make_unique<onnx::GraphProto>();
+        m_Graph->Swap(model.mutable_graph());
         LoadGraph();
     }
     catch (const ParseException& e)
@@ -614,9 +748,9 @@ void OnnxParser::LoadGraph()
     SetupInfo(m_Graph->mutable_input());
     SetupInfo(m_Graph->mutable_value_info());
 
-    for (auto tensor : m_Graph->initializer())
+    for (const auto& tensor : m_Graph->initializer())
     {
-        m_TensorsInfo[tensor.name()].m_tensor = std::make_unique<const onnx::TensorProto>(tensor);
+        m_TensorsInfo[tensor.name()].m_tensor = &tensor;
         m_TensorsInfo[tensor.name()].m_info = std::make_unique<TensorInfo>(ToTensorInfo(tensor));
         m_TensorsInfo[tensor.name()].m_dtype =
             static_cast<onnx::TensorProto::DataType>(tensor.data_type());
@@ -631,7 +765,7 @@ void OnnxParser::LoadGraph()
     //Parsing the graph
     for(size_t nodeIndex = 0; nodeIndex < static_cast<size_t>(m_Graph->node_size()); nodeIndex++)
     {
-        auto node = m_Graph->node(static_cast<int>(nodeIndex));
+        const onnx::NodeProto& node = m_Graph->node(static_cast<int>(nodeIndex));
         const std::string& operation = node.op_type();
 
         // check which layers we handled already (add and matmul fused as FC)
@@ -906,7 +1040,7 @@ void OnnxParser::ParseConstant(const onnx::NodeProto& node)
                          static_cast<onnx::TensorProto::DataType>(onnxTensor.data_type()), onnx::TensorProto::FLOAT);
 
     //Register this as a m_ConstParam so we know we can use it as a constant param in future layers.
-    m_TensorsInfo[node.output(0)].m_tensor = std::make_unique<const onnx::TensorProto>(onnxTensor);
+    m_TensorsInfo[node.output(0)].m_tensor = &onnxTensor;
     m_TensorsInfo[node.output(0)].m_info = std::make_unique<TensorInfo>(ToTensorInfo(onnxTensor));
     m_TensorsInfo[node.output(0)].m_dtype = static_cast<onnx::TensorProto::DataType>(onnxTensor.data_type());
 
@@ -1087,8 +1221,7 @@ void OnnxParser::ParseReshape(const onnx::NodeProto& node)
         {
             m_TensorsInfo[node.output(0)] = OnnxTensor();
         }
-        m_TensorsInfo[node.output(0)].m_tensor =
-            std::make_unique<onnx::TensorProto>(*m_TensorsInfo[node.input(0)].m_tensor);
+        m_TensorsInfo[node.output(0)].m_tensor = m_TensorsInfo[node.input(0)].m_tensor;
     }
     else
     {
@@ -1441,7 +1574,7 @@ void OnnxParser::PrependForBroadcast(const std::string& outputName,
     }
     else //make it constant and it will be create in Add
     {
-        m_TensorsInfo[outputName].m_tensor = std::make_unique<onnx::TensorProto>(*m_TensorsInfo[input0].m_tensor);
+        m_TensorsInfo[outputName].m_tensor = m_TensorsInfo[input0].m_tensor;
 
     }
 }
@@ -6,6 +6,8 @@
 
 #include "armnnOnnxParser/IOnnxParser.hpp"
 #include "google/protobuf/repeated_field.h"
+#include <memory>
+#include <string>
 #include <unordered_map>
 
 #include <onnx/onnx.pb.h>
@@ -17,6 +19,11 @@ class TensorInfo;
 enum class ActivationFunction;
 }
 
+namespace armnnUtils
+{
+class MemoryMappedFile;
+}
+
 namespace armnnOnnxParser
 {
 
@@ -128,6 +135,10 @@ private:
 
     std::pair<armnn::ConstTensor, std::unique_ptr<float[]>> CreateConstTensor(const std::string name);
 
+    /// Returns the data of a tensor stored in an external file, mapping the file on first use.
+    /// The network being built references the mapped file, which keeps it alive.
+    const void* GetExternalTensorData(const std::string& name, const onnx::TensorProto& tensor, size_t numBytes);
+
     template <typename TypeList, typename Location>
     void ValidateInputs(const onnx::NodeProto& node,
                         TypeList validInputs,
@@ -143,7 +154,8 @@ private:
     struct OnnxTensor
     {
         std::unique_ptr<armnn::TensorInfo>          m_info;
-        std::unique_ptr<const onnx::TensorProto>    m_tensor;
+        /// The constant value of the tensor, owned by m_Graph
+        const onnx::TensorProto*                    m_tensor;
         onnx::TensorProto::DataType                 m_dtype;
 
         OnnxTensor() : m_info(nullptr), m_tensor(nullptr), m_dtype(onnx::TensorProto::FLOAT) { }
@@ -183,5 +195,11 @@ private:
     };
 
     std::vector<UsageSummary> m_OutputsFusedAndUsed;
+
+    /// Directory of the model file, which the locations of external tensor data are relative to
+    std::string m_ExternalDataDirectory;
+
+    /// The files of external tensor data mapped so far, by location
+    std::unordered_map<std::string, std::shared_ptr<const armnnUtils::MemoryMappedFile>> m_ExternalDataFiles;
 };
 }
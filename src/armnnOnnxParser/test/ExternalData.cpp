@@ -0,0 +1,153 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <boost/test/unit_test.hpp>
+#include "armnnOnnxParser/IOnnxParser.hpp"
+
+#include <armnn/IRuntime.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(OnnxParser)
+
+namespace
+{
+
+/// Writes a model with a Constant node whose 7 floats are stored in the given external data location
+std::string WriteExternalDataModel(const boost::filesystem::path& directory, const std::string& location)
+{
+    const std::string model = R"(
+                   ir_version: 4
+                   producer_name:  "CNTK "
+                   producer_version:  "2.5.1 "
+                   domain:  "ai.cntk "
+                   model_version: 1
+                   graph {
+                     name:  "CNTKGraph "
+                     node {
+                        output:  "Output"
+                        attribute {
+                          name: "value"
+                          t {
+                              dims: 7
+                              data_type: 1
+                              data_location: EXTERNAL
+                              external_data {
+                                key: "location"
+                                value: ")" + location + R"("
+                              }
+                              external_data {
+                                key: "offset"
+                                value: "4"
+                              }
+                              external_data {
+                                key: "length"
+                                value: "28"
+                              }
+                          }
+                          type: 1
+                        }
+                        name:  "constantNode"
+                        op_type:  "Constant"
+                      }
+                      output {
+                          name:  "Output"
+                          type {
+                             tensor_type {
+                               elem_type: 1
+                               shape {
+                                 dim {
+                                    dim_value: 7
+                                 }
+                               }
+                             }
+                          }
+                      }
+                   }
+                   opset_import {
+                      version: 7
+                    })";
+
+    boost::filesystem::path modelPath = directory / "model.prototxt";
+    std::ofstream modelFile(modelPath.c_str());
+    modelFile << model;
+    return modelPath.string();
+}
+
+struct ExternalDataFixture
+{
+    ExternalDataFixture()
+        : m_Directory(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%-%%%%"))
+    {
+        boost::filesystem::create_directories(m_Directory / "weights");
+
+        // The tensor data follows a 4 bytes header
+        const std::vector<float> data{ 0.f, 0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f };
+        std::ofstream dataFile((m_Directory / "weights" / "constant.bin").c_str(), std::ios::binary);
+        dataFile.write(reinterpret_cast<const char*>(data.data()) + 4,
+                       static_cast<std::streamsize>(data.size() * sizeof(float) - 4));
+    }
+
+    ~ExternalDataFixture()
+    {
+        boost::system::error_code error;
+        boost::filesystem::remove_all(m_Directory, error);
+    }
+
+    boost::filesystem::path m_Directory;
+};
+
+} // anonymous namespace
+
+BOOST_FIXTURE_TEST_CASE(ConstFromExternalData, ExternalDataFixture)
+{
+    const std::string modelPath = WriteExternalDataModel(m_Directory, "weights/constant.bin");
+
+    armnnOnnxParser::IOnnxParserPtr parser(armnnOnnxParser::IOnnxParser::Create());
+    armnn::INetworkPtr network = parser->CreateNetworkFromTextFile(modelPath.c_str());
+    BOOST_TEST(network.get());
+
+    // The network keeps the mapped data alive after the parser is gone
+    armnnOnnxParser::BindingPointInfo outputBinding = parser->GetNetworkOutputBindingInfo("Output");
+    parser.reset();
+
+    armnn::IRuntimePtr runtime = armnn::IRuntime::Create(armnn::IRuntime::CreationOptions());
+    armnn::IOptimizedNetworkPtr optimized = armnn::Optimize(*network, { armnn::Compute::CpuRef },
+                                                            runtime->GetDeviceSpec());
+    network.reset();
+
+    armnn::NetworkId networkId;
+    BOOST_TEST(runtime->LoadNetwork(networkId, std::move(optimized)) == armnn::Status::Success);
+
+    std::vector<float> outputData(7);
+    armnn::OutputTensors outputTensors{ { outputBinding.first,
+                                          armnn::Tensor(outputBinding.second, outputData.data()) } };
+    BOOST_TEST(runtime->EnqueueWorkload(networkId, {}, outputTensors) == armnn::Status::Success);
+
+    const std::vector<float> expectedOutput{ 0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f };
+    BOOST_TEST(outputData == expectedOutput, boost::test_tools::per_element());
+}
+
+BOOST_FIXTURE_TEST_CASE(ExternalDataOutsideModelDirectory, ExternalDataFixture)
+{
+    const std::string modelPath = WriteExternalDataModel(m_Directory / "weights", "../weights/constant.bin");
+
+    armnnOnnxParser::IOnnxParserPtr parser(armnnOnnxParser::IOnnxParser::Create());
+    BOOST_CHECK_THROW(parser->CreateNetworkFromTextFile(modelPath.c_str()), armnn::ParseException);
+}
+
+BOOST_FIXTURE_TEST_CASE(MissingExternalData, ExternalDataFixture)
+{
+    const std::string modelPath = WriteExternalDataModel(m_Directory, "weights/missing.bin");
+
+    armnnOnnxParser::IOnnxParserPtr parser(armnnOnnxParser::IOnnxParser::Create());
+    BOOST_CHECK_THROW(parser->CreateNetworkFromTextFile(modelPath.c_str()), armnn::FileNotFoundException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -8,11 +8,20 @@
 #include <armnn/Descriptors.hpp>
 #include <armnn/LstmParams.hpp>
 #include <armnn/QuantizedLstmParams.hpp>
+#include <armnn/Version.hpp>
 
+#include <Layer.hpp>
+#include <Network.hpp>
+
+#include <armnnUtils/TensorUtils.hpp>
+
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 
 #include <boost/core/ignore_unused.hpp>
 #include <boost/numeric/conversion/cast.hpp>
+#include <boost/polymorphic_cast.hpp>
 #include <flatbuffers/util.h>
 
 #include "SerializerUtils.hpp"
@@ -1346,6 +1355,60 @@ void SerializerVisitor::VisitQuantizedLstmLayer(const armnn::IConnectableLayer*
     CreateAnyLayer(fbQuantizedLstmLayer.o, serializer::Layer::Layer_QuantizedLstmLayer);
 }
 
+void SerializerVisitor::VisitOptimizerInsertedLayer(const armnn::IConnectableLayer* layer,
+                                                    armnn::LayerType layerType)
+{
+    switch (layerType)
+    {
+        case armnn::LayerType::MemCopy:
+        {
+            auto fbBaseLayer = CreateLayerBase(layer, serializer::LayerType::LayerType_MemCopy);
+            auto fbLayer     = serializer::CreateMemCopyLayer(m_flatBufferBuilder, fbBaseLayer);
+            CreateAnyLayer(fbLayer.o, serializer::Layer::Layer_MemCopyLayer);
+            break;
+        }
+        case armnn::LayerType::MemImport:
+        {
+            auto fbBaseLayer = CreateLayerBase(layer, serializer::LayerType::LayerType_MemImport);
+            auto fbLayer     = serializer::CreateMemImportLayer(m_flatBufferBuilder, fbBaseLayer);
+            CreateAnyLayer(fbLayer.o, serializer::Layer::Layer_MemImportLayer);
+            break;
+        }
+        case armnn::LayerType::ConvertFp16ToFp32:
+        {
+            auto fbBaseLayer = CreateLayerBase(layer, serializer::LayerType::LayerType_ConvertFp16ToFp32);
+            auto fbLayer     = serializer::CreateConvertFp16ToFp32Layer(m_flatBufferBuilder, fbBaseLayer);
+            CreateAnyLayer(fbLayer.o, serializer::Layer::Layer_ConvertFp16ToFp32Layer);
+            break;
+        }
+        case armnn::LayerType::ConvertFp32ToFp16:
+        {
+            auto fbBaseLayer = CreateLayerBase(layer, serializer::LayerType::LayerType_ConvertFp32ToFp16);
+            auto fbLayer     = serializer::CreateConvertFp32ToFp16Layer(m_flatBufferBuilder, fbBaseLayer);
+            CreateAnyLayer(fbLayer.o, serializer::Layer::Layer_ConvertFp32ToFp16Layer);
+            break;
+        }
+        case armnn::LayerType::ConvertBf16ToFp32:
+        {
+            auto fbBaseLayer = CreateLayerBase(layer, serializer::LayerType::LayerType_ConvertBf16ToFp32);
+            auto fbLayer     = serializer::CreateConvertBf16ToFp32Layer(m_flatBufferBuilder, fbBaseLayer);
+            CreateAnyLayer(fbLayer.o, serializer::Layer::Layer_ConvertBf16ToFp32Layer);
+            break;
+        }
+        case armnn::LayerType::ConvertFp32ToBf16:
+        {
+            auto fbBaseLayer = CreateLayerBase(layer, serializer::LayerType::LayerType_ConvertFp32ToBf16);
+            auto fbLayer     = serializer::CreateConvertFp32ToBf16Layer(m_flatBufferBuilder, fbBaseLayer);
+            CreateAnyLayer(fbLayer.o, serializer::Layer::Layer_ConvertFp32ToBf16Layer);
+            break;
+        }
+        default:
+            throw armnn::InvalidArgumentException(
+                std::string("Layer of type ") + armnn::GetLayerTypeAsCString(layerType) +
+                " is not inserted by the optimizer");
+    }
+}
+
 fb::Offset<serializer::LayerBase> SerializerVisitor::CreateLayerBase(const IConnectableLayer* layer,
                                                                      const serializer::LayerType layerType)
 {
@@ -1355,12 +1418,20 @@ fb::Offset<serializer::LayerBase> SerializerVisitor::CreateLayerBase(const IConn
     std::vector<fb::Offset<serializer::InputSlot>> inputSlots = CreateInputSlots(layer);
     std::vector<fb::Offset<serializer::OutputSlot>> outputSlots = CreateOutputSlots(layer);
 
+    fb::Offset<fb::String> fbBackendId;
+    if (m_SerializeOptimizedNetwork)
+    {
+        const armnn::Layer* optimizedLayer = boost::polymorphic_downcast<const armnn::Layer*>(layer);
+        fbBackendId = m_flatBufferBuilder.CreateString(optimizedLayer->GetBackendId().Get());
+    }
+
     return serializer::CreateLayerBase(m_flatBufferBuilder,
                                        fbIndex,
                                        m_flatBufferBuilder.CreateString(layer->GetName()),
                                        layerType,
                                        m_flatBufferBuilder.CreateVector(inputSlots),
-                                       m_flatBufferBuilder.CreateVector(outputSlots));
+                                       m_flatBufferBuilder.CreateVector(outputSlots),
+                                       fbBackendId);
 }
 
 void SerializerVisitor::CreateAnyLayer(const flatbuffers::Offset<void>& layer, const serializer::Layer serializerLayer)
@@ -1374,11 +1445,22 @@ template <typename T>
 flatbuffers::Offset<flatbuffers::Vector<T>> SerializerVisitor::CreateDataVector(const void* memory, unsigned int size)
 {
     const T* buffer = reinterpret_cast<const T*>(memory);
-    std::vector<T> vector(buffer, buffer + (size / sizeof(T)));
-    auto fbVector = m_flatBufferBuilder.CreateVector(vector);
+    auto fbVector = m_flatBufferBuilder.CreateVector(buffer, size / sizeof(T));
     return fbVector;
 }
 
+flatbuffers::Offset<serializer::ExternalData> SerializerVisitor::CreateExternalData(const void* memory,
+                                                                                    unsigned int size)
+{
+    const uint64_t alignment = m_Options.m_ExternalDataAlignment;
+    const uint64_t offset = (m_ExternalDataSize + alignment - 1) / alignment * alignment;
+
+    m_ExternalPayloads.push_back({ memory, size, offset });
+    m_ExternalDataSize = offset + size;
+
+    return serializer::CreateExternalData(m_flatBufferBuilder, offset, size);
+}
+
 flatbuffers::Offset<serializer::ConstTensor>
     SerializerVisitor::CreateConstTensorInfo(const armnn::ConstTensor& constTensor)
 {
@@ -1398,9 +1480,57 @@ flatbuffers::Offset<serializer::ConstTensor>
                                                              GetFlatBufferDataType(tensorInfo.GetDataType()),
                                                              tensorInfo.GetQuantizationScale(),
                                                              tensorInfo.GetQuantizationOffset());
+    const bool isExternal = m_Options.m_ExternalConstantData &&
+                            constTensor.GetNumBytes() >= m_Options.m_ExternalDataMinimumSize;
+    const serializer::ConstTensorData payloadType = isExternal ?
+                                                    serializer::ConstTensorData::ConstTensorData_ExternalData :
+                                                    GetFlatBufferConstTensorData(tensorInfo.GetDataType());
+
+    // Equal payloads are stored once and referenced by all the tensors using them
+    const size_t hash = armnnUtils::GetTensorContentHash(tensorInfo, constTensor.GetMemoryArea());
+    flatbuffers::Offset<void> fbPayload = FindSerializedPayload(hash, constTensor, payloadType);
+    if (fbPayload.IsNull())
+    {
+        fbPayload = isExternal ? CreateExternalData(constTensor.GetMemoryArea(), constTensor.GetNumBytes()).o :
+                                 CreateDataPayload(constTensor);
+        m_SerializedPayloads.emplace(hash, SerializedPayload{ constTensor.GetMemoryArea(),
+                                                              constTensor.GetNumBytes(),
+                                                              payloadType,
+                                                              fbPayload });
+    }
+
+    flatbuffers::Offset<serializer::ConstTensor> flatBufferConstTensor = serializer::CreateConstTensor(
+            m_flatBufferBuilder,
+            flatBufferTensorInfo,
+            payloadType,
+            fbPayload);
+    return flatBufferConstTensor;
+}
+
+flatbuffers::Offset<void> SerializerVisitor::FindSerializedPayload(size_t hash,
+                                                                  const armnn::ConstTensor& constTensor,
+                                                                  serializer::ConstTensorData payloadType)
+{
+    auto range = m_SerializedPayloads.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        const SerializedPayload& payload = it->second;
+        // The payload union of the referencing tensor must hold a table of the same type, e.g. IntData
+        if (payload.m_PayloadType == payloadType &&
+            payload.m_NumBytes == constTensor.GetNumBytes() &&
+            std::memcmp(payload.m_Data, constTensor.GetMemoryArea(), payload.m_NumBytes) == 0)
+        {
+            return payload.m_Payload;
+        }
+    }
+    return flatbuffers::Offset<void>();
+}
+
+flatbuffers::Offset<void> SerializerVisitor::CreateDataPayload(const armnn::ConstTensor& constTensor)
+{
     flatbuffers::Offset<void> fbPayload;
 
-    switch (tensorInfo.GetDataType())
+    switch (constTensor.GetInfo().GetDataType())
     {
         case armnn::DataType::Float32:
         case armnn::DataType::Signed32:
@@ -1412,6 +1542,7 @@ flatbuffers::Offset<serializer::ConstTensor>
             fbPayload = flatBuffersData.o;
             break;
         }
+        case armnn::DataType::BFloat16:
         case armnn::DataType::Float16:
         {
             auto fbVector = CreateDataVector<int16_t>(constTensor.GetMemoryArea(), constTensor.GetNumBytes());
@@ -1441,12 +1572,7 @@ flatbuffers::Offset<serializer::ConstTensor>
             fbPayload = flatBuffersData.o;
         }
     }
-    flatbuffers::Offset<serializer::ConstTensor> flatBufferConstTensor = serializer::CreateConstTensor(
-            m_flatBufferBuilder,
-            flatBufferTensorInfo,
-            GetFlatBufferConstTensorData(tensorInfo.GetDataType()),
-            fbPayload);
-    return flatBufferConstTensor;
+    return fbPayload;
 }
 
 flatbuffers::Offset<armnnSerializer::FeatureCompatibilityVersions> SerializerVisitor::GetVersionTable()
@@ -1454,7 +1580,8 @@ flatbuffers::Offset<armnnSerializer::FeatureCompatibilityVersions> SerializerVis
     flatbuffers::Offset<armnnSerializer::FeatureCompatibilityVersions> versionsTable =
         serializer::CreateFeatureCompatibilityVersions(
                 m_flatBufferBuilder,
-                1 // Binding ids scheme version
+                1, // Binding ids scheme version
+                m_SerializeOptimizedNetwork ? 1 : 0 // Optimized network scheme version
             );
     return versionsTable;
 }
@@ -1475,8 +1602,25 @@ std::vector<fb::Offset<serializer::InputSlot>>
         // Create FlatBuffer Connection
         serializer::Connection conn(GetSerializedId(inputSlot.GetConnection()->GetOwningLayerGuid()),
                                     connection->CalculateIndexOnOwner());
+
+        // The memory strategy of an optimized network is stored on the connection's destination, which
+        // keeps it independent of the order the connections are restored in
+        serializer::EdgeStrategy edgeStrategy = serializer::EdgeStrategy::EdgeStrategy_Undefined;
+        if (m_SerializeOptimizedNetwork)
+        {
+            const armnn::InputSlot& optimizedInputSlot =
+                *boost::polymorphic_downcast<const armnn::InputSlot*>(&inputSlot);
+            const armnn::OutputSlot* source = optimizedInputSlot.GetConnectedOutputSlot();
+            const auto& sourceConnections = source->GetConnections();
+            auto it = std::find(sourceConnections.begin(), sourceConnections.end(), &optimizedInputSlot);
+            BOOST_ASSERT(it != sourceConnections.end());
+            const auto connectionIndex =
+                boost::numeric_cast<unsigned int>(std::distance(sourceConnections.begin(), it));
+            edgeStrategy = GetFlatBufferEdgeStrategy(source->GetEdgeStrategyForConnection(connectionIndex));
+        }
+
         // Create FlatBuffer InputSlot
-        inputSlots.push_back(serializer::CreateInputSlot(m_flatBufferBuilder, slotIndex, &conn));
+        inputSlots.push_back(serializer::CreateInputSlot(m_flatBufferBuilder, slotIndex, &conn, edgeStrategy));
     }
     return inputSlots;
 }
@@ -1506,10 +1650,19 @@ std::vector<fb::Offset<serializer::OutputSlot>>
                                                                  tensorInfo.GetQuantizationScale(),
                                                                  tensorInfo.GetQuantizationOffset());
 
+        fb::Offset<fb::String> fbTensorHandleFactoryId;
+        if (m_SerializeOptimizedNetwork)
+        {
+            const armnn::OutputSlot& optimizedOutputSlot =
+                *boost::polymorphic_downcast<const armnn::OutputSlot*>(&outputSlot);
+            fbTensorHandleFactoryId = m_flatBufferBuilder.CreateString(optimizedOutputSlot.GetTensorHandleFactoryId());
+        }
+
         // Create FlatBuffer Outputslot
         outputSlots.push_back(serializer::CreateOutputSlot(m_flatBufferBuilder,
                                                            slotIndex,
-                                                           flatBufferTensorInfo));
+                                                           flatBufferTensorInfo,
+                                                           fbTensorHandleFactoryId));
     }
     return outputSlots;
 }
@@ -1520,11 +1673,25 @@ ISerializer* ISerializer::CreateRaw()
     return new Serializer();
 }
 
+ISerializer* ISerializer::CreateRaw(const SerializerOptions& options)
+{
+    if (options.m_ExternalConstantData && options.m_ExternalDataAlignment == 0)
+    {
+        throw InvalidArgumentException("The alignment of the external data section must not be zero");
+    }
+    return new Serializer(options);
+}
+
 ISerializerPtr ISerializer::Create()
 {
     return ISerializerPtr(CreateRaw(), &ISerializer::Destroy);
 }
 
+ISerializerPtr ISerializer::Create(const SerializerOptions& options)
+{
+    return ISerializerPtr(CreateRaw(options), &ISerializer::Destroy);
+}
+
 void ISerializer::Destroy(ISerializer* serializer)
 {
     delete serializer;
@@ -1534,15 +1701,85 @@ void Serializer::Serialize(const INetwork& inNetwork)
 {
     // Iterate through to network
     inNetwork.Accept(m_SerializerVisitor);
+    FinishSerializedGraph();
+}
+
+void Serializer::Serialize(const armnn::IOptimizedNetwork& inNetwork)
+{
+    const armnn::OptimizedNetwork& optimizedNetwork =
+        *boost::polymorphic_downcast<const armnn::OptimizedNetwork*>(&inNetwork);
+
+    // Rejects the layers which cannot be stored before anything is serialized
+    for (const armnn::Layer* layer : optimizedNetwork.GetGraph())
+    {
+        switch (layer->GetType())
+        {
+            case armnn::LayerType::PreCompiled:
+                // Backend specific compiled subgraphs hold opaque state that cannot be stored
+                throw armnn::InvalidArgumentException(
+                    std::string("Cannot serialize the precompiled layer ") + layer->GetNameStr() +
+                    " of backend " + layer->GetBackendId().Get());
+            case armnn::LayerType::Debug:
+                // Debug layers are inserted by OptimizerOptions::m_Debug and have no serialized form
+                throw armnn::InvalidArgumentException(
+                    std::string("Cannot serialize the debug layer ") + layer->GetNameStr() +
+                    ", the network must be optimized without OptimizerOptions::m_Debug");
+            default:
+                break;
+        }
+    }
+
+    m_SerializerVisitor.SetSerializeOptimizedNetwork(true);
+
+    for (const armnn::Layer* layer : optimizedNetwork.GetGraph().TopologicalSort())
+    {
+        switch (layer->GetType())
+        {
+            case armnn::LayerType::MemCopy:
+            case armnn::LayerType::MemImport:
+            case armnn::LayerType::ConvertFp16ToFp32:
+            case armnn::LayerType::ConvertFp32ToFp16:
+            case armnn::LayerType::ConvertBf16ToFp32:
+            case armnn::LayerType::ConvertFp32ToBf16:
+                m_SerializerVisitor.VisitOptimizerInsertedLayer(layer, layer->GetType());
+                break;
+            default:
+                layer->Accept(m_SerializerVisitor);
+                break;
+        }
+    }
+
+    FinishSerializedGraph();
+}
+
+void Serializer::FinishSerializedGraph()
+{
     flatbuffers::FlatBufferBuilder& fbBuilder = m_SerializerVisitor.GetFlatBufferBuilder();
 
+    flatbuffers::Offset<serializer::OptimizedNetworkInfo> optimizedNetworkInfo;
+    if (m_SerializerVisitor.IsSerializingOptimizedNetwork())
+    {
+        optimizedNetworkInfo = serializer::CreateOptimizedNetworkInfo(fbBuilder, fbBuilder.CreateString(ARMNN_VERSION));
+    }
+
+    flatbuffers::Offset<serializer::ExternalDataSection> externalDataSection;
+    if (!m_SerializerVisitor.GetExternalPayloads().empty())
+    {
+        externalDataSection = serializer::CreateExternalDataSection(
+            fbBuilder,
+            m_SerializerVisitor.GetExternalDataSize(),
+            m_SerializerVisitor.GetOptions().m_ExternalDataAlignment);
+    }
+
     // Create FlatBuffer SerializedGraph
     auto serializedGraph = serializer::CreateSerializedGraph(
         fbBuilder,
         fbBuilder.CreateVector(m_SerializerVisitor.GetSerializedLayers()),
         fbBuilder.CreateVector(m_SerializerVisitor.GetInputIds()),
         fbBuilder.CreateVector(m_SerializerVisitor.GetOutputIds()),
-        m_SerializerVisitor.GetVersionTable());
+        m_SerializerVisitor.GetVersionTable(),
+        optimizedNetworkInfo,
+        externalDataSection);
 
     // Serialize the graph
     fbBuilder.Finish(serializedGraph);
@@ -1554,7 +1791,42 @@ bool Serializer::SaveSerializedToStream(std::ostream& stream)
 
     auto bytesToWrite = boost::numeric_cast<std::streamsize>(fbBuilder.GetSize());
     stream.write(reinterpret_cast<const char*>(fbBuilder.GetBufferPointer()), bytesToWrite);
+
+    const std::vector<SerializerVisitor::ExternalPayload>& payloads = m_SerializerVisitor.GetExternalPayloads();
+    if (!payloads.empty())
+    {
+        // The payloads are written one at a time from the memory of the network
+        const uint64_t alignment = m_SerializerVisitor.GetOptions().m_ExternalDataAlignment;
+        WritePadding(stream, fbBuilder.GetSize(), alignment);
+
+        uint64_t position = 0;
+        for (const SerializerVisitor::ExternalPayload& payload : payloads)
+        {
+            position = WritePadding(stream, position, alignment);
+            BOOST_ASSERT(position == payload.m_Offset);
+
+            stream.write(reinterpret_cast<const char*>(payload.m_Data),
+                         boost::numeric_cast<std::streamsize>(payload.m_NumBytes));
+            position += payload.m_NumBytes;
+        }
+        BOOST_ASSERT(position == m_SerializerVisitor.GetExternalDataSize());
+    }
     return !stream.bad();
 }
 
+uint64_t Serializer::WritePadding(std::ostream& stream, uint64_t position, uint64_t alignment)
+{
+    static const char zeros[256] = {};
+
+    uint64_t padding = (alignment - position % alignment) % alignment;
+    position += padding;
+    while (padding > 0)
+    {
+        const uint64_t bytesToWrite = std::min<uint64_t>(padding, sizeof(zeros));
+        stream.write(zeros, boost::numeric_cast<std::streamsize>(bytesToWrite));
+        padding -= bytesToWrite;
+    }
+    return position;
+}
+
 } // namespace armnnSerializer
@@ -21,9 +21,22 @@ namespace armnnSerializer
 class SerializerVisitor : public armnn::ILayerVisitor
 {
 public:
-    SerializerVisitor() : m_layerId(0) {}
+    SerializerVisitor(const SerializerOptions& options = SerializerOptions())
+        : m_Options(options)
+        , m_layerId(0)
+        , m_SerializeOptimizedNetwork(false)
+        , m_ExternalDataSize(0)
+    {}
     ~SerializerVisitor() {}
 
+    /// A constant tensor payload stored in the external data section, at the given offset from its start.
+    struct ExternalPayload
+    {
+        const void* m_Data;
+        uint64_t    m_NumBytes;
+        uint64_t    m_Offset;
+    };
+
     flatbuffers::FlatBufferBuilder& GetFlatBufferBuilder()
     {
         return m_flatBufferBuilder;
@@ -46,6 +59,36 @@ public:
 
     flatbuffers::Offset<armnnSerializer::FeatureCompatibilityVersions> GetVersionTable();
 
+    /// Also serializes the backend assignment and memory strategies of the layers of an optimized network.
+    void SetSerializeOptimizedNetwork(bool serializeOptimizedNetwork)
+    {
+        m_SerializeOptimizedNetwork = serializeOptimizedNetwork;
+    }
+
+    bool IsSerializingOptimizedNetwork() const
+    {
+        return m_SerializeOptimizedNetwork;
+    }
+
+    const std::vector<ExternalPayload>& GetExternalPayloads() const
+    {
+        return m_ExternalPayloads;
+    }
+
+    /// Size in bytes of the external data section, including the padding between the payloads.
+    uint64_t GetExternalDataSize() const
+    {
+        return m_ExternalDataSize;
+    }
+
+    const SerializerOptions& GetOptions() const
+    {
+        return m_Options;
+    }
+
+    /// Serializes the layers inserted by Optimize(), which cannot be visited as they are not part of INetwork.
+    void VisitOptimizerInsertedLayer(const armnn::IConnectableLayer* layer, armnn::LayerType layerType);
+
 
     ARMNN_DEPRECATED_MSG("Use VisitElementwiseUnaryLayer instead")
     void VisitAbsLayer(const armnn::IConnectableLayer* layer,
@@ -298,6 +341,20 @@ private:
     std::vector<flatbuffers::Offset<armnnSerializer::OutputSlot>> CreateOutputSlots(
             const armnn::IConnectableLayer* layer);
 
+    /// Returns the payload of the given type already serialized for a constant tensor with equal contents,
+    /// or a null offset.
+    flatbuffers::Offset<void> FindSerializedPayload(size_t hash,
+                                                    const armnn::ConstTensor& constTensor,
+                                                    armnnSerializer::ConstTensorData payloadType);
+
+    /// Creates the serializer payload of a constant tensor stored in the SerializedGraph.
+    flatbuffers::Offset<void> CreateDataPayload(const armnn::ConstTensor& constTensor);
+
+    /// Records the payload of a constant tensor to be written to the external data section.
+    flatbuffers::Offset<armnnSerializer::ExternalData> CreateExternalData(const void* memory, unsigned int size);
+
+    SerializerOptions m_Options;
+
     /// FlatBufferBuilder to create our layers' FlatBuffers.
     flatbuffers::FlatBufferBuilder m_flatBufferBuilder;
 
@@ -315,24 +372,53 @@ private:
 
     /// layer within our FlatBuffer index.
     uint32_t m_layerId;
+
+    /// Whether the runtime state of an optimized network is serialized.
+    bool m_SerializeOptimizedNetwork;
+
+    /// Payloads referenced by the SerializedGraph, in the order of their offsets.
+    std::vector<ExternalPayload> m_ExternalPayloads;
+
+    uint64_t m_ExternalDataSize;
+
+    /// A constant tensor payload already serialized, which can be referenced by other tensors.
+    struct SerializedPayload
+    {
+        const void*                      m_Data;
+        unsigned int                     m_NumBytes;
+        armnnSerializer::ConstTensorData m_PayloadType;
+        flatbuffers::Offset<void>        m_Payload;
+    };
+
+    /// Serialized payloads by hash of their content.
+    std::unordered_multimap<size_t, SerializedPayload> m_SerializedPayloads;
 };
 
 class Serializer : public ISerializer
 {
 public:
-    Serializer() {}
+    Serializer(const SerializerOptions& options = SerializerOptions()) : m_SerializerVisitor(options) {}
     ~Serializer() {}
 
     /// Serializes the network to ArmNN SerializedGraph.
     /// @param [in] inNetwork The network to be serialized.
     void Serialize(const armnn::INetwork& inNetwork) override;
 
-    /// Serializes the SerializedGraph to the stream.
+    /// Serializes the optimized network to ArmNN SerializedGraph.
+    /// @param [in] inNetwork The optimized network to be serialized.
+    void Serialize(const armnn::IOptimizedNetwork& inNetwork) override;
+
+    /// Serializes the SerializedGraph to the stream, followed by the external data section if any.
     /// @param [stream] the stream to save to
     /// @return true if graph is Serialized to the Stream, false otherwise
     bool SaveSerializedToStream(std::ostream& stream) override;
 
 private:
+    /// Writes zeros to the stream to advance it from the given position to the next multiple of the alignment.
+    static uint64_t WritePadding(std::ostream& stream, uint64_t position, uint64_t alignment);
+
+    /// Finishes the SerializedGraph from the layers serialized by the visitor.
+    void FinishSerializedGraph();
 
     /// Visitor to contruct serialized network
     SerializerVisitor m_SerializerVisitor;
@@ -35,6 +35,7 @@ armnnSerializer::ConstTensorData GetFlatBufferConstTensorData(armnn::DataType da
         case armnn::DataType::Float32:
         case armnn::DataType::Signed32:
             return armnnSerializer::ConstTensorData::ConstTensorData_IntData;
+        case armnn::DataType::BFloat16:
         case armnn::DataType::Float16:
         case armnn::DataType::QSymmS16:
             return armnnSerializer::ConstTensorData::ConstTensorData_ShortData;
@@ -54,6 +55,8 @@ armnnSerializer::DataType GetFlatBufferDataType(armnn::DataType dataType)
             return armnnSerializer::DataType::DataType_Float32;
         case armnn::DataType::Float16:
             return armnnSerializer::DataType::DataType_Float16;
+        case armnn::DataType::BFloat16:
+            return armnnSerializer::DataType::DataType_BFloat16;
         case armnn::DataType::Signed32:
             return armnnSerializer::DataType::DataType_Signed32;
         case armnn::DataType::QSymmS16:
@@ -79,6 +82,22 @@ armnnSerializer::DataLayout GetFlatBufferDataLayout(armnn::DataLayout dataLayout
     }
 }
 
+armnnSerializer::EdgeStrategy GetFlatBufferEdgeStrategy(armnn::EdgeStrategy edgeStrategy)
+{
+    switch (edgeStrategy)
+    {
+        case armnn::EdgeStrategy::DirectCompatibility:
+            return armnnSerializer::EdgeStrategy::EdgeStrategy_DirectCompatibility;
+        case armnn::EdgeStrategy::ExportToTarget:
+            return armnnSerializer::EdgeStrategy::EdgeStrategy_ExportToTarget;
+        case armnn::EdgeStrategy::CopyToTarget:
+            return armnnSerializer::EdgeStrategy::EdgeStrategy_CopyToTarget;
+        case armnn::EdgeStrategy::Undefined:
+        default:
+            return armnnSerializer::EdgeStrategy::EdgeStrategy_Undefined;
+    }
+}
+
 armnnSerializer::UnaryOperation GetFlatBufferUnaryOperation(armnn::UnaryOperation comparisonOperation)
 {
     switch (comparisonOperation)
@@ -0,0 +1,320 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Exceptions.hpp>
+#include <armnn/INetwork.hpp>
+#include <armnn/IRuntime.hpp>
+#include <armnn/Version.hpp>
+#include <armnnDeserializer/IDeserializer.hpp>
+
+#include "../Serializer.hpp"
+
+#include <Graph.hpp>
+#include <Network.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+#include <boost/assert.hpp>
+#include <boost/cast.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(SerializerTests)
+
+namespace
+{
+
+armnn::INetworkPtr CreateActivationNetwork(unsigned int numActivations = 1)
+{
+    armnn::TensorInfo info(armnn::TensorShape({1, 2, 2, 1}), armnn::DataType::Float32);
+
+    armnn::INetworkPtr network = armnn::INetwork::Create();
+
+    armnn::ActivationDescriptor descriptor;
+    descriptor.m_Function = armnn::ActivationFunction::ReLu;
+
+    armnn::IConnectableLayer* previousLayer = network->AddInputLayer(0, "input");
+    previousLayer->GetOutputSlot(0).SetTensorInfo(info);
+
+    for (unsigned int i = 0; i < numActivations; ++i)
+    {
+        const std::string name = i == 0 ? "activation" : "activation" + std::to_string(i);
+        armnn::IConnectableLayer* const activationLayer = network->AddActivationLayer(descriptor, name.c_str());
+
+        previousLayer->GetOutputSlot(0).Connect(activationLayer->GetInputSlot(0));
+        activationLayer->GetOutputSlot(0).SetTensorInfo(info);
+        previousLayer = activationLayer;
+    }
+
+    armnn::IConnectableLayer* const outputLayer = network->AddOutputLayer(0, "output");
+    previousLayer->GetOutputSlot(0).Connect(outputLayer->GetInputSlot(0));
+
+    return network;
+}
+
+std::vector<std::uint8_t> SaveToVector(armnnSerializer::Serializer& serializer)
+{
+    std::stringstream stream;
+    serializer.SaveSerializedToStream(stream);
+
+    std::string const serializerString{stream.str()};
+    return std::vector<std::uint8_t>{serializerString.begin(), serializerString.end()};
+}
+
+std::vector<std::uint8_t> SerializeOptimizedNetwork(const armnn::IOptimizedNetwork& optimized)
+{
+    armnnSerializer::Serializer serializer;
+    serializer.Serialize(optimized);
+    return SaveToVector(serializer);
+}
+
+// Replaces every occurrence of a string in a serialized network with another string of the same length
+void ReplaceString(std::vector<std::uint8_t>& serialized, const std::string& from, const std::string& to)
+{
+    BOOST_ASSERT(from.size() == to.size());
+
+    unsigned int numReplaced = 0;
+    for (auto it = std::search(serialized.begin(), serialized.end(), from.begin(), from.end());
+         it != serialized.end();
+         it = std::search(it, serialized.end(), from.begin(), from.end()))
+    {
+        it = std::copy(to.begin(), to.end(), it);
+        ++numReplaced;
+    }
+    BOOST_TEST(numReplaced > 0);
+}
+
+const armnn::Layer* FindLayer(const armnn::IOptimizedNetwork& optimized, const std::string& name)
+{
+    const armnn::Graph& graph = boost::polymorphic_downcast<const armnn::OptimizedNetwork*>(&optimized)->GetGraph();
+    auto it = std::find_if(graph.begin(), graph.end(), [&name](const armnn::Layer* layer)
+    {
+        return layer->GetNameStr() == name;
+    });
+    BOOST_TEST_REQUIRE((it != graph.end()), "Layer " + name + " not found");
+    return *it;
+}
+
+unsigned int CountLayers(const armnn::IOptimizedNetwork& optimized, armnn::LayerType type)
+{
+    const armnn::Graph& graph = boost::polymorphic_downcast<const armnn::OptimizedNetwork*>(&optimized)->GetGraph();
+    return boost::numeric_cast<unsigned int>(std::count_if(graph.begin(), graph.end(),
+                                                           [type](const armnn::Layer* layer)
+                                                           {
+                                                               return layer->GetType() == type;
+                                                           }));
+}
+
+// Loads an optimized network with a single ReLu activation and checks the results of an inference
+void CheckActivationInference(armnn::IRuntime& run, armnn::IOptimizedNetworkPtr optimized)
+{
+    armnn::NetworkId networkIdentifier;
+    BOOST_TEST(run.LoadNetwork(networkIdentifier, std::move(optimized)) == armnn::Status::Success);
+
+    std::vector<float> inputData {0.0f, -5.3f, 42.0f, -42.0f};
+    armnn::InputTensors inputTensors
+    {
+        {0, armnn::ConstTensor(run.GetInputTensorInfo(networkIdentifier, 0), inputData.data())}
+    };
+
+    std::vector<float> expectedOutputData {0.0f, 0.0f, 42.0f, 0.0f};
+
+    std::vector<float> outputData(4);
+    armnn::OutputTensors outputTensors
+    {
+        {0, armnn::Tensor(run.GetOutputTensorInfo(networkIdentifier, 0), outputData.data())}
+    };
+    run.EnqueueWorkload(networkIdentifier, inputTensors, outputTensors);
+    BOOST_CHECK_EQUAL_COLLECTIONS(outputData.begin(), outputData.end(),
+                                  expectedOutputData.begin(), expectedOutputData.end());
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(OptimizedNetworkSerialization)
+{
+    armnn::IRuntime::CreationOptions options; // default options
+    armnn::IRuntimePtr run = armnn::IRuntime::Create(options);
+
+    armnn::INetworkPtr network = CreateActivationNetwork();
+    armnn::IOptimizedNetworkPtr optimized = Optimize(*network, { armnn::Compute::CpuRef }, run->GetDeviceSpec());
+
+    const std::vector<std::uint8_t> serializerVector = SerializeOptimizedNetwork(*optimized);
+
+    // Loaded without running the optimizer again
+    armnnDeserializer::IDeserializerPtr parser = armnnDeserializer::IDeserializer::Create();
+    armnn::IOptimizedNetworkPtr deserializedOptimized = parser->CreateOptimizedNetworkFromBinary(serializerVector);
+
+    CheckActivationInference(*run, std::move(deserializedOptimized));
+}
+
+BOOST_AUTO_TEST_CASE(OptimizedNetworkWithConvertLayersSerialization)
+{
+    armnn::IRuntime::CreationOptions options; // default options
+    armnn::IRuntimePtr run = armnn::IRuntime::Create(options);
+
+    // Running the network in Fp16 inserts conversion layers around the activation
+    armnn::INetworkPtr network = CreateActivationNetwork();
+    armnn::IOptimizedNetworkPtr optimized = Optimize(*network, { armnn::Compute::CpuRef }, run->GetDeviceSpec(),
+                                                     armnn::OptimizerOptions(true, false));
+    BOOST_TEST(CountLayers(*optimized, armnn::LayerType::ConvertFp32ToFp16) == 1);
+    BOOST_TEST(CountLayers(*optimized, armnn::LayerType::ConvertFp16ToFp32) == 1);
+
+    const std::vector<std::uint8_t> serializerVector = SerializeOptimizedNetwork(*optimized);
+
+    armnnDeserializer::IDeserializerPtr parser = armnnDeserializer::IDeserializer::Create();
+    armnn::IOptimizedNetworkPtr deserializedOptimized = parser->CreateOptimizedNetworkFromBinary(serializerVector);
+
+    BOOST_TEST(CountLayers(*deserializedOptimized, armnn::LayerType::ConvertFp32ToFp16) == 1);
+    BOOST_TEST(CountLayers(*deserializedOptimized, armnn::LayerType::ConvertFp16ToFp32) == 1);
+    BOOST_TEST((FindLayer(*deserializedOptimized, "activation")->GetOutputSlot(0).GetTensorInfo().GetDataType() ==
+                armnn::DataType::Float16));
+
+    CheckActivationInference(*run, std::move(deserializedOptimized));
+}
+
+BOOST_AUTO_TEST_CASE(OptimizedNetworkWithMemCopyAndEdgeStrategiesSerialization)
+{
+    armnn::IRuntime::CreationOptions options; // default options
+    armnn::IRuntimePtr run = armnn::IRuntime::Create(options);
+
+    // Builds the graph Optimize() would produce for a copy between two backends, with every layer on CpuRef
+    armnn::TensorInfo info(armnn::TensorShape({1, 2, 2, 1}), armnn::DataType::Float32);
+    armnn::ActivationDescriptor descriptor;
+    descriptor.m_Function = armnn::ActivationFunction::ReLu;
+
+    auto graph = std::make_unique<armnn::Graph>();
+    armnn::Layer* const inputLayer      = graph->AddLayer<armnn::InputLayer>(0, "input");
+    armnn::Layer* const memCopyLayer    = graph->AddLayer<armnn::MemCopyLayer>("memcopy");
+    armnn::Layer* const activationLayer = graph->AddLayer<armnn::ActivationLayer>(descriptor, "activation");
+    armnn::Layer* const outputLayer     = graph->AddLayer<armnn::OutputLayer>(0, "output");
+
+    inputLayer->GetOutputSlot(0).Connect(memCopyLayer->GetInputSlot(0));
+    memCopyLayer->GetOutputSlot(0).Connect(activationLayer->GetInputSlot(0));
+    activationLayer->GetOutputSlot(0).Connect(outputLayer->GetInputSlot(0));
+
+    for (armnn::Layer* layer : *graph)
+    {
+        layer->SetBackendId(armnn::Compute::CpuRef);
+        if (layer->GetNumOutputSlots() == 1)
+        {
+            layer->GetOutputSlot(0).SetTensorInfo(info);
+            layer->GetOutputSlot(0).SetTensorHandleFactory(armnn::ITensorHandleFactory::LegacyFactoryId);
+        }
+    }
+
+    inputLayer->GetOutputSlot(0).SetEdgeStrategy(0, armnn::EdgeStrategy::CopyToTarget);
+    memCopyLayer->GetOutputSlot(0).SetEdgeStrategy(0, armnn::EdgeStrategy::DirectCompatibility);
+    activationLayer->GetOutputSlot(0).SetEdgeStrategy(0, armnn::EdgeStrategy::ExportToTarget);
+
+    armnn::OptimizedNetwork optimized(std::move(graph));
+    const std::vector<std::uint8_t> serializerVector = SerializeOptimizedNetwork(optimized);
+
+    armnnDeserializer::IDeserializerPtr parser = armnnDeserializer::IDeserializer::Create();
+    armnn::IOptimizedNetworkPtr deserializedOptimized = parser->CreateOptimizedNetworkFromBinary(serializerVector);
+
+    const armnn::Layer* memCopy = FindLayer(*deserializedOptimized, "memcopy");
+    BOOST_TEST((memCopy->GetType() == armnn::LayerType::MemCopy));
+    BOOST_TEST((memCopy->GetBackendId() == armnn::Compute::CpuRef));
+
+    BOOST_TEST((FindLayer(*deserializedOptimized, "input")->GetOutputSlot(0).GetEdgeStrategies() ==
+                std::vector<armnn::EdgeStrategy>{ armnn::EdgeStrategy::CopyToTarget }));
+    BOOST_TEST((memCopy->GetOutputSlot(0).GetEdgeStrategies() ==
+                std::vector<armnn::EdgeStrategy>{ armnn::EdgeStrategy::DirectCompatibility }));
+    BOOST_TEST((FindLayer(*deserializedOptimized, "activation")->GetOutputSlot(0).GetEdgeStrategies() ==
+                std::vector<armnn::EdgeStrategy>{ armnn::EdgeStrategy::ExportToTarget }));
+
+    CheckActivationInference(*run, std::move(deserializedOptimized));
+}
+
+BOOST_AUTO_TEST_CASE(OptimizedNetworkFromAnotherVersionIsRejected)
+{
+    armnn::IRuntime::CreationOptions options; // default options
+    armnn::IRuntimePtr run = armnn::IRuntime::Create(options);
+
+    armnn::INetworkPtr network = CreateActivationNetwork();
+    armnn::IOptimizedNetworkPtr optimized = Optimize(*network, { armnn::Compute::CpuRef }, run->GetDeviceSpec());
+
+    std::vector<std::uint8_t> serializerVector = SerializeOptimizedNetwork(*optimized);
+
+    std::string otherVersion = ARMNN_VERSION;
+    otherVersion.back() = otherVersion.back() == '0' ? '1' : '0';
+    ReplaceString(serializerVector, ARMNN_VERSION, otherVersion);
+
+    armnnDeserializer::IDeserializerPtr parser = armnnDeserializer::IDeserializer::Create();
+    BOOST_CHECK_THROW(parser->CreateOptimizedNetworkFromBinary(serializerVector), armnn::ParseException);
+}
+
+BOOST_AUTO_TEST_CASE(OptimizedNetworkForAnUnknownBackendIsRejected)
+{
+    armnn::IRuntime::CreationOptions options; // default options
+    armnn::IRuntimePtr run = armnn::IRuntime::Create(options);
+
+    armnn::INetworkPtr network = CreateActivationNetwork();
+    armnn::IOptimizedNetworkPtr optimized = Optimize(*network, { armnn::Compute::CpuRef }, run->GetDeviceSpec());
+
+    std::vector<std::uint8_t> serializerVector = SerializeOptimizedNetwork(*optimized);
+    ReplaceString(serializerVector, "CpuRef", "CpuXyz");
+
+    armnnDeserializer::IDeserializerPtr parser = armnnDeserializer::IDeserializer::Create();
+    BOOST_CHECK_THROW(parser->CreateOptimizedNetworkFromBinary(serializerVector), armnn::ParseException);
+}
+
+BOOST_AUTO_TEST_CASE(OptimizedNetworkWithPreCompiledLayersCannotBeSerialized)
+{
+    armnn::IRuntime::CreationOptions options; // default options
+    armnn::IRuntimePtr run = armnn::IRuntime::Create(options);
+
+    // CpuRef fuses the chain of activations into a single PreCompiled layer
+    armnn::INetworkPtr network = CreateActivationNetwork(2);
+    armnn::IOptimizedNetworkPtr optimized = Optimize(*network, { armnn::Compute::CpuRef }, run->GetDeviceSpec());
+    BOOST_TEST(CountLayers(*optimized, armnn::LayerType::PreCompiled) == 1);
+
+    armnnSerializer::Serializer serializer;
+    BOOST_CHECK_THROW(serializer.Serialize(*optimized), armnn::InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(OptimizedNetworkWithDebugLayersCannotBeSerialized)
+{
+    armnn::IRuntime::CreationOptions options; // default options
+    armnn::IRuntimePtr run = armnn::IRuntime::Create(options);
+
+    armnn::OptimizerOptions optimizerOptions;
+    optimizerOptions.m_Debug = true;
+
+    armnn::INetworkPtr network = CreateActivationNetwork();
+    armnn::IOptimizedNetworkPtr optimized = Optimize(*network, { armnn::Compute::CpuRef }, run->GetDeviceSpec(),
+                                                     optimizerOptions);
+    BOOST_TEST(CountLayers(*optimized, armnn::LayerType::Debug) > 0);
+
+    armnnSerializer::Serializer serializer;
+    BOOST_CHECK_THROW(serializer.Serialize(*optimized), armnn::InvalidArgumentException);
+
+    // The network is rejected before anything is serialized, so the serializer can still be used
+    armnn::IOptimizedNetworkPtr optimizedWithoutDebug = Optimize(*network, { armnn::Compute::CpuRef },
+                                                                 run->GetDeviceSpec());
+    serializer.Serialize(*optimizedWithoutDebug);
+    const std::vector<std::uint8_t> serializerVector = SaveToVector(serializer);
+
+    armnnDeserializer::IDeserializerPtr parser = armnnDeserializer::IDeserializer::Create();
+    CheckActivationInference(*run, parser->CreateOptimizedNetworkFromBinary(serializerVector));
+}
+
+BOOST_AUTO_TEST_CASE(UnoptimizedNetworkIsNotAnOptimizedNetwork)
+{
+    armnn::INetworkPtr network = CreateActivationNetwork();
+
+    armnnSerializer::Serializer serializer;
+    serializer.Serialize(*network);
+    const std::vector<std::uint8_t> serializerVector = SaveToVector(serializer);
+
+    armnnDeserializer::IDeserializerPtr parser = armnnDeserializer::IDeserializer::Create();
+    BOOST_CHECK_THROW(parser->CreateOptimizedNetworkFromBinary(serializerVector), armnn::ParseException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -12,6 +12,7 @@
 #include <armnn/QuantizedLstmParams.hpp>
 #include <armnnDeserializer/IDeserializer.hpp>
 
+#include <cstring>
 #include <random>
 #include <vector>
 
@@ -531,6 +532,188 @@ BOOST_AUTO_TEST_CASE(SerializeConstant)
     deserializedNetwork->Accept(verifier);
 }
 
+BOOST_AUTO_TEST_CASE(SerializeConstantExternalData)
+{
+    class ConstantLayerVerifier : public LayerVerifierBase
+    {
+    public:
+        ConstantLayerVerifier(const std::string& layerName,
+                              const std::vector<armnn::TensorInfo>& inputInfos,
+                              const std::vector<armnn::TensorInfo>& outputInfos,
+                              const armnn::ConstTensor& layerInput)
+            : LayerVerifierBase(layerName, inputInfos, outputInfos)
+            , m_LayerInput(layerInput) {}
+
+        void VisitConstantLayer(const armnn::IConnectableLayer* layer,
+                                const armnn::ConstTensor& input,
+                                const char* name) override
+        {
+            VerifyNameAndConnections(layer, name);
+            CompareConstTensor(input, m_LayerInput);
+        }
+
+        void VisitAdditionLayer(const armnn::IConnectableLayer*, const char*) override {}
+
+    private:
+        armnn::ConstTensor m_LayerInput;
+    };
+
+    const std::string layerName("constant");
+    const armnn::TensorInfo info({ 16, 16 }, armnn::DataType::Float32);
+
+    std::vector<float> constantData = GenerateRandomData<float>(info.GetNumElements());
+    armnn::ConstTensor constTensor(info, constantData);
+
+    armnn::INetworkPtr network(armnn::INetwork::Create());
+    armnn::IConnectableLayer* input = network->AddInputLayer(0);
+    armnn::IConnectableLayer* constant = network->AddConstantLayer(constTensor, layerName.c_str());
+    armnn::IConnectableLayer* add = network->AddAdditionLayer();
+    armnn::IConnectableLayer* output = network->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+    constant->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+    add->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(info);
+    constant->GetOutputSlot(0).SetTensorInfo(info);
+    add->GetOutputSlot(0).SetTensorInfo(info);
+
+    armnnSerializer::SerializerOptions options;
+    options.m_ExternalConstantData = true;
+    options.m_ExternalDataAlignment = 64;
+
+    armnnSerializer::Serializer serializer(options);
+    serializer.Serialize(*network);
+
+    std::stringstream stream;
+    serializer.SaveSerializedToStream(stream);
+    const std::string serializerString = stream.str();
+
+    // The payload is the external data section, written at an aligned offset after the flatbuffer
+    const size_t sectionStart = serializerString.size() - info.GetNumBytes();
+    BOOST_CHECK(sectionStart % 64 == 0);
+    BOOST_CHECK(std::memcmp(serializerString.data() + sectionStart, constantData.data(), info.GetNumBytes()) == 0);
+
+    armnn::INetworkPtr deserializedNetwork = DeserializeNetwork(serializerString);
+    BOOST_CHECK(deserializedNetwork);
+
+    ConstantLayerVerifier verifier(layerName, {}, {info}, constTensor);
+    deserializedNetwork->Accept(verifier);
+}
+
+BOOST_AUTO_TEST_CASE(SerializeDuplicateConstants)
+{
+    const armnn::TensorInfo info({ 16, 16 }, armnn::DataType::Float32);
+
+    std::vector<float> constantData = GenerateRandomData<float>(info.GetNumElements());
+    std::vector<float> duplicateData(constantData);
+
+    auto createNetwork = [&](bool addDuplicate)
+    {
+        armnn::INetworkPtr network(armnn::INetwork::Create());
+        armnn::IConnectableLayer* input = network->AddInputLayer(0);
+        armnn::IConnectableLayer* constant = network->AddConstantLayer(armnn::ConstTensor(info, constantData));
+        armnn::IConnectableLayer* add = network->AddAdditionLayer();
+        armnn::IConnectableLayer* output = network->AddOutputLayer(0);
+
+        input->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+        constant->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+        add->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+        input->GetOutputSlot(0).SetTensorInfo(info);
+        constant->GetOutputSlot(0).SetTensorInfo(info);
+        add->GetOutputSlot(0).SetTensorInfo(info);
+
+        if (addDuplicate)
+        {
+            armnn::IConnectableLayer* duplicate =
+                network->AddConstantLayer(armnn::ConstTensor(info, duplicateData), "duplicate");
+            armnn::IConnectableLayer* duplicateOutput = network->AddOutputLayer(1);
+            duplicate->GetOutputSlot(0).Connect(duplicateOutput->GetInputSlot(0));
+            duplicate->GetOutputSlot(0).SetTensorInfo(info);
+        }
+        return network;
+    };
+
+    armnn::INetworkPtr network = createNetwork(false);
+    armnn::INetworkPtr networkWithDuplicate = createNetwork(true);
+
+    const std::string serializerString = SerializeNetwork(*network);
+    const std::string serializerStringWithDuplicate = SerializeNetwork(*networkWithDuplicate);
+
+    // The payload of the duplicate constant is not stored again
+    BOOST_CHECK(serializerStringWithDuplicate.size() - serializerString.size() < info.GetNumBytes());
+
+    class ConstantLayerVerifier : public armnn::LayerVisitorBase<armnn::VisitorNoThrowPolicy>
+    {
+    public:
+        ConstantLayerVerifier(const armnn::ConstTensor& layerInput) : m_LayerInput(layerInput) {}
+
+        void VisitConstantLayer(const armnn::IConnectableLayer*, const armnn::ConstTensor& input, const char*) override
+        {
+            CompareConstTensor(input, m_LayerInput);
+        }
+
+    private:
+        armnn::ConstTensor m_LayerInput;
+    };
+
+    armnn::INetworkPtr deserializedNetwork = DeserializeNetwork(serializerStringWithDuplicate);
+    BOOST_CHECK(deserializedNetwork);
+
+    ConstantLayerVerifier verifier(armnn::ConstTensor(info, constantData));
+    deserializedNetwork->Accept(verifier);
+}
+
+BOOST_AUTO_TEST_CASE(SerializeEqualBytesOfDifferentTypes)
+{
+    // The same 64 bytes, seen as Float32 and as QAsymmU8 values, are stored in IntData and ByteData tables
+    const armnn::TensorInfo floatInfo({ 16 }, armnn::DataType::Float32);
+    const armnn::TensorInfo byteInfo({ 64 }, armnn::DataType::QAsymmU8, 1.0f, 0);
+
+    std::vector<float> constantData = GenerateRandomData<float>(floatInfo.GetNumElements());
+
+    armnn::INetworkPtr network(armnn::INetwork::Create());
+    armnn::IConnectableLayer* floatConstant =
+        network->AddConstantLayer(armnn::ConstTensor(floatInfo, constantData), "floatConstant");
+    armnn::IConnectableLayer* byteConstant =
+        network->AddConstantLayer(armnn::ConstTensor(byteInfo, constantData.data()), "byteConstant");
+    armnn::IConnectableLayer* floatOutput = network->AddOutputLayer(0);
+    armnn::IConnectableLayer* byteOutput = network->AddOutputLayer(1);
+
+    floatConstant->GetOutputSlot(0).Connect(floatOutput->GetInputSlot(0));
+    byteConstant->GetOutputSlot(0).Connect(byteOutput->GetInputSlot(0));
+    floatConstant->GetOutputSlot(0).SetTensorInfo(floatInfo);
+    byteConstant->GetOutputSlot(0).SetTensorInfo(byteInfo);
+
+    class ConstantLayerVerifier : public armnn::LayerVisitorBase<armnn::VisitorNoThrowPolicy>
+    {
+    public:
+        ConstantLayerVerifier(const armnn::ConstTensor& floatInput, const armnn::ConstTensor& byteInput)
+            : m_FloatInput(floatInput)
+            , m_ByteInput(byteInput)
+        {}
+
+        void VisitConstantLayer(const armnn::IConnectableLayer*,
+                                const armnn::ConstTensor& input,
+                                const char* name) override
+        {
+            CompareConstTensor(input, std::string(name) == "floatConstant" ? m_FloatInput : m_ByteInput);
+        }
+
+    private:
+        armnn::ConstTensor m_FloatInput;
+        armnn::ConstTensor m_ByteInput;
+    };
+
+    armnn::INetworkPtr deserializedNetwork = DeserializeNetwork(SerializeNetwork(*network));
+    BOOST_CHECK(deserializedNetwork);
+
+    ConstantLayerVerifier verifier(armnn::ConstTensor(floatInfo, constantData),
+                                   armnn::ConstTensor(byteInfo, constantData.data()));
+    deserializedNetwork->Accept(verifier);
+}
+
 BOOST_AUTO_TEST_CASE(SerializeConvolution2d)
 {
     using Descriptor = armnn::Convolution2dDescriptor;
@@ -14,6 +14,8 @@
 // armnnUtils:
 #include <armnnUtils/Permute.hpp>
 
+#include <MemoryMappedFile.hpp>
+#include <Network.hpp>
 #include <ParserHelper.hpp>
 #include <VerificationHelpers.hpp>
 
@@ -26,6 +28,7 @@
 #include <boost/assert.hpp>
 #include <boost/format.hpp>
 #include <boost/numeric/conversion/cast.hpp>
+#include <boost/polymorphic_cast.hpp>
 
 #include <fstream>
 #include <algorithm>
@@ -202,12 +205,12 @@ void CheckBuffer(const TfLiteParser::ModelPtr & model,
 #define CHECK_BUFFER(MODEL, BUFFER_INDEX) \
     CheckBuffer(MODEL, BUFFER_INDEX, CHECK_LOCATION())
 
-void CheckBufferSize(TfLiteParser::BufferRawPtr bufferPtr,
+void CheckBufferSize(const TfLiteParser::BufferData& buffer,
                      const armnn::TensorInfo & tensorInfo,
                      uint32_t bufferId,
                      const CheckLocation & location)
 {
-    if (bufferPtr == nullptr)
+    if (buffer.m_Data == nullptr)
     {
         throw ParseException(
             boost::str(
@@ -215,11 +218,11 @@ void CheckBufferSize(TfLiteParser::BufferRawPtr bufferPtr,
                               bufferId %
                               location.AsString()));
     }
-    else if(tensorInfo.GetNumElements() > bufferPtr->data.size() ||
-            tensorInfo.GetNumBytes() > bufferPtr->data.size())
+    else if(tensorInfo.GetNumElements() > buffer.m_Size ||
+            tensorInfo.GetNumBytes() > buffer.m_Size)
     {
         std::stringstream ss;
-        ss << "Buffer #" << bufferId << " has " << bufferPtr->data.size() << " bytes. "
+        ss << "Buffer #" << bufferId << " has " << buffer.m_Size << " bytes. "
            << "For tensor: " << tensorInfo.GetShape()
            << " expecting: " << tensorInfo.GetNumBytes() << " bytes and "
            << tensorInfo.GetNumElements() << " elements. " << location.AsString();
@@ -227,8 +230,8 @@ void CheckBufferSize(TfLiteParser::BufferRawPtr bufferPtr,
     }
 }
 
-#define CHECK_BUFFER_SIZE(BUFFER_PTR, TENSOR_INFO, BUFFER_ID) \
-    CheckBufferSize(BUFFER_PTR, TENSOR_INFO, BUFFER_ID, CHECK_LOCATION())
+#define CHECK_BUFFER_SIZE(BUFFER, TENSOR_INFO, BUFFER_ID) \
+    CheckBufferSize(BUFFER, TENSOR_INFO, BUFFER_ID, CHECK_LOCATION())
 
 bool IsActivationSupported(tflite::ActivationFunctionType activationType)
 {
@@ -421,33 +424,59 @@ armnn::TensorInfo ToTensorInfo(TfLiteParser::TensorRawPtr tensorPtr,
 
 template<typename T>
 std::pair<armnn::ConstTensor, std::unique_ptr<T[]>>
-CreateConstTensorImpl(TfLiteParser::BufferRawPtr bufferPtr,
+CreateConstTensorImpl(const TfLiteParser::BufferData& buffer,
                       TfLiteParser::TensorRawPtr tensorPtr,
                       armnn::TensorInfo& tensorInfo,
                       armnn::Optional<armnn::PermutationVector&> permutationVector)
 {
     boost::ignore_unused(tensorPtr);
     BOOST_ASSERT_MSG(tensorPtr != nullptr, "tensorPtr is null");
-    BOOST_ASSERT_MSG(bufferPtr != nullptr,
+    BOOST_ASSERT_MSG(buffer.m_Data != nullptr,
         boost::str(
             boost::format("Buffer for buffer:%1% is null") % tensorPtr->buffer).c_str());
 
+    const bool isPermuted = permutationVector.has_value() && permutationVector.value().GetSize() > 0;
+    const bool isAligned  = reinterpret_cast<uintptr_t>(buffer.m_Data) % alignof(T) == 0;
+    if (!isPermuted && isAligned)
+    {
+        // The tensor references the flatbuffer, which outlives the parsing of the model
+        return std::make_pair(ConstTensor(tensorInfo, buffer.m_Data), std::unique_ptr<T[]>());
+    }
+
     std::unique_ptr<T[]> data(new T[tensorInfo.GetNumElements()]);
 
-    if (permutationVector.has_value() && permutationVector.value().GetSize() > 0)
+    if (isPermuted)
     {
         tensorInfo = armnnUtils::Permuted(tensorInfo, permutationVector.value());
         armnnUtils::Permute(tensorInfo.GetShape(), permutationVector.value(),
-                            reinterpret_cast<const T*>(bufferPtr->data.data()), data.get(), sizeof(T));
+                            reinterpret_cast<const T*>(buffer.m_Data), data.get(), sizeof(T));
     }
     else
     {
-        ::memcpy(data.get(), bufferPtr->data.data(), tensorInfo.GetNumBytes());
+        ::memcpy(data.get(), buffer.m_Data, tensorInfo.GetNumBytes());
     }
 
     return std::make_pair(ConstTensor(tensorInfo, data.get()), std::move(data));
 }
 
+void VerifyModel(const uint8_t * binaryContent, size_t len)
+{
+    if (binaryContent == nullptr)
+     {
+        throw InvalidArgumentException(boost::str(boost::format("Invalid (null) binary content %1%") %
+                                       CHECK_LOCATION().AsString()));
+     }
+    flatbuffers::Verifier verifier(binaryContent, len);
+    if (verifier.VerifyBuffer<tflite::Model>() == false)
+    {
+        throw ParseException(
+            boost::str(boost::format("Buffer doesn't conform to the expected Tensorflow Lite "
+                                     "flatbuffers format. size:%1% %2%") %
+                       len %
+                       CHECK_LOCATION().AsString()));
+    }
+}
+
 armnn::LayerBindingId GenerateLayerBindingId(size_t subgraphIndex, size_t tensorIndex)
 {
     // generate the binding id by shifting the tensor id by 8 bit
@@ -480,6 +509,7 @@ bool CheckShape(const armnn::TensorShape& actual, const std::vector<int32_t>& ex
 TfLiteParser::TfLiteParser(const Optional<ITfLiteParser::TfLiteParserOptions>& options)
 : m_Options(options)
 , m_Network(nullptr, nullptr)
+, m_FlatBufferModel(nullptr)
 , m_ParserFunctions(tflite::BuiltinOperator_MAX+1, &TfLiteParser::ParseUnsupportedOperator)
 {
     // register supported operators
@@ -527,6 +557,8 @@ void TfLiteParser::ResetParser()
 {
     m_Network = armnn::INetworkPtr(nullptr, nullptr);
     m_Model = nullptr;
+    m_FlatBufferModel = nullptr;
+    m_MappedFile.reset();
     m_SubgraphConnections.clear();
 }
 
@@ -590,21 +622,43 @@ void TfLiteParser::AddBroadcastReshapeLayer(size_t subgraphIndex,
 INetworkPtr TfLiteParser::CreateNetworkFromBinaryFile(const char* graphFile)
 {
     ResetParser();
-    m_Model = LoadModelFromFile(graphFile);
-    return CreateNetworkFromModel();
+    if (graphFile == nullptr)
+    {
+        throw InvalidArgumentException(boost::str(boost::format("Invalid (null) file name %1%") %
+                                       CHECK_LOCATION().AsString()));
+    }
+
+    // The constant tensors of the network reference the mapped file, which is kept alive by the layers using them
+    m_MappedFile = std::make_shared<const armnnUtils::MemoryMappedFile>(graphFile);
+    INetworkPtr network = CreateNetworkFromFlatBuffer(m_MappedFile->GetData(), m_MappedFile->GetSize());
+    m_MappedFile.reset();
+    return network;
 }
 
 INetworkPtr TfLiteParser::CreateNetworkFromBinary(const std::vector<uint8_t> & binaryContent)
 {
     ResetParser();
-    m_Model = LoadModelFromBinary(binaryContent.data(), binaryContent.size());
-    return CreateNetworkFromModel();
+    return CreateNetworkFromFlatBuffer(binaryContent.data(), binaryContent.size());
+}
+
+INetworkPtr TfLiteParser::CreateNetworkFromFlatBuffer(const uint8_t* binaryContent, size_t len)
+{
+    m_Model = LoadModelStructureFromBinary(binaryContent, len);
+    m_FlatBufferModel = tflite::GetModel(binaryContent);
+    INetworkPtr network = CreateNetworkFromModel();
+    m_FlatBufferModel = nullptr;
+    return network;
 }
 
 INetworkPtr TfLiteParser::CreateNetworkFromModel()
 {
     m_Network = INetwork::Create();
     BOOST_ASSERT(m_Model.get() != nullptr);
+    if (m_MappedFile)
+    {
+        boost::polymorphic_downcast<armnn::Network*>(m_Network.get())->AddConstTensorStorage(
+            m_MappedFile, m_MappedFile->GetData(), m_MappedFile->GetSize());
+    }
 
     bool failedToCreate = false;
     std::stringstream errors;
@@ -1016,10 +1070,10 @@ void TfLiteParser::ParseTranspose(size_t subgraphIndex, size_t operatorIndex)
     if (inputs.size() == 2)
     {
         armnn::TensorInfo permuteTensorInfo = ToTensorInfo(inputs[1]);
-        BufferRawPtr permuteBufferPtr = GetBuffer(m_Model, inputs[1]->buffer);
+        BufferData permuteBuffer = GetBufferData(inputs[1]->buffer);
         auto numPermVecElements = permuteTensorInfo.GetNumElements();
         std::vector<unsigned int> permuteShape(numPermVecElements);
-        ::memcpy(permuteShape.data(), permuteBufferPtr->data.data(), permuteTensorInfo.GetNumBytes());
+        ::memcpy(permuteShape.data(), permuteBuffer.m_Data, permuteTensorInfo.GetNumBytes());
 
         // permuteShape assumes Tf/Np permute vectors, we must translate to armnn expected form
         // to do so we find the perm vector which would invert what a tf perm vector would do (ex 3,0,1,2 -> 1,2,3,0)
@@ -1136,16 +1190,16 @@ void TfLiteParser::ParseBatchToSpaceND(size_t subgraphIndex, size_t operatorInde
     CHECK_VALID_SIZE(outputs.size(), 1);
 
     armnn::TensorInfo blockShapeTensorInfo = ToTensorInfo(inputs[1]);
-    BufferRawPtr blockShapeBufferPtr = GetBuffer(m_Model, inputs[1]->buffer);
+    BufferData blockShapeBuffer = GetBufferData(inputs[1]->buffer);
 
     armnn::TensorInfo cropsTensorInfo = ToTensorInfo(inputs[2]);
-    BufferRawPtr cropsBufferPtr = GetBuffer(m_Model, inputs[2]->buffer);
+    BufferData cropsBuffer = GetBufferData(inputs[2]->buffer);
 
     std::vector<unsigned int> blockShape(blockShapeTensorInfo.GetNumElements());
-    ::memcpy(blockShape.data(), blockShapeBufferPtr->data.data(), blockShapeTensorInfo.GetNumBytes());
+    ::memcpy(blockShape.data(), blockShapeBuffer.m_Data, blockShapeTensorInfo.GetNumBytes());
 
     std::vector<unsigned int> cropsVector(cropsTensorInfo.GetNumElements());
-    ::memcpy(cropsVector.data(), cropsBufferPtr->data.data(), cropsTensorInfo.GetNumBytes());
+    ::memcpy(cropsVector.data(), cropsBuffer.m_Data, cropsTensorInfo.GetNumBytes());
 
     size_t step = 2;
     std::vector<std::pair<unsigned int, unsigned int>> crops;
@@ -1356,17 +1410,17 @@ void TfLiteParser::ParseSlice(size_t subgraphIndex, size_t operatorIndex)
 
     // set begin tensor info for slice descriptor
     armnn::TensorInfo beginTensorInfo = ToTensorInfo(inputs[1]);
-    BufferRawPtr beginBufferPtr = GetBuffer(m_Model, inputs[1]->buffer);
+    BufferData beginBuffer = GetBufferData(inputs[1]->buffer);
 
     std::vector<unsigned int> begin(beginTensorInfo.GetNumElements());
-    ::memcpy(begin.data(), beginBufferPtr->data.data(), beginTensorInfo.GetNumBytes());
+    ::memcpy(begin.data(), beginBuffer.m_Data, beginTensorInfo.GetNumBytes());
 
     // set size tensor info for slice descriptor
     armnn::TensorInfo sizeTensorInfo = ToTensorInfo(inputs[2]);
-    BufferRawPtr sizeBufferPtr = GetBuffer(m_Model, inputs[2]->buffer);
+    BufferData sizeBuffer = GetBufferData(inputs[2]->buffer);
 
     std::vector<unsigned int> size(sizeTensorInfo.GetNumElements());
-    ::memcpy(size.data(), sizeBufferPtr->data.data(), sizeTensorInfo.GetNumBytes());
+    ::memcpy(size.data(), sizeBuffer.m_Data, sizeTensorInfo.GetNumBytes());
     desc = SliceDescriptor(begin, size);
 
     auto layerName = boost::str(boost::format("Slice:%1%:%2%") % subgraphIndex % operatorIndex);
@@ -1426,16 +1480,16 @@ void TfLiteParser::ParseSpaceToBatchND(size_t subgraphIndex, size_t operatorInde
     CHECK_VALID_SIZE(outputs.size(), 1);
 
     armnn::TensorInfo blockShapeTensorInfo = ToTensorInfo(inputs[1]);
-    BufferRawPtr blockShapeBufferPtr = GetBuffer(m_Model, inputs[1]->buffer);
+    BufferData blockShapeBuffer = GetBufferData(inputs[1]->buffer);
 
     armnn::TensorInfo padListTensorInfo = ToTensorInfo(inputs[2]);
-    BufferRawPtr padListBufferPtr = GetBuffer(m_Model, inputs[2]->buffer);
+    BufferData padListBuffer = GetBufferData(inputs[2]->buffer);
 
     std::vector<unsigned int> blockShape(blockShapeTensorInfo.GetNumElements());
-    ::memcpy(blockShape.data(), blockShapeBufferPtr->data.data(), blockShapeTensorInfo.GetNumBytes());
+    ::memcpy(blockShape.data(), blockShapeBuffer.m_Data, blockShapeTensorInfo.GetNumBytes());
 
     std::vector<unsigned int> padListVector(padListTensorInfo.GetNumElements());
-    ::memcpy(padListVector.data(), padListBufferPtr->data.data(), padListTensorInfo.GetNumBytes());
+    ::memcpy(padListVector.data(), padListBuffer.m_Data, padListTensorInfo.GetNumBytes());
 
     size_t step = 2;
     std::vector<std::pair<unsigned int, unsigned int>> padList;
@@ -1569,22 +1623,22 @@ void TfLiteParser::ParseStridedSlice(size_t subgraphIndex, size_t operatorIndex)
     desc.m_DataLayout = armnn::DataLayout::NHWC;
 
     armnn::TensorInfo beginTensorInfo = ToTensorInfo(inputs[1]);
-    BufferRawPtr beginBufferPtr = GetBuffer(m_Model, inputs[1]->buffer);
+    BufferData beginBuffer = GetBufferData(inputs[1]->buffer);
 
     std::vector<int> begin(beginTensorInfo.GetNumElements());
-    ::memcpy(begin.data(), beginBufferPtr->data.data(), beginTensorInfo.GetNumBytes());
+    ::memcpy(begin.data(), beginBuffer.m_Data, beginTensorInfo.GetNumBytes());
 
     armnn::TensorInfo endTensorInfo = ToTensorInfo(inputs[2]);
-    BufferRawPtr endBufferPtr = GetBuffer(m_Model, inputs[2]->buffer);
+    BufferData endBuffer = GetBufferData(inputs[2]->buffer);
 
     std::vector<int> end(endTensorInfo.GetNumElements());
-    ::memcpy(end.data(), endBufferPtr->data.data(), endTensorInfo.GetNumBytes());
+    ::memcpy(end.data(), endBuffer.m_Data, endTensorInfo.GetNumBytes());
 
     armnn::TensorInfo strideTensorInfo = ToTensorInfo(inputs[3]);
-    BufferRawPtr strideBufferPtr = GetBuffer(m_Model, inputs[3]->buffer);
+    BufferData strideBuffer = GetBufferData(inputs[3]->buffer);
 
     std::vector<int> stride(strideTensorInfo.GetNumElements());
-    ::memcpy(stride.data(), strideBufferPtr->data.data(), strideTensorInfo.GetNumBytes());
+    ::memcpy(stride.data(), strideBuffer.m_Data, strideTensorInfo.GetNumBytes());
 
     desc.m_Begin = begin;
     desc.m_End = end;
@@ -1727,11 +1781,11 @@ void TfLiteParser::ParseMean(size_t subgraphIndex, size_t operatorIndex)
     CHECK_VALID_SIZE(outputs.size(), 1);
 
     armnn::TensorInfo dimTensorInfo = ToTensorInfo(inputs[1]);
-    BufferRawPtr bufferPtr = GetBuffer(m_Model, inputs[1]->buffer);
+    BufferData buffer = GetBufferData(inputs[1]->buffer);
 
     armnn::MeanDescriptor desc;
     std::vector<unsigned int> axis(dimTensorInfo.GetNumElements());
-    ::memcpy(axis.data(), bufferPtr->data.data(), dimTensorInfo.GetNumBytes());
+    ::memcpy(axis.data(), buffer.m_Data, dimTensorInfo.GetNumBytes());
     desc.m_Axis = axis;
 
     armnn::TensorInfo inputTensorInfo  = ToTensorInfo(inputs[0]);
@@ -1763,10 +1817,10 @@ void TfLiteParser::ParsePad(size_t subgraphIndex, size_t operatorIndex)
     CHECK_VALID_SIZE(outputs.size(), 1);
 
     armnn::TensorInfo padTensorInfo = ToTensorInfo(inputs[1]);
-    BufferRawPtr bufferPtr = GetBuffer(m_Model, inputs[1]->buffer);
+    BufferData buffer = GetBufferData(inputs[1]->buffer);
 
     std::vector<unsigned int> padBuffer(padTensorInfo.GetNumElements());
-    ::memcpy(padBuffer.data(), bufferPtr->data.data(), padTensorInfo.GetNumBytes());
+    ::memcpy(padBuffer.data(), buffer.m_Data, padTensorInfo.GetNumBytes());
 
     size_t step = 2;
     armnn::PadDescriptor desc;
@@ -1999,8 +2053,8 @@ void TfLiteParser::ParseResize(size_t subgraphIndex, size_t operatorIndex, Resiz
     // Data for the parsed tensor args (size) must be stored locally.
     std::vector<int32_t> sizeTensorData(sizeTensorInfo.GetNumElements());
 
-    BufferRawPtr sizeBufferPtr = GetBuffer(m_Model, inputs[1]->buffer);
-    ::memcpy(sizeTensorData.data(), sizeBufferPtr->data.data(), sizeTensorInfo.GetNumBytes());
+    BufferData sizeBuffer = GetBufferData(inputs[1]->buffer);
+    ::memcpy(sizeTensorData.data(), sizeBuffer.m_Data, sizeTensorInfo.GetNumBytes());
 
     ResizeDescriptor desc;
     desc.m_Method       = resizeMethod;
@@ -2458,9 +2512,9 @@ void TfLiteParser::ParseSplit(size_t subgraphIndex, size_t operatorIndex)
     armnn::TensorInfo inputTensorInfo  = ToTensorInfo(inputs[1]);
     armnn::TensorInfo axisTensorInfo = ToTensorInfo(inputs[0]);
 
-    BufferRawPtr axisBufferPtr = GetBuffer(m_Model, inputs[0]->buffer);
+    BufferData axisBuffer = GetBufferData(inputs[0]->buffer);
     std::vector<unsigned int> axisData(axisTensorInfo.GetNumElements());
-    ::memcpy(axisData.data(), axisBufferPtr->data.data(), axisTensorInfo.GetNumBytes());
+    ::memcpy(axisData.data(), axisBuffer.m_Data, axisTensorInfo.GetNumBytes());
 
     BOOST_ASSERT(axisTensorInfo.GetNumElements() == 1);
     const unsigned int splitDim = axisData[0];
@@ -2616,21 +2670,44 @@ TfLiteParser::ModelPtr TfLiteParser::LoadModelFromFile(const char * fileName)
 
 TfLiteParser::ModelPtr TfLiteParser::LoadModelFromBinary(const uint8_t * binaryContent, size_t len)
 {
-    if (binaryContent == nullptr)
-     {
-        throw InvalidArgumentException(boost::str(boost::format("Invalid (null) binary content %1%") %
-                                       CHECK_LOCATION().AsString()));
-     }
-    flatbuffers::Verifier verifier(binaryContent, len);
-    if (verifier.VerifyBuffer<tflite::Model>() == false)
+    VerifyModel(binaryContent, len);
+    return tflite::UnPackModel(binaryContent);
+}
+
+TfLiteParser::ModelPtr TfLiteParser::LoadModelStructureFromBinary(const uint8_t * binaryContent, size_t len)
+{
+    VerifyModel(binaryContent, len);
+    const tflite::Model* flatBufferModel = tflite::GetModel(binaryContent);
+
+    // Same as tflite::UnPackModel, except for the contents of the buffers, which can be hundreds of megabytes
+    ModelPtr model = std::make_unique<tflite::ModelT>();
+    model->version = flatBufferModel->version();
+    if (flatBufferModel->operator_codes() != nullptr)
     {
-        throw ParseException(
-            boost::str(boost::format("Buffer doesn't conform to the expected Tensorflow Lite "
-                                     "flatbuffers format. size:%1% %2%") %
-                       len %
-                       CHECK_LOCATION().AsString()));
+        for (const tflite::OperatorCode* operatorCode : *flatBufferModel->operator_codes())
+        {
+            model->operator_codes.emplace_back(operatorCode->UnPack());
+        }
     }
-    return tflite::UnPackModel(binaryContent);
+    if (flatBufferModel->subgraphs() != nullptr)
+    {
+        for (const tflite::SubGraph* subgraph : *flatBufferModel->subgraphs())
+        {
+            model->subgraphs.emplace_back(subgraph->UnPack());
+        }
+    }
+    if (flatBufferModel->description() != nullptr)
+    {
+        model->description = flatBufferModel->description()->str();
+    }
+    if (flatBufferModel->buffers() != nullptr)
+    {
+        for (flatbuffers::uoffset_t i = 0; i < flatBufferModel->buffers()->size(); ++i)
+        {
+            model->buffers.emplace_back(std::make_unique<tflite::BufferT>());
+        }
+    }
+    return model;
 }
 
 TfLiteParser::TensorRawPtrVector TfLiteParser::GetInputs(const ModelPtr & model,
@@ -2858,14 +2935,28 @@ TfLiteParser::BufferRawPtr TfLiteParser::GetBuffer(const ModelPtr& model, size_t
     return model->buffers[bufferIndex].get();
 }
 
+TfLiteParser::BufferData TfLiteParser::GetBufferData(size_t bufferIndex) const
+{
+    CHECK_BUFFER(m_Model, bufferIndex);
+    if (m_FlatBufferModel != nullptr)
+    {
+        // The buffers of the unpacked model are empty, their contents are only in the flatbuffer
+        auto data = m_FlatBufferModel->buffers()->Get(boost::numeric_cast<flatbuffers::uoffset_t>(bufferIndex))->data();
+        return data != nullptr ? BufferData{ data->data(), data->size() } : BufferData{ nullptr, 0 };
+    }
+
+    const std::vector<uint8_t>& data = m_Model->buffers[bufferIndex]->data;
+    return BufferData{ data.data(), data.size() };
+}
+
 template<typename T>
 std::pair<armnn::ConstTensor, TfLiteParser::SupportedDataStorage>
-TfLiteParser::CreateConstTensorAndStoreData(TfLiteParser::BufferRawPtr bufferPtr,
+TfLiteParser::CreateConstTensorAndStoreData(const TfLiteParser::BufferData& buffer,
                                             TfLiteParser::TensorRawPtr tensorPtr,
                                             armnn::TensorInfo& tensorInfo,
                                             armnn::Optional<armnn::PermutationVector&> permutationVector)
 {
-    auto constData = CreateConstTensorImpl<T>(bufferPtr,
+    auto constData = CreateConstTensorImpl<T>(buffer,
                                               tensorPtr,
                                               tensorInfo,
                                               permutationVector);
@@ -2879,33 +2970,33 @@ TfLiteParser::CreateConstTensor(TensorRawPtr tensorPtr,
                                 armnn::Optional<armnn::PermutationVector&> permutationVector)
 {
     CHECK_TENSOR_PTR(tensorPtr);
-    auto bufferPtr = GetBuffer(m_Model, tensorPtr->buffer);
-    CHECK_BUFFER_SIZE(bufferPtr, tensorInfo, tensorPtr->buffer);
+    BufferData buffer = GetBufferData(tensorPtr->buffer);
+    CHECK_BUFFER_SIZE(buffer, tensorInfo, tensorPtr->buffer);
 
     switch (tensorInfo.GetDataType())
     {
         case armnn::DataType::Float32:
-            return CreateConstTensorAndStoreData<float>(bufferPtr,
+            return CreateConstTensorAndStoreData<float>(buffer,
                                                         tensorPtr,
                                                         tensorInfo,
                                                         permutationVector);
         case armnn::DataType::QAsymmU8:
-            return CreateConstTensorAndStoreData<uint8_t>(bufferPtr,
+            return CreateConstTensorAndStoreData<uint8_t>(buffer,
                                                           tensorPtr,
                                                           tensorInfo,
                                                           permutationVector);
         case armnn::DataType::QSymmS8:
-            return CreateConstTensorAndStoreData<int8_t>(bufferPtr,
+            return CreateConstTensorAndStoreData<int8_t>(buffer,
                                                          tensorPtr,
                                                          tensorInfo,
                                                          permutationVector);
         case armnn::DataType::QAsymmS8:
-            return CreateConstTensorAndStoreData<int8_t>(bufferPtr,
+            return CreateConstTensorAndStoreData<int8_t>(buffer,
                                                          tensorPtr,
                                                          tensorInfo,
                                                          permutationVector);
         case armnn::DataType::Signed32:
-            return CreateConstTensorAndStoreData<int32_t>(bufferPtr,
+            return CreateConstTensorAndStoreData<int32_t>(buffer,
                                                           tensorPtr,
                                                           tensorInfo,
                                                           permutationVector);
@@ -10,9 +10,15 @@
 
 #include <schema_generated.h>
 #include <functional>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
+namespace armnnUtils
+{
+class MemoryMappedFile;
+}
+
 namespace armnnTfLiteParser
 {
 
@@ -32,6 +38,13 @@ public:
     using BufferPtr = std::unique_ptr<tflite::BufferT>;
     using BufferRawPtr = const tflite::BufferT *;
 
+    /// The contents of a buffer of the model, read in place from the flatbuffer the model is parsed from
+    struct BufferData
+    {
+        const uint8_t* m_Data;
+        size_t m_Size;
+    };
+
 public:
     /// Create the network from a flatbuffers binary file on disk
     virtual armnn::INetworkPtr CreateNetworkFromBinaryFile(const char* graphFile) override;
@@ -66,6 +79,8 @@ public:
     // testable helpers
     static ModelPtr LoadModelFromFile(const char * fileName);
     static ModelPtr LoadModelFromBinary(const uint8_t * binaryContent, size_t len);
+    /// Unpacks the subgraphs and operators of the model but not the contents of its buffers, which are left empty
+    static ModelPtr LoadModelStructureFromBinary(const uint8_t * binaryContent, size_t len);
     static TensorRawPtrVector GetInputs(const ModelPtr & model, size_t subgraphIndex, size_t operatorIndex);
     static TensorRawPtrVector GetOutputs(const ModelPtr & model, size_t subgraphIndex, size_t operatorIndex);
     static TensorIdRawPtrVector GetSubgraphInputs(const ModelPtr & model, size_t subgraphIndex);
@@ -84,9 +99,15 @@ private:
     TfLiteParser(const TfLiteParser &) = delete;
     TfLiteParser & operator=(const TfLiteParser &) = delete;
 
+    /// Create the network from a flatbuffers binary, reading the contents of its buffers in place
+    armnn::INetworkPtr CreateNetworkFromFlatBuffer(const uint8_t* binaryContent, size_t len);
+
     /// Create the network from an already loaded flatbuffers model
     armnn::INetworkPtr CreateNetworkFromModel();
 
+    /// Returns the contents of a buffer of the model being parsed
+    BufferData GetBufferData(size_t bufferIndex) const;
+
     // signature for the parser functions
     using OperatorParsingFunction = void(TfLiteParser::*)(size_t subgraphIndex, size_t operatorIndex);
 
@@ -180,7 +201,7 @@ private:
 
     template<typename T>
     std::pair<armnn::ConstTensor, TfLiteParser::SupportedDataStorage>
-    CreateConstTensorAndStoreData(TfLiteParser::BufferRawPtr bufferPtr,
+    CreateConstTensorAndStoreData(const TfLiteParser::BufferData& buffer,
                                   TfLiteParser::TensorRawPtr tensorPtr,
                                   armnn::TensorInfo& tensorInfo,
                                   armnn::Optional<armnn::PermutationVector&> permutationVector);
@@ -197,6 +218,12 @@ private:
     armnn::INetworkPtr                    m_Network;
     ModelPtr                              m_Model;
 
+    /// The flatbuffer holding the contents of the buffers of m_Model while it is parsed
+    const tflite::Model*                  m_FlatBufferModel;
+
+    /// The model file, when the network references its constant tensors in place
+    std::shared_ptr<const armnnUtils::MemoryMappedFile> m_MappedFile;
+
     std::vector<OperatorParsingFunction>                     m_ParserFunctions;
     std::unordered_map<std::string, OperatorParsingFunction> m_CustomParserFunctions;
 
@@ -215,6 +215,24 @@ BOOST_FIXTURE_TEST_CASE(LoadModelFromFile, LoadModelFixture)
     remove(fname);
 }
 
+BOOST_FIXTURE_TEST_CASE(LoadModelStructureFromBinary, LoadModelFixture)
+{
+    TfLiteParser::ModelPtr model =
+        TfLiteParser::LoadModelStructureFromBinary(m_GraphBinary.data(), m_GraphBinary.size());
+    CheckModel(model, 3, 2, { tflite::BuiltinOperator_AVERAGE_POOL_2D, tflite::BuiltinOperator_CONV_2D },
+               2, "Test loading a model", 2);
+    CheckSubgraph(model->subgraphs[0], 2, { 1 }, { 0 }, 1, "");
+    CheckSubgraph(model->subgraphs[1], 3, { 0 }, { 1 }, 1, "");
+    CheckOperator(model->subgraphs[1]->operators[0], 1, { 0, 2 }, { 1 }, tflite::BuiltinOptions_Conv2DOptions,
+                  tflite::CustomOptionsFormat_FLEXBUFFERS);
+
+    // The contents of the buffers are not unpacked
+    for (const auto& buffer : model->buffers)
+    {
+        BOOST_CHECK(buffer->data.empty());
+    }
+}
+
 BOOST_AUTO_TEST_CASE(LoadNullBinary)
 {
     BOOST_CHECK_THROW(TfLiteParser::LoadModelFromBinary(nullptr, 0), armnn::InvalidArgumentException);
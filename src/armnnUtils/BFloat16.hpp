@@ -0,0 +1,110 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+namespace armnn
+{
+
+/// Brain floating point format: the upper 16 bits of an IEEE 754 single precision number.
+/// It keeps the exponent range of Float32 with a reduced mantissa of 7 bits.
+class BFloat16
+{
+public:
+    BFloat16()
+        : m_Value(0)
+    {}
+
+    BFloat16(const BFloat16& v) = default;
+
+    explicit BFloat16(uint16_t v)
+        : m_Value(v)
+    {}
+
+    explicit BFloat16(float v)
+    {
+        m_Value = Float32ToBFloat16(v).Val();
+    }
+
+    operator float() const
+    {
+        return ToFloat32();
+    }
+
+    BFloat16& operator=(const BFloat16& other) = default;
+
+    BFloat16& operator=(float v)
+    {
+        m_Value = Float32ToBFloat16(v).Val();
+        return *this;
+    }
+
+    bool operator==(const BFloat16& r) const
+    {
+        return m_Value == r.Val();
+    }
+
+    /// Converts with rounding to nearest, ties to even.
+    static BFloat16 Float32ToBFloat16(const float v)
+    {
+        if (std::isnan(v))
+        {
+            return Nan();
+        }
+
+        uint32_t bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+
+        // Adding 0x7FFF plus the lowest kept bit rounds half way cases to the even value
+        const uint32_t lsb = (bits >> 16) & 1u;
+        bits += 0x7FFFu + lsb;
+
+        return BFloat16(static_cast<uint16_t>(bits >> 16));
+    }
+
+    float ToFloat32() const
+    {
+        const uint32_t bits = static_cast<uint32_t>(m_Value) << 16;
+        float f;
+        std::memcpy(&f, &bits, sizeof(f));
+        return f;
+    }
+
+    uint16_t Val() const
+    {
+        return m_Value;
+    }
+
+    static BFloat16 Max()
+    {
+        return BFloat16(static_cast<uint16_t>(0x7F7F));
+    }
+
+    static BFloat16 Nan()
+    {
+        return BFloat16(static_cast<uint16_t>(0x7FC0));
+    }
+
+    static BFloat16 Inf()
+    {
+        return BFloat16(static_cast<uint16_t>(0x7F80));
+    }
+
+private:
+    uint16_t m_Value;
+};
+
+inline std::ostream& operator<<(std::ostream& os, const BFloat16& b)
+{
+    os << b.ToFloat32() << "(0x" << std::hex << b.Val() << std::dec << ")";
+    return os;
+}
+
+} //namespace armnn
@@ -0,0 +1,135 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "MemoryMappedFile.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/format.hpp>
+
+#if defined(__unix__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#elif defined(_MSC_VER)
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <fstream>
+#include <iterator>
+#include <vector>
+#endif
+
+namespace armnnUtils
+{
+
+MemoryMappedFile::MemoryMappedFile(const char* path)
+    : m_Data(nullptr)
+    , m_Size(0)
+    , m_Handle(nullptr)
+{
+#if defined(__unix__)
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        throw armnn::FileNotFoundException(boost::str(boost::format("Cannot open file %1%") % path));
+    }
+
+    struct stat statusBuffer;
+    if (fstat(fd, &statusBuffer) != 0)
+    {
+        close(fd);
+        throw armnn::RuntimeException(boost::str(boost::format("Cannot get the size of file %1%") % path));
+    }
+    m_Size = static_cast<size_t>(statusBuffer.st_size);
+
+    if (m_Size > 0)
+    {
+        void* mapping = mmap(nullptr, m_Size, PROT_READ, MAP_SHARED, fd, 0);
+        if (mapping == MAP_FAILED)
+        {
+            close(fd);
+            throw armnn::RuntimeException(boost::str(boost::format("Cannot map file %1% into memory") % path));
+        }
+        m_Data = static_cast<const uint8_t*>(mapping);
+    }
+
+    // The mapping stays valid after the file descriptor is closed
+    close(fd);
+#elif defined(_MSC_VER)
+    HANDLE file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw armnn::FileNotFoundException(boost::str(boost::format("Cannot open file %1%") % path));
+    }
+
+    LARGE_INTEGER size;
+    if (::GetFileSizeEx(file, &size) == 0)
+    {
+        ::CloseHandle(file);
+        throw armnn::RuntimeException(boost::str(boost::format("Cannot get the size of file %1%") % path));
+    }
+    m_Size = static_cast<size_t>(size.QuadPart);
+
+    if (m_Size > 0)
+    {
+        HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping != nullptr)
+        {
+            m_Data = static_cast<const uint8_t*>(::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            // The view keeps the mapping object alive
+            ::CloseHandle(mapping);
+        }
+        if (m_Data == nullptr)
+        {
+            ::CloseHandle(file);
+            throw armnn::RuntimeException(boost::str(boost::format("Cannot map file %1% into memory") % path));
+        }
+    }
+    ::CloseHandle(file);
+#else
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        throw armnn::FileNotFoundException(boost::str(boost::format("Cannot open file %1%") % path));
+    }
+
+    auto contents = new std::vector<uint8_t>((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    m_Handle = contents;
+    m_Data   = contents->data();
+    m_Size   = contents->size();
+#endif
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+#if defined(__unix__)
+    if (m_Data != nullptr)
+    {
+        munmap(const_cast<uint8_t*>(m_Data), m_Size);
+    }
+#elif defined(_MSC_VER)
+    if (m_Data != nullptr)
+    {
+        ::UnmapViewOfFile(m_Data);
+    }
+#else
+    delete static_cast<std::vector<uint8_t>*>(m_Handle);
+#endif
+}
+
+bool MemoryMappedFile::Contains(const void* data, size_t size) const
+{
+    const uintptr_t begin   = reinterpret_cast<uintptr_t>(data);
+    const uintptr_t mapping = reinterpret_cast<uintptr_t>(m_Data);
+    return m_Data != nullptr &&
+           begin >= mapping &&
+           size <= m_Size &&
+           begin - mapping <= m_Size - size;
+}
+
+} // namespace armnnUtils
@@ -0,0 +1,40 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace armnnUtils
+{
+
+/// Read-only view of the contents of a file mapped into memory. The pages are shared with the page cache,
+/// so several processes mapping the same file share a single physical copy of it.
+/// On platforms without memory mapping support the contents of the file are read into memory instead.
+class MemoryMappedFile
+{
+public:
+    /// Throws armnn::FileNotFoundException if the file cannot be opened, or armnn::RuntimeException if it
+    /// cannot be mapped.
+    explicit MemoryMappedFile(const char* path);
+    ~MemoryMappedFile();
+
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+    const uint8_t* GetData() const { return m_Data; }
+    size_t GetSize() const { return m_Size; }
+
+    /// Returns true if [data, data + size) lies within the mapped contents.
+    bool Contains(const void* data, size_t size) const;
+
+private:
+    const uint8_t* m_Data;
+    size_t m_Size;
+    void* m_Handle;
+};
+
+} // namespace armnnUtils
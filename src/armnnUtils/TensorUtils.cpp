@@ -9,8 +9,11 @@
 
 #include <boost/assert.hpp>
 #include <boost/format.hpp>
+#include <boost/functional/hash.hpp>
 #include <boost/numeric/conversion/cast.hpp>
 
+#include <cstring>
+
 using namespace armnn;
 
 namespace armnnUtils
@@ -164,4 +167,37 @@ std::pair<unsigned int, std::vector<float>> GetPerAxisParams(const armnn::Tensor
     return { axisFactor, scales };
 }
 
+size_t GetTensorContentHash(const armnn::TensorInfo& info, const void* data)
+{
+    size_t seed = 0;
+    boost::hash_combine(seed, static_cast<int>(info.GetDataType()));
+    for (unsigned int i = 0; i < info.GetNumDimensions(); ++i)
+    {
+        boost::hash_combine(seed, info.GetShape()[i]);
+    }
+    boost::hash_combine(seed, info.GetQuantizationScales());
+    boost::hash_combine(seed, info.GetQuantizationOffset());
+
+    // FNV-1a over 64 bit words, which is fast enough to hash the weights of a whole network
+    const uint64_t prime = 1099511628211ull;
+    uint64_t hash = 14695981039346656037ull;
+
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    const unsigned int numBytes = info.GetNumBytes();
+    unsigned int i = 0;
+    for (; i + sizeof(uint64_t) <= numBytes; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, bytes + i, sizeof(word));
+        hash = (hash ^ word) * prime;
+    }
+    for (; i < numBytes; ++i)
+    {
+        hash = (hash ^ bytes[i]) * prime;
+    }
+
+    boost::hash_combine(seed, hash);
+    return seed;
+}
+
 } // namespace armnnUtils
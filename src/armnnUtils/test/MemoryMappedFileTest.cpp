@@ -0,0 +1,50 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <armnn/Exceptions.hpp>
+
+#include <MemoryMappedFile.hpp>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+#include <string>
+
+using namespace armnnUtils;
+
+BOOST_AUTO_TEST_SUITE(MemoryMappedFileSuite)
+
+BOOST_AUTO_TEST_CASE(MapFileContents)
+{
+    boost::filesystem::path fileDir = boost::filesystem::temp_directory_path();
+    boost::filesystem::path path{fileDir / boost::filesystem::unique_path("%%%%-%%%%-%%%%.bin")};
+
+    const std::string contents = "memory mapped contents";
+    {
+        std::ofstream file(path.c_str(), std::ios::binary);
+        file << contents;
+    }
+
+    {
+        MemoryMappedFile mappedFile(path.c_str());
+        BOOST_TEST(mappedFile.GetSize() == contents.size());
+        BOOST_TEST(std::string(reinterpret_cast<const char*>(mappedFile.GetData()), mappedFile.GetSize()) == contents);
+
+        BOOST_TEST(mappedFile.Contains(mappedFile.GetData(), mappedFile.GetSize()));
+        BOOST_TEST(mappedFile.Contains(mappedFile.GetData() + 7, 6));
+        BOOST_TEST(!mappedFile.Contains(mappedFile.GetData() + 7, mappedFile.GetSize()));
+        BOOST_TEST(!mappedFile.Contains(contents.data(), 1));
+    }
+
+    boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(MapMissingFile)
+{
+    BOOST_CHECK_THROW(MemoryMappedFile("/does/not/exist.armnn"), armnn::FileNotFoundException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
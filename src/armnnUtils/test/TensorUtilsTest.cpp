@@ -134,4 +134,17 @@ BOOST_AUTO_TEST_CASE(ExpandDimsInvalidNegativeAxisTest)
     BOOST_CHECK_THROW(ExpandDims(inputShape, -5), armnn::InvalidArgumentException);
 }
 
+BOOST_AUTO_TEST_CASE(TensorContentHashTest)
+{
+    const std::vector<float> data{ 1.f, 2.f, 3.f, 4.f, 5.f, 6.f };
+    const std::vector<float> otherData{ 1.f, 2.f, 3.f, 4.f, 5.f, 7.f };
+
+    const TensorInfo info({ 2, 3 }, DataType::Float32);
+    const TensorInfo reshapedInfo({ 3, 2 }, DataType::Float32);
+
+    BOOST_TEST(GetTensorContentHash(info, data.data()) == GetTensorContentHash(info, std::vector<float>(data).data()));
+    BOOST_TEST(GetTensorContentHash(info, data.data()) != GetTensorContentHash(info, otherData.data()));
+    BOOST_TEST(GetTensorContentHash(info, data.data()) != GetTensorContentHash(reshapedInfo, data.data()));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
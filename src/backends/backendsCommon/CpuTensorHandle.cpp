@@ -62,10 +62,26 @@ ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ConstTensor& tensor)
     CopyFrom(tensor.GetMemoryArea(), tensor.GetNumBytes());
 }
 
+ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ConstTensor& tensor, std::shared_ptr<const void> storage)
+: ScopedCpuTensorHandle(tensor.GetInfo())
+{
+    BOOST_ASSERT(storage != nullptr);
+    m_SharedStorage = std::move(storage);
+    SetMemory(const_cast<void*>(tensor.GetMemoryArea()));
+}
+
 ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ConstCpuTensorHandle& tensorHandle)
 : ScopedCpuTensorHandle(tensorHandle.GetTensorInfo())
 {
-    CopyFrom(tensorHandle.GetConstTensor<void>(), tensorHandle.GetTensorInfo().GetNumBytes());
+    const ScopedCpuTensorHandle* scopedTensorHandle = dynamic_cast<const ScopedCpuTensorHandle*>(&tensorHandle);
+    if (scopedTensorHandle != nullptr)
+    {
+        CopyFrom(*scopedTensorHandle);
+    }
+    else
+    {
+        CopyFrom(tensorHandle.GetConstTensor<void>(), tensorHandle.GetTensorInfo().GetNumBytes());
+    }
 }
 
 ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ScopedCpuTensorHandle& other)
@@ -76,15 +92,17 @@ ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ScopedCpuTensorHandle& other)
 
 ScopedCpuTensorHandle& ScopedCpuTensorHandle::operator=(const ScopedCpuTensorHandle& other)
 {
-    ::operator delete(GetTensor<void>());
-    SetMemory(nullptr);
-    CopyFrom(other);
+    if (this != &other)
+    {
+        Release();
+        CopyFrom(other);
+    }
     return *this;
 }
 
 ScopedCpuTensorHandle::~ScopedCpuTensorHandle()
 {
-    ::operator delete(GetTensor<void>());
+    Release();
 }
 
 void ScopedCpuTensorHandle::Allocate()
@@ -112,7 +130,17 @@ void ScopedCpuTensorHandle::CopyInFrom(const void* memory)
 
 void ScopedCpuTensorHandle::CopyFrom(const ScopedCpuTensorHandle& other)
 {
-    CopyFrom(other.GetTensor<void>(), other.GetTensorInfo().GetNumBytes());
+    if (other.m_SharedStorage)
+    {
+        // Shared memory is immutable, so the copy can reference it too
+        BOOST_ASSERT(GetTensor<void>() == nullptr);
+        m_SharedStorage = other.m_SharedStorage;
+        SetMemory(other.GetTensor<void>());
+    }
+    else
+    {
+        CopyFrom(other.GetTensor<void>(), other.GetTensorInfo().GetNumBytes());
+    }
 }
 
 void ScopedCpuTensorHandle::CopyFrom(const void* srcMemory, unsigned int numBytes)
@@ -127,6 +155,19 @@ void ScopedCpuTensorHandle::CopyFrom(const void* srcMemory, unsigned int numByte
     }
 }
 
+void ScopedCpuTensorHandle::Release()
+{
+    if (m_SharedStorage)
+    {
+        m_SharedStorage.reset();
+    }
+    else
+    {
+        ::operator delete(GetTensor<void>());
+    }
+    SetMemory(nullptr);
+}
+
 void PassthroughCpuTensorHandle::Allocate()
 {
     throw InvalidArgumentException("PassthroughCpuTensorHandle::Allocate() should never be called");
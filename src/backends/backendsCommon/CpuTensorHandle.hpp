@@ -13,6 +13,7 @@
 #include <CompatibleTypes.hpp>
 
 #include <algorithm>
+#include <memory>
 
 #include <boost/assert.hpp>
 
@@ -102,7 +103,7 @@ private:
 template <>
 void* CpuTensorHandle::GetTensor<void>() const;
 
-// A CpuTensorHandle that owns the wrapped memory region.
+// A CpuTensorHandle that owns the wrapped memory region, or shares an immutable one.
 class ScopedCpuTensorHandle : public CpuTensorHandle
 {
 public:
@@ -111,15 +112,24 @@ public:
     // Copies contents from Tensor.
     explicit ScopedCpuTensorHandle(const ConstTensor& tensor);
 
-    // Copies contents from ConstCpuTensorHandle
+    // References the contents of Tensor without copying them. The memory belongs to storage, which is kept alive
+    // by this handle and by its copies. The contents must not be modified through the handle.
+    ScopedCpuTensorHandle(const ConstTensor& tensor, std::shared_ptr<const void> storage);
+
+    // Copies contents from ConstCpuTensorHandle, or shares them if it is a ScopedCpuTensorHandle referencing
+    // shared storage. Workloads keeping a copy of their constant tensors thus reference the shared weights.
     explicit ScopedCpuTensorHandle(const ConstCpuTensorHandle& tensorHandle);
 
+    // Copies the contents of other, or shares them if other references shared storage.
     ScopedCpuTensorHandle(const ScopedCpuTensorHandle& other);
     ScopedCpuTensorHandle& operator=(const ScopedCpuTensorHandle& other);
     ~ScopedCpuTensorHandle();
 
     virtual void Allocate() override;
 
+    // Returns the storage whose memory this handle references, or nullptr if the handle owns its memory.
+    const std::shared_ptr<const void>& GetSharedStorage() const { return m_SharedStorage; }
+
 private:
     // Only used for testing
     void CopyOutTo(void* memory) const override;
@@ -127,6 +137,9 @@ private:
 
     void CopyFrom(const ScopedCpuTensorHandle& other);
     void CopyFrom(const void* srcMemory, unsigned int numBytes);
+    void Release();
+
+    std::shared_ptr<const void> m_SharedStorage;
 };
 
 // A CpuTensorHandle that wraps an already allocated memory region.
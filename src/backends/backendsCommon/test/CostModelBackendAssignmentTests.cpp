@@ -0,0 +1,192 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "MockBackend.hpp"
+#include "MockBackendId.hpp"
+
+#include <BackendCostModel.hpp>
+#include <DeviceSpec.hpp>
+#include <BackendSettings.hpp>
+#include <Graph.hpp>
+#include <Network.hpp>
+
+#include <armnn/BackendRegistry.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace armnn;
+
+namespace
+{
+
+// A second mock backend, supporting the same layers as the mock backend
+class OtherMockBackend : public MockBackend
+{
+public:
+    static const BackendId& GetIdStatic()
+    {
+        static const BackendId s_Id{ "OtherMockAcc" };
+        return s_Id;
+    }
+
+    const BackendId& GetId() const override
+    {
+        return GetIdStatic();
+    }
+};
+
+class OtherMockBackendInitialiser
+{
+public:
+    OtherMockBackendInitialiser()
+    {
+        BackendRegistryInstance().Register(OtherMockBackend::GetIdStatic(),
+                                           []()
+                                           {
+                                               return IBackendInternalUniquePtr(new OtherMockBackend);
+                                           });
+    }
+
+    ~OtherMockBackendInitialiser()
+    {
+        BackendRegistryInstance().Deregister(OtherMockBackend::GetIdStatic());
+    }
+};
+
+// Adds two inputs and assigns every layer to the mock backend, as the first supported backend
+void CreateAdditionGraph(Graph& graph)
+{
+    const TensorInfo info({ 1, 1024 }, DataType::Float32);
+
+    Layer* input0   = graph.AddLayer<InputLayer>(0, "input0");
+    Layer* input1   = graph.AddLayer<InputLayer>(1, "input1");
+    Layer* addition = graph.AddLayer<AdditionLayer>("addition");
+    Layer* output   = graph.AddLayer<OutputLayer>(0, "output");
+
+    input0->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+    input1->GetOutputSlot(0).Connect(addition->GetInputSlot(1));
+    addition->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input0->GetOutputSlot(0).SetTensorInfo(info);
+    input1->GetOutputSlot(0).SetTensorInfo(info);
+    addition->GetOutputSlot(0).SetTensorInfo(info);
+
+    for (Layer* layer : graph)
+    {
+        layer->SetBackendId(MockBackendId());
+    }
+}
+
+BackendSettings CreateBackendSettings()
+{
+    BackendSettings backendSettings;
+    backendSettings.m_PreferredBackends = { MockBackendId(), OtherMockBackend::GetIdStatic() };
+    backendSettings.m_SupportedBackends = { MockBackendId(), OtherMockBackend::GetIdStatic() };
+    return backendSettings;
+}
+
+bool AreAllLayersAssignedTo(const Graph& graph, const BackendId& backend)
+{
+    return std::all_of(graph.begin(), graph.end(), [&backend](const Layer* layer)
+    {
+        return layer->GetBackendId() == backend;
+    });
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(CostModelBackendAssignment)
+
+BOOST_AUTO_TEST_CASE(AssignsLayersToTheFasterBackend)
+{
+    MockBackendInitialiser mockBackendInitialiser;
+    OtherMockBackendInitialiser otherMockBackendInitialiser;
+
+    const BackendCostModel::BackendThroughput slowThroughput{ 0.1, 0.1, 50.0 };
+    const BackendCostModel::BackendThroughput fastThroughput{ 10.0, 10.0, 1.0 };
+
+    // The preferred backend is kept when it is the faster one
+    {
+        Graph graph;
+        CreateAdditionGraph(graph);
+        BackendSettings backendSettings = CreateBackendSettings();
+
+        BackendCostModel costModel;
+        costModel.SetBackendThroughput(MockBackendId(), fastThroughput);
+        costModel.SetBackendThroughput(OtherMockBackend::GetIdStatic(), slowThroughput);
+
+        AssignBackendsByCost(graph, backendSettings, costModel, EmptyOptional());
+
+        BOOST_TEST(AreAllLayersAssignedTo(graph, MockBackendId()));
+        BOOST_TEST(backendSettings.m_SelectedBackends.size() == 1);
+    }
+
+    // Otherwise the layers move to the faster backend, despite the preference
+    {
+        Graph graph;
+        CreateAdditionGraph(graph);
+        BackendSettings backendSettings = CreateBackendSettings();
+
+        BackendCostModel costModel;
+        costModel.SetBackendThroughput(MockBackendId(), slowThroughput);
+        costModel.SetBackendThroughput(OtherMockBackend::GetIdStatic(), fastThroughput);
+
+        std::vector<std::string> messages;
+        AssignBackendsByCost(graph, backendSettings, costModel, Optional<std::vector<std::string>&>(messages));
+
+        BOOST_TEST(AreAllLayersAssignedTo(graph, OtherMockBackend::GetIdStatic()));
+        BOOST_TEST(backendSettings.IsBackendSelected(OtherMockBackend::GetIdStatic()));
+        BOOST_TEST(!backendSettings.IsBackendSelected(MockBackendId()));
+        BOOST_TEST(std::any_of(messages.begin(), messages.end(), [](const std::string& message)
+        {
+            return message.find("Layer addition of type Addition assigned to OtherMockAcc") != std::string::npos;
+        }));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(MovesALayerOnlyWhenItPaysForTheCopies)
+{
+    MockBackendInitialiser mockBackendInitialiser;
+    OtherMockBackendInitialiser otherMockBackendInitialiser;
+
+    Graph graph;
+    CreateAdditionGraph(graph);
+    BackendSettings backendSettings = CreateBackendSettings();
+
+    // The inputs and the output are much cheaper on the mock backend. Each copy of a tensor between the backends
+    // costs 20 us plus 4096 bytes at 1 GB/s.
+    BackendCostModel costModel;
+    for (const char* layerName : { "input0", "input1", "output" })
+    {
+        costModel.SetMeasuredLayerCost(layerName, MockBackendId(), 1.0);
+        costModel.SetMeasuredLayerCost(layerName, OtherMockBackend::GetIdStatic(), 50.0);
+    }
+    costModel.SetCopyCost(1.0, 20.0);
+
+    // The addition is a little faster on the other backend, not enough to pay for its three copies
+    costModel.SetMeasuredLayerCost("addition", MockBackendId(), 10.0);
+    costModel.SetMeasuredLayerCost("addition", OtherMockBackend::GetIdStatic(), 9.0);
+
+    AssignBackendsByCost(graph, backendSettings, costModel, EmptyOptional());
+    BOOST_TEST(AreAllLayersAssignedTo(graph, MockBackendId()));
+
+    // Once it is much faster there, it moves alone
+    costModel.SetMeasuredLayerCost("addition", MockBackendId(), 100.0);
+
+    AssignBackendsByCost(graph, backendSettings, costModel, EmptyOptional());
+    for (const Layer* layer : graph)
+    {
+        const BackendId expectedBackend = layer->GetType() == LayerType::Addition ? OtherMockBackend::GetIdStatic()
+                                                                                  : BackendId(MockBackendId());
+        BOOST_TEST((layer->GetBackendId() == expectedBackend));
+    }
+    BOOST_TEST(backendSettings.m_SelectedBackends.size() == 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
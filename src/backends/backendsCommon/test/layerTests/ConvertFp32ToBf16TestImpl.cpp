@@ -0,0 +1,65 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ConvertFp32ToBf16TestImpl.hpp"
+
+#include <backendsCommon/test/TensorCopyUtils.hpp>
+#include <backendsCommon/test/WorkloadTestUtils.hpp>
+
+#include <test/TensorHelpers.hpp>
+
+LayerTestResult<armnn::BFloat16, 4> SimpleConvertFp32ToBf16Test(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager)
+{
+    boost::ignore_unused(memoryManager);
+
+    const armnn::TensorInfo inputTensorInfo({1, 2, 2, 3}, armnn::DataType::Float32);
+    const armnn::TensorInfo outputTensorInfo({1, 2, 2, 3}, armnn::DataType::BFloat16);
+
+    auto input = MakeTensor<float, 4>(inputTensorInfo,
+        { 1.0f, -2.0f, 0.0f,
+          3.14159f, -3.14159f, 1000.0f,
+          // Exactly halfway between two BFloat16 values: rounds to the even one
+          1.00390625f, 1.01171875f, -1.00390625f,
+          // Just above halfway: rounds up
+          1.004f, 65504.0f, 0.1f });
+
+    const std::vector<uint16_t> expectedBits =
+        { 0x3F80, 0xC000, 0x0000,
+          0x4049, 0xC049, 0x447A,
+          0x3F80, 0x3F82, 0xBF80,
+          0x3F81, 0x4780, 0x3DCD };
+
+    std::vector<armnn::BFloat16> expectedValues;
+    for (uint16_t bits : expectedBits)
+    {
+        expectedValues.push_back(armnn::BFloat16(bits));
+    }
+
+    LayerTestResult<armnn::BFloat16, 4> ret(outputTensorInfo);
+    ret.outputExpected = MakeTensor<armnn::BFloat16, 4>(outputTensorInfo, expectedValues);
+
+    std::unique_ptr<armnn::ITensorHandle> inputHandle = workloadFactory.CreateTensorHandle(inputTensorInfo);
+    std::unique_ptr<armnn::ITensorHandle> outputHandle = workloadFactory.CreateTensorHandle(outputTensorInfo);
+
+    armnn::ConvertFp32ToBf16QueueDescriptor data;
+    armnn::WorkloadInfo info;
+    AddInputToWorkload(data, info, inputTensorInfo, inputHandle.get());
+    AddOutputToWorkload(data, info, outputTensorInfo, outputHandle.get());
+
+    std::unique_ptr<armnn::IWorkload> workload = workloadFactory.CreateConvertFp32ToBf16(data, info);
+
+    inputHandle->Allocate();
+    outputHandle->Allocate();
+
+    CopyDataToITensorHandle(inputHandle.get(), &input[0][0][0][0]);
+
+    workload->Execute();
+
+    CopyDataFromITensorHandle(&ret.output[0][0][0][0], outputHandle.get());
+
+    return ret;
+}
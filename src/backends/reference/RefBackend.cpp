@@ -8,16 +8,23 @@
 #include "RefWorkloadFactory.hpp"
 #include "RefLayerSupport.hpp"
 #include "RefTensorHandleFactory.hpp"
+#include "workloads/FusedElementwise.hpp"
 
 #include <armnn/BackendRegistry.hpp>
 
 #include <armnn/backends/IBackendContext.hpp>
 #include <armnn/backends/IMemoryManager.hpp>
 
+#include <LayersFwd.hpp>
 #include <Optimizer.hpp>
 
+#include <boost/numeric/conversion/cast.hpp>
+#include <boost/polymorphic_cast.hpp>
 #include <boost/polymorphic_pointer_cast.hpp>
 
+#include <algorithm>
+#include <unordered_set>
+
 namespace armnn
 {
 
@@ -70,11 +77,252 @@ IBackendInternal::ILayerSupportSharedPtr RefBackend::GetLayerSupport() const
     return layerSupport;
 }
 
+namespace
+{
+
+using SubgraphLayerSet = std::unordered_set<const Layer*>;
+
+bool IsFusableLayer(const Layer& layer, const SubgraphLayerSet& subgraphLayers)
+{
+    switch (layer.GetType())
+    {
+        case LayerType::Activation:
+        case LayerType::Addition:
+        case LayerType::Division:
+        case LayerType::ElementwiseUnary:
+        case LayerType::Maximum:
+        case LayerType::Minimum:
+        case LayerType::Multiplication:
+        case LayerType::Subtraction:
+            break;
+        default:
+            return false;
+    }
+
+    if (subgraphLayers.find(&layer) == subgraphLayers.end())
+    {
+        return false;
+    }
+
+    // The fused workload evaluates the whole chain in fp32 without intermediate requantization,
+    // so only fp32 chains of tensors of the same rank are collapsed
+    const TensorInfo& outputInfo = layer.GetOutputSlot(0).GetTensorInfo();
+    if (outputInfo.GetDataType() != DataType::Float32)
+    {
+        return false;
+    }
+
+    for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+    {
+        const OutputSlot* connectedSlot = layer.GetInputSlot(i).GetConnectedOutputSlot();
+        if (connectedSlot == nullptr ||
+            connectedSlot->GetTensorInfo().GetDataType() != DataType::Float32 ||
+            connectedSlot->GetTensorInfo().GetNumDimensions() != outputInfo.GetNumDimensions())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// Returns the layer feeding the given layer that can be fused into the same chain, or nullptr if there is none.
+/// The candidate must be fusable and have the given layer as its only consumer.
+Layer* GetChainPredecessor(const Layer& layer, const SubgraphLayerSet& subgraphLayers)
+{
+    for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+    {
+        Layer& producer = layer.GetInputSlot(i).GetConnectedOutputSlot()->GetOwningLayer();
+        if (!IsFusableLayer(producer, subgraphLayers))
+        {
+            continue;
+        }
+
+        const std::vector<InputSlot*>& connections = producer.GetOutputSlot(0).GetConnections();
+        bool onlyConsumer = std::all_of(connections.begin(), connections.end(), [&layer](const InputSlot* slot)
+        {
+            return &slot->GetOwningLayer() == &layer;
+        });
+        if (onlyConsumer)
+        {
+            return &producer;
+        }
+    }
+    return nullptr;
+}
+
+/// Returns the layer consuming the output of the given layer in the same chain, or nullptr if there is none.
+Layer* GetChainSuccessor(const Layer& layer, const SubgraphLayerSet& subgraphLayers)
+{
+    const std::vector<InputSlot*>& connections = layer.GetOutputSlot(0).GetConnections();
+    if (connections.empty())
+    {
+        return nullptr;
+    }
+
+    Layer& consumer = connections.front()->GetOwningLayer();
+    if (!IsFusableLayer(consumer, subgraphLayers) || GetChainPredecessor(consumer, subgraphLayers) != &layer)
+    {
+        return nullptr;
+    }
+    return &consumer;
+}
+
+FusedElementwiseStep MakeFusedElementwiseStep(const Layer& layer)
+{
+    FusedElementwiseStep step;
+    switch (layer.GetType())
+    {
+        case LayerType::Activation:
+            step.m_Operation  = FusedElementwiseOperation::Activation;
+            step.m_Activation = boost::polymorphic_downcast<const ActivationLayer*>(&layer)->GetParameters();
+            break;
+        case LayerType::ElementwiseUnary:
+            step.m_Operation      = FusedElementwiseOperation::Unary;
+            step.m_UnaryOperation =
+                boost::polymorphic_downcast<const ElementwiseUnaryLayer*>(&layer)->GetParameters().m_Operation;
+            break;
+        case LayerType::Addition:
+            step.m_Operation = FusedElementwiseOperation::Add;
+            break;
+        case LayerType::Division:
+            step.m_Operation = FusedElementwiseOperation::Div;
+            break;
+        case LayerType::Maximum:
+            step.m_Operation = FusedElementwiseOperation::Max;
+            break;
+        case LayerType::Minimum:
+            step.m_Operation = FusedElementwiseOperation::Min;
+            break;
+        case LayerType::Multiplication:
+            step.m_Operation = FusedElementwiseOperation::Mul;
+            break;
+        case LayerType::Subtraction:
+            step.m_Operation = FusedElementwiseOperation::Sub;
+            break;
+        default:
+            throw InvalidArgumentException("Layer cannot be fused into an elementwise chain");
+    }
+    return step;
+}
+
+PreCompiledObjectPtr MakeFusedElementwiseObject(std::unique_ptr<FusedElementwiseProgram> program)
+{
+    return PreCompiledObjectPtr(program.release(), [](const void* object)
+    {
+        delete static_cast<const FusedElementwiseProgram*>(object);
+    });
+}
+
+/// Collapses the given chain of layers into a single PreCompiledLayer running a fused elementwise program.
+void AddFusedElementwiseSubstitution(const std::vector<Layer*>& chain, OptimizationViews& optimizationViews)
+{
+    SubgraphView::InputSlots inputSlots;
+    SubgraphView::Layers layers(chain.begin(), chain.end());
+
+    std::unique_ptr<FusedElementwiseProgram> program = std::make_unique<FusedElementwiseProgram>();
+
+    for (unsigned int layerIndex = 0; layerIndex < chain.size(); ++layerIndex)
+    {
+        Layer& layer = *chain[layerIndex];
+        FusedElementwiseStep step = MakeFusedElementwiseStep(layer);
+
+        if (layerIndex == 0)
+        {
+            // The first layer seeds the chain from its first input
+            for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+            {
+                inputSlots.push_back(&layer.GetInputSlot(i));
+            }
+            step.m_OperandIndex = 1;
+        }
+        else if (layer.GetNumInputSlots() == 2)
+        {
+            const Layer* previous = chain[layerIndex - 1];
+            const bool input0IsChain = &layer.GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer() == previous;
+            const bool input1IsChain = &layer.GetInputSlot(1).GetConnectedOutputSlot()->GetOwningLayer() == previous;
+
+            step.m_ChainIsFirstOperand = input0IsChain;
+            step.m_OperandIsChain      = input0IsChain && input1IsChain;
+            if (!step.m_OperandIsChain)
+            {
+                step.m_OperandIndex = boost::numeric_cast<unsigned int>(inputSlots.size());
+                inputSlots.push_back(&layer.GetInputSlot(input0IsChain ? 1 : 0));
+            }
+        }
+
+        program->m_Steps.push_back(step);
+    }
+
+    Layer& lastLayer = *chain.back();
+    SubgraphView::OutputSlots outputSlots{ &lastLayer.GetOutputSlot(0) };
+
+    const unsigned int numInputSlots = boost::numeric_cast<unsigned int>(inputSlots.size());
+    PreCompiledLayer* preCompiledLayer = optimizationViews.GetGraph().AddLayer<PreCompiledLayer>(
+        PreCompiledDescriptor(numInputSlots, 1), "fused-elementwise");
+    preCompiledLayer->GetOutputSlot(0).SetTensorInfo(lastLayer.GetOutputSlot(0).GetTensorInfo());
+    preCompiledLayer->SetBackendId(RefBackend::GetIdStatic());
+    // Every step of the program is one operation on each element of the output
+    preCompiledLayer->SetOperationsPerElement(boost::numeric_cast<unsigned int>(program->m_Steps.size()));
+    // The program is copied along with the layer, so that networks holding it can be copied and cached
+    preCompiledLayer->SetPreCompiledObject(MakeFusedElementwiseObject(std::move(program)), [](const void* object)
+    {
+        return MakeFusedElementwiseObject(
+            std::make_unique<FusedElementwiseProgram>(*static_cast<const FusedElementwiseProgram*>(object)));
+    });
+
+    SubgraphView substitutableSubgraph(std::move(inputSlots), std::move(outputSlots), std::move(layers));
+    SubgraphView replacementSubgraph(preCompiledLayer);
+
+    optimizationViews.AddSubstitution({ substitutableSubgraph, replacementSubgraph });
+}
+
+} // anonymous namespace
+
 OptimizationViews RefBackend::OptimizeSubgraphView(const SubgraphView& subgraph) const
 {
     OptimizationViews optimizationViews;
 
-    optimizationViews.AddUntouchedSubgraph(SubgraphView(subgraph));
+    const SubgraphLayerSet subgraphLayers(subgraph.begin(), subgraph.end());
+    SubgraphView::Layers untouchedLayers;
+
+    // Collapse every maximal chain of two or more fusable layers into a single fused elementwise workload
+    for (Layer* layer : subgraph.GetLayers())
+    {
+        if (!IsFusableLayer(*layer, subgraphLayers))
+        {
+            untouchedLayers.push_back(layer);
+            continue;
+        }
+
+        if (GetChainPredecessor(*layer, subgraphLayers) != nullptr)
+        {
+            // Not the head of a chain, it is picked up when walking the chain from its head
+            continue;
+        }
+
+        std::vector<Layer*> chain{ layer };
+        for (Layer* next = GetChainSuccessor(*layer, subgraphLayers);
+             next != nullptr;
+             next = GetChainSuccessor(*next, subgraphLayers))
+        {
+            chain.push_back(next);
+        }
+
+        if (chain.size() > 1)
+        {
+            AddFusedElementwiseSubstitution(chain, optimizationViews);
+        }
+        else
+        {
+            untouchedLayers.push_back(layer);
+        }
+    }
+
+    if (!untouchedLayers.empty())
+    {
+        optimizationViews.AddUntouchedSubgraph(SubgraphView({}, {}, std::move(untouchedLayers)));
+    }
 
     return optimizationViews;
 }
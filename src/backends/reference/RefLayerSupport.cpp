@@ -367,6 +367,21 @@ bool RefLayerSupport::IsConstantSupported(const TensorInfo& output,
                                   "Reference constant: output is not a supported type.");
 }
 
+bool RefLayerSupport::IsConvertBf16ToFp32Supported(const TensorInfo& input,
+                                                   const TensorInfo& output,
+                                                   Optional<std::string&> reasonIfUnsupported) const
+{
+    bool supported = true;
+
+    supported &= CheckSupportRule(TypeIs(input, DataType::BFloat16), reasonIfUnsupported,
+                                  "Reference for ConvertBf16ToFp32 layer: input type not supported");
+
+    supported &= CheckSupportRule(TypeIs(output, DataType::Float32), reasonIfUnsupported,
+                                  "Reference for ConvertBf16ToFp32 layer: output type not supported");
+
+    return supported;
+}
+
 bool RefLayerSupport::IsConvertFp16ToFp32Supported(const TensorInfo& input,
                                                    const TensorInfo& output,
                                                    Optional<std::string&> reasonIfUnsupported) const
@@ -387,6 +402,21 @@ bool RefLayerSupport::IsConvertFp16ToFp32Supported(const TensorInfo& input,
                                           &FalseFuncU8<>));
 }
 
+bool RefLayerSupport::IsConvertFp32ToBf16Supported(const TensorInfo& input,
+                                                   const TensorInfo& output,
+                                                   Optional<std::string&> reasonIfUnsupported) const
+{
+    bool supported = true;
+
+    supported &= CheckSupportRule(TypeIs(input, DataType::Float32), reasonIfUnsupported,
+                                  "Reference for ConvertFp32ToBf16 layer: input type not supported");
+
+    supported &= CheckSupportRule(TypeIs(output, DataType::BFloat16), reasonIfUnsupported,
+                                  "Reference for ConvertFp32ToBf16 layer: output type not supported");
+
+    return supported;
+}
+
 bool RefLayerSupport::IsConvertFp32ToFp16Supported(const TensorInfo& input,
                                                    const TensorInfo& output,
                                                    Optional<std::string&> reasonIfUnsupported) const
@@ -417,8 +447,9 @@ bool RefLayerSupport::IsConvolution2dSupported(const TensorInfo& input,
     bool supported = true;
 
     // Define supported types.
-    std::array<DataType,6> supportedTypes =
+    std::array<DataType,7> supportedTypes =
     {
+        DataType::BFloat16,
         DataType::Float32,
         DataType::Float16,
         DataType::QAsymmU8,
@@ -463,8 +494,9 @@ bool RefLayerSupport::IsConvolution2dSupported(const TensorInfo& input,
 
     if (biases.has_value())
     {
-        std::array<DataType,3> biasesSupportedTypes =
+        std::array<DataType,4> biasesSupportedTypes =
         {
+            DataType::BFloat16,
             DataType::Float32,
             DataType::Float16,
             DataType::Signed32
@@ -814,8 +846,9 @@ bool RefLayerSupport::IsFullyConnectedSupported(const TensorInfo& input,
     bool supported = true;
 
     // Define supported types.
-    std::array<DataType,4> supportedTypes =
+    std::array<DataType,5> supportedTypes =
     {
+            DataType::BFloat16,
             DataType::Float32,
             DataType::Float16,
             DataType::QAsymmU8,
@@ -840,9 +873,10 @@ bool RefLayerSupport::IsFullyConnectedSupported(const TensorInfo& input,
     if (descriptor.m_BiasEnabled)
     {
         // Defined supported types for bias
-        std::array<DataType, 3>
+        std::array<DataType, 4>
         supportedBiasTypes =
         {
+            DataType::BFloat16,
             DataType::Float32,
             DataType::Float16,
             DataType::Signed32
@@ -1436,6 +1470,17 @@ bool RefLayerSupport::IsPooling2dSupported(const TensorInfo& input,
     return supported;
 }
 
+bool RefLayerSupport::IsPreCompiledSupported(const TensorInfo& input,
+                                             const PreCompiledDescriptor& descriptor,
+                                             Optional<std::string&> reasonIfUnsupported) const
+{
+    ignore_unused(descriptor);
+
+    // The reference backend only creates pre-compiled layers for fused Float32 elementwise chains
+    return CheckSupportRule(TypeIs(input, DataType::Float32), reasonIfUnsupported,
+                            "Reference pre-compiled: input is not a supported type.");
+}
+
 bool RefLayerSupport::IsQuantizeSupported(const TensorInfo& input,
                                           const TensorInfo& output,
                                           Optional<std::string&> reasonIfUnsupported) const
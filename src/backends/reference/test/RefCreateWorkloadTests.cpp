@@ -380,6 +380,44 @@ BOOST_AUTO_TEST_CASE(CreateFullyConnectedWorkloadQuantisedSymm16)
     RefCreateFullyConnectedWorkloadTest<RefFullyConnectedWorkload, armnn::DataType::QSymmS16>();
 }
 
+BOOST_AUTO_TEST_CASE(CreateFullyConnectedWorkloadSharedWeights)
+{
+    Graph graph;
+    RefWorkloadFactory factory = GetFactory();
+
+    FullyConnectedDescriptor layerDesc;
+    layerDesc.m_BiasEnabled = true;
+
+    FullyConnectedLayer* const layer = graph.AddLayer<FullyConnectedLayer>(layerDesc, "layer");
+
+    const TensorInfo weightsInfo({ 4, 2 }, DataType::Float32);
+    const TensorInfo biasInfo({ 2 }, DataType::Float32);
+
+    auto weights = std::make_shared<std::vector<float>>(weightsInfo.GetNumElements(), 1.f);
+    auto bias    = std::make_shared<std::vector<float>>(biasInfo.GetNumElements(), 0.f);
+
+    layer->m_Weight = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(weightsInfo, weights->data()), weights);
+    layer->m_Bias   = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(biasInfo, bias->data()), bias);
+
+    Layer* const input = graph.AddLayer<InputLayer>(0, "input");
+    Layer* const output = graph.AddLayer<OutputLayer>(0, "output");
+
+    Connect(input, layer, TensorInfo({ 1, 4 }, DataType::Float32));
+    Connect(layer, output, TensorInfo({ 1, 2 }, DataType::Float32));
+    CreateTensorHandles(graph, factory);
+
+    auto workload = MakeAndCheckWorkload<RefFullyConnectedWorkload>(*layer, factory);
+
+    // The workload references the weights of the layer instead of copying them,
+    // and keeps them alive once the layer has released them
+    BOOST_TEST(weights.use_count() == 3);
+    BOOST_TEST(bias.use_count() == 3);
+
+    layer->ReleaseConstantData();
+    BOOST_TEST(weights.use_count() == 2);
+    BOOST_TEST(bias.use_count() == 2);
+}
+
 template <typename NormalizationWorkloadType, armnn::DataType DataType>
 static void RefCreateNormalizationWorkloadTest(DataLayout dataLayout)
 {
@@ -370,6 +370,78 @@ BOOST_AUTO_TEST_CASE(TrivialMin)
     BOOST_TEST(outputData[3] == 2);
 }
 
+BOOST_AUTO_TEST_CASE(ReduceFp32ToBf16FullyConnected)
+{
+    using namespace armnn;
+
+    // Create runtime in which test will run
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    // Builds up the structure of the network.
+    armnn::INetworkPtr net(INetwork::Create());
+
+    FullyConnectedDescriptor descriptor;
+    descriptor.m_BiasEnabled = true;
+
+    TensorInfo weightsInfo(TensorShape({4, 2}), DataType::Float32);
+    std::vector<float> weightsData
+    {
+        1.0f, 2.0f,
+        1.0f, 0.0f,
+        1.0f, 0.0f,
+        1.0f, 0.0f
+    };
+    TensorInfo biasesInfo(TensorShape({2}), DataType::Float32);
+    std::vector<float> biasesData{ 0.5f, -1.0f };
+
+    IConnectableLayer* input          = net->AddInputLayer(0);
+    IConnectableLayer* fullyConnected = net->AddFullyConnectedLayer(descriptor,
+                                                                    ConstTensor(weightsInfo, weightsData),
+                                                                    Optional<ConstTensor>(
+                                                                        ConstTensor(biasesInfo, biasesData)));
+    IConnectableLayer* output         = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(fullyConnected->GetInputSlot(0));
+    fullyConnected->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(TensorInfo(TensorShape({1, 4}), DataType::Float32));
+    fullyConnected->GetOutputSlot(0).SetTensorInfo(TensorInfo(TensorShape({1, 2}), DataType::Float32));
+
+    // optimize the network, running the fully connected layer in BFloat16
+    IOptimizedNetworkPtr optNet = Optimize(*net, defaultBackends, runtime->GetDeviceSpec(),
+                                           OptimizerOptions(false, false, true));
+
+    // Loads it into the runtime.
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    // The inputs and outputs of the network stay in Float32
+    BOOST_TEST((runtime->GetInputTensorInfo(netId, 0).GetDataType() == DataType::Float32));
+    BOOST_TEST((runtime->GetOutputTensorInfo(netId, 0).GetDataType() == DataType::Float32));
+
+    // 1.01171875 lies halfway between the BFloat16 values 1.0078125 and 1.015625, and rounds to the even one
+    std::vector<float> inputData{ 1.01171875f, 2.0f, 3.0f, 4.0f };
+    std::vector<float> outputData(2);
+
+    InputTensors inputTensors
+    {
+        {0,armnn::ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data())}
+    };
+    OutputTensors outputTensors
+    {
+        {0,armnn::Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data())}
+    };
+
+    // Does the inference.
+    runtime->EnqueueWorkload(netId, inputTensors, outputTensors);
+
+    // Checks the results, which differ from the Float32 results of 10.51171875 and 1.0234375: the input is rounded
+    // to 1.015625 and the first output, 10.515625, to the nearest BFloat16 value
+    BOOST_TEST(outputData[0] == 10.5f);
+    BOOST_TEST(outputData[1] == 1.03125f);
+}
+
 BOOST_AUTO_TEST_CASE(RefEqualSimpleEndToEndTest)
 {
     const std::vector<uint8_t> expectedOutput({ 1, 1, 1, 1,  0, 0, 0, 0,
@@ -1080,6 +1080,10 @@ ARMNN_AUTO_TEST_CASE(LstmLayerInt16NoCifgNoPeepholeNoProjectionInt16Constant,
 ARMNN_AUTO_TEST_CASE(SimpleConvertFp16ToFp32, SimpleConvertFp16ToFp32Test)
 // Convert from Float32 to Float16
 ARMNN_AUTO_TEST_CASE(SimpleConvertFp32ToFp16, SimpleConvertFp32ToFp16Test)
+// Convert from BFloat16 to Float32
+ARMNN_AUTO_TEST_CASE(SimpleConvertBf16ToFp32, SimpleConvertBf16ToFp32Test)
+// Convert from Float32 to BFloat16
+ARMNN_AUTO_TEST_CASE(SimpleConvertFp32ToBf16, SimpleConvertFp32ToBf16Test)
 
 // Mean
 ARMNN_AUTO_TEST_CASE(MeanSimpleFloat32, MeanSimpleTest<DataType::Float32>)
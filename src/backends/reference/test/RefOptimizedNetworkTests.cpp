@@ -11,6 +11,8 @@
 #include <boost/test/unit_test.hpp>
 #include <test/GraphUtils.hpp>
 
+#include <algorithm>
+
 BOOST_AUTO_TEST_SUITE(RefOptimizedNetwork)
 
 BOOST_AUTO_TEST_CASE(OptimizeValidateCpuRefWorkloads)
@@ -193,4 +195,141 @@ BOOST_AUTO_TEST_CASE(DebugTestOnCpuRef)
     BOOST_TEST(GraphHasNamedLayer(graph, "OutputLayer"));
 }
 
+BOOST_AUTO_TEST_CASE(FuseElementwiseChainOnCpuRef)
+{
+    armnn::Network net;
+
+    // Hard swish: x * BoundedReLu(x + 3) / 6
+    armnn::ActivationDescriptor reluDescriptor;
+    reluDescriptor.m_Function = armnn::ActivationFunction::BoundedReLu;
+    reluDescriptor.m_A = 6.f;
+    reluDescriptor.m_B = 0.f;
+
+    const armnn::TensorInfo inputInfo({ 1, 2, 2, 2 }, armnn::DataType::Float32);
+    const armnn::TensorInfo scalarInfo({ 1, 1, 1, 1 }, armnn::DataType::Float32);
+
+    const std::vector<float> threeData{ 3.f };
+    const std::vector<float> sixData{ 6.f };
+
+    auto input    = net.AddInputLayer(0, "input");
+    auto three    = net.AddConstantLayer(armnn::ConstTensor(scalarInfo, threeData), "three");
+    auto six      = net.AddConstantLayer(armnn::ConstTensor(scalarInfo, sixData), "six");
+    auto add      = net.AddAdditionLayer("add");
+    auto relu     = net.AddActivationLayer(reluDescriptor, "relu6");
+    auto divide   = net.AddDivisionLayer("divide");
+    auto multiply = net.AddMultiplicationLayer("multiply");
+    auto output   = net.AddOutputLayer(0, "output");
+
+    input->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+    three->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+    add->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(divide->GetInputSlot(0));
+    six->GetOutputSlot(0).Connect(divide->GetInputSlot(1));
+    input->GetOutputSlot(0).Connect(multiply->GetInputSlot(0));
+    divide->GetOutputSlot(0).Connect(multiply->GetInputSlot(1));
+    multiply->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    three->GetOutputSlot(0).SetTensorInfo(scalarInfo);
+    six->GetOutputSlot(0).SetTensorInfo(scalarInfo);
+    add->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    relu->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    divide->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    multiply->GetOutputSlot(0).SetTensorInfo(inputInfo);
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    std::vector<armnn::BackendId> backends = {armnn::Compute::CpuRef};
+    armnn::IOptimizedNetworkPtr optimizedNet = armnn::Optimize(net, backends, runtime->GetDeviceSpec());
+    BOOST_CHECK(optimizedNet);
+
+    // The four elementwise layers are collapsed into a single pre-compiled layer
+    const armnn::Graph& graph = static_cast<armnn::OptimizedNetwork*>(optimizedNet.get())->GetGraph();
+    BOOST_TEST(graph.GetNumLayers() == 5);
+    BOOST_TEST(GraphHasNamedLayer(graph, "input"));
+    BOOST_TEST(GraphHasNamedLayer(graph, "three"));
+    BOOST_TEST(GraphHasNamedLayer(graph, "six"));
+    BOOST_TEST(GraphHasNamedLayer(graph, "output"));
+    BOOST_TEST(std::count_if(graph.begin(), graph.end(), [](const armnn::Layer* layer)
+    {
+        return layer->GetType() == armnn::LayerType::PreCompiled;
+    }) == 1);
+
+    armnn::NetworkId networkId;
+    BOOST_TEST(runtime->LoadNetwork(networkId, std::move(optimizedNet)) == armnn::Status::Success);
+
+    const std::vector<float> inputData{ -4.f, -3.f, -1.5f, 0.f, 0.5f, 1.f, 3.f, 4.f };
+    std::vector<float> outputData(inputData.size());
+
+    armnn::InputTensors inputTensors
+    {
+        { 0, armnn::ConstTensor(runtime->GetInputTensorInfo(networkId, 0), inputData.data()) }
+    };
+    armnn::OutputTensors outputTensors
+    {
+        { 0, armnn::Tensor(runtime->GetOutputTensorInfo(networkId, 0), outputData.data()) }
+    };
+    BOOST_TEST(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == armnn::Status::Success);
+
+    for (unsigned int i = 0; i < inputData.size(); ++i)
+    {
+        const float x = inputData[i];
+        const float expected = x * (std::min(6.f, std::max(0.f, x + 3.f)) / 6.f);
+        BOOST_TEST(outputData[i] == expected, boost::test_tools::tolerance(0.000001f));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(CostModelBackendAssignmentReportsPlan)
+{
+    const armnn::TensorInfo info({ 2, 4 }, armnn::DataType::Float32);
+
+    armnn::INetworkPtr net(armnn::INetwork::Create());
+
+    armnn::IConnectableLayer* input  = net->AddInputLayer(0, "input");
+    armnn::IConnectableLayer* floor  = net->AddFloorLayer("floor");
+    armnn::IConnectableLayer* output = net->AddOutputLayer(0, "output");
+
+    input->GetOutputSlot(0).Connect(floor->GetInputSlot(0));
+    floor->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(info);
+    floor->GetOutputSlot(0).SetTensorInfo(info);
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    armnn::OptimizerOptions optimizerOptions;
+    optimizerOptions.m_CostModelBackendAssignment = true;
+    optimizerOptions.m_MeasuredLayerCostsUs["floor"][armnn::Compute::CpuRef] = 3.0;
+
+    std::vector<std::string> messages;
+    std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+    armnn::IOptimizedNetworkPtr optimizedNet = armnn::Optimize(*net, backends, runtime->GetDeviceSpec(),
+                                                               optimizerOptions,
+                                                               armnn::Optional<std::vector<std::string>&>(messages));
+    BOOST_CHECK(optimizedNet);
+
+    auto HasMessage = [&messages](const std::string& message)
+    {
+        return std::any_of(messages.begin(), messages.end(), [&message](const std::string& m)
+        {
+            return m.find(message) != std::string::npos;
+        });
+    };
+
+    BOOST_TEST(HasMessage("INFO: Cost model backend assignment: estimated latency"));
+    BOOST_TEST(HasMessage("INFO: Layer floor of type Floor assigned to CpuRef (estimated 3 us)"));
+
+    // Without a measured cost, the estimate comes from the throughput of the backend
+    optimizerOptions.m_MeasuredLayerCostsUs.clear();
+    optimizerOptions.m_BackendThroughputs[armnn::Compute::CpuRef] = armnn::BackendThroughput{ 1e6, 1e6, 7.0 };
+
+    messages.clear();
+    optimizedNet = armnn::Optimize(*net, backends, runtime->GetDeviceSpec(), optimizerOptions,
+                                   armnn::Optional<std::vector<std::string>&>(messages));
+    BOOST_CHECK(optimizedNet);
+    BOOST_TEST(HasMessage("INFO: Layer floor of type Floor assigned to CpuRef (estimated 7 us)"));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -194,6 +194,22 @@ private:
     const int32_t m_Offset;
 };
 
+class BFloat16Decoder : public TypedIterator<const BFloat16, Decoder<float>>
+{
+public:
+    BFloat16Decoder(const BFloat16* data)
+        : TypedIterator(data) {}
+
+    BFloat16Decoder()
+        : BFloat16Decoder(nullptr) {}
+
+    float Get() const override
+    {
+        // Widening to Float32 is exact, it only shifts the stored bits
+        return m_Iterator->ToFloat32();
+    }
+};
+
 class Float16Decoder : public TypedIterator<const Half, Decoder<float>>
 {
 public:
@@ -355,6 +371,26 @@ private:
     const int32_t m_Offset;
 };
 
+class BFloat16Encoder : public TypedIterator<BFloat16, Encoder<float>>
+{
+public:
+    BFloat16Encoder(BFloat16* data)
+        : TypedIterator(data) {}
+
+    BFloat16Encoder()
+        : BFloat16Encoder(nullptr) {}
+
+    void Set(float right) override
+    {
+        *m_Iterator = BFloat16::Float32ToBFloat16(right);
+    }
+
+    float Get() const override
+    {
+        return m_Iterator->ToFloat32();
+    }
+};
+
 class Float16Encoder : public TypedIterator<Half, Encoder<float>>
 {
 public:
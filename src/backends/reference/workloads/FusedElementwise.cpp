@@ -0,0 +1,150 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "FusedElementwise.hpp"
+
+#include "Activation.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace armnn
+{
+
+namespace
+{
+
+float ApplyUnary(UnaryOperation operation, float in)
+{
+    switch (operation)
+    {
+        case UnaryOperation::Abs:
+            return std::abs(in);
+        case UnaryOperation::Exp:
+            return std::exp(in);
+        case UnaryOperation::Neg:
+            return -in;
+        case UnaryOperation::Rsqrt:
+            return 1.f / std::sqrt(in);
+        case UnaryOperation::Sqrt:
+            return std::sqrt(in);
+        default:
+            throw InvalidArgumentException("Unsupported unary operation in fused elementwise workload");
+    }
+}
+
+float ApplyBinary(FusedElementwiseOperation operation, float in0, float in1)
+{
+    switch (operation)
+    {
+        case FusedElementwiseOperation::Add:
+            return in0 + in1;
+        case FusedElementwiseOperation::Sub:
+            return in0 - in1;
+        case FusedElementwiseOperation::Mul:
+            return in0 * in1;
+        case FusedElementwiseOperation::Div:
+            return in0 / in1;
+        case FusedElementwiseOperation::Max:
+            return std::max(in0, in1);
+        case FusedElementwiseOperation::Min:
+            return std::min(in0, in1);
+        default:
+            throw InvalidArgumentException("Unsupported binary operation in fused elementwise workload");
+    }
+}
+
+} // anonymous namespace
+
+void FusedElementwise(const FusedElementwiseProgram& program,
+                      const std::vector<TensorShape>& inputShapes,
+                      const std::vector<const float*>& inputs,
+                      const TensorShape& outputShape,
+                      float* output)
+{
+    const unsigned int numDims   = outputShape.GetNumDimensions();
+    const unsigned int numInputs = static_cast<unsigned int>(inputs.size());
+
+    // Per input and per output dimension strides, zero along the broadcast dimensions.
+    // Inputs of lower rank are aligned to the innermost dimensions of the output.
+    std::vector<std::vector<unsigned int>> strides(numInputs, std::vector<unsigned int>(numDims, 0));
+    for (unsigned int i = 0; i < numInputs; ++i)
+    {
+        const TensorShape& inputShape = inputShapes[i];
+        const unsigned int inputDims  = inputShape.GetNumDimensions();
+
+        unsigned int stride = 1;
+        for (unsigned int k = 0; k < std::min(numDims, inputDims); ++k)
+        {
+            const unsigned int inputDim  = inputDims - 1 - k;
+            const unsigned int outputDim = numDims - 1 - k;
+            strides[i][outputDim] = inputShape[inputDim] > 1 ? stride : 0;
+            stride *= inputShape[inputDim];
+        }
+    }
+
+    std::vector<unsigned int> coordinates(numDims, 0);
+    std::vector<unsigned int> offsets(numInputs, 0);
+
+    const unsigned int numElements = outputShape.GetNumElements();
+    for (unsigned int index = 0; index < numElements; ++index)
+    {
+        float value = inputs[0][offsets[0]];
+
+        for (const FusedElementwiseStep& step : program.m_Steps)
+        {
+            switch (step.m_Operation)
+            {
+                case FusedElementwiseOperation::Activation:
+                {
+                    value = Activation(value, step.m_Activation.m_Function, step.m_Activation.m_A,
+                                       step.m_Activation.m_B);
+                    break;
+                }
+                case FusedElementwiseOperation::Unary:
+                {
+                    value = ApplyUnary(step.m_UnaryOperation, value);
+                    break;
+                }
+                default:
+                {
+                    const float operand = step.m_OperandIsChain ?
+                                          value : inputs[step.m_OperandIndex][offsets[step.m_OperandIndex]];
+                    value = step.m_ChainIsFirstOperand ? ApplyBinary(step.m_Operation, value, operand)
+                                                       : ApplyBinary(step.m_Operation, operand, value);
+                    break;
+                }
+            }
+        }
+
+        output[index] = value;
+
+        // Advance the output coordinates, moving every input along its own strides.
+        for (unsigned int k = 0; k < numDims; ++k)
+        {
+            const unsigned int dim = numDims - 1 - k;
+            ++coordinates[dim];
+            for (unsigned int i = 0; i < numInputs; ++i)
+            {
+                offsets[i] += strides[i][dim];
+            }
+
+            if (coordinates[dim] < outputShape[dim])
+            {
+                break;
+            }
+
+            for (unsigned int i = 0; i < numInputs; ++i)
+            {
+                offsets[i] -= strides[i][dim] * outputShape[dim];
+            }
+            coordinates[dim] = 0;
+        }
+    }
+}
+
+} //namespace armnn
@@ -0,0 +1,66 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Tensor.hpp>
+#include <armnn/Types.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+
+enum class FusedElementwiseOperation
+{
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Max,
+    Min,
+    Activation,
+    Unary
+};
+
+/// A single operation of a fused elementwise chain. The running value of the chain is combined
+/// with the workload input at m_OperandIndex for binary operations.
+struct FusedElementwiseStep
+{
+    FusedElementwiseStep()
+        : m_Operation(FusedElementwiseOperation::Add)
+        , m_OperandIndex(0)
+        , m_OperandIsChain(false)
+        , m_ChainIsFirstOperand(true)
+        , m_UnaryOperation(UnaryOperation::Abs)
+    {}
+
+    FusedElementwiseOperation m_Operation;
+    /// Index of the workload input used as the second operand of a binary operation.
+    unsigned int              m_OperandIndex;
+    /// True when both operands of a binary operation are the running value (e.g. x * x).
+    bool                      m_OperandIsChain;
+    /// False when the running value is the right hand side of a binary operation (e.g. c - x).
+    bool                      m_ChainIsFirstOperand;
+    ActivationDescriptor      m_Activation;
+    UnaryOperation            m_UnaryOperation;
+};
+
+/// The program evaluated by RefFusedElementwiseWorkload. The chain is seeded from workload input 0
+/// and the steps are applied in order to every element of the output.
+struct FusedElementwiseProgram
+{
+    std::vector<FusedElementwiseStep> m_Steps;
+};
+
+/// Evaluates the program for every element of the output, broadcasting the inputs as required.
+void FusedElementwise(const FusedElementwiseProgram& program,
+                      const std::vector<TensorShape>& inputShapes,
+                      const std::vector<const float*>& inputs,
+                      const TensorShape& outputShape,
+                      float* output);
+
+} //namespace armnn
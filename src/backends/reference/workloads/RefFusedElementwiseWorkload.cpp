@@ -0,0 +1,50 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "RefFusedElementwiseWorkload.hpp"
+#include "RefWorkloadUtils.hpp"
+
+#include <Profiling.hpp>
+
+namespace armnn
+{
+
+RefFusedElementwiseWorkload::RefFusedElementwiseWorkload(const PreCompiledQueueDescriptor& descriptor,
+                                                         const WorkloadInfo& info)
+    : BaseWorkload<PreCompiledQueueDescriptor>(descriptor, info)
+    , m_Program(static_cast<const FusedElementwiseProgram*>(descriptor.m_PreCompiledObject))
+{
+    if (m_Program == nullptr)
+    {
+        throw InvalidArgumentException("RefFusedElementwiseWorkload: missing fused elementwise program");
+    }
+
+    if (info.m_InputTensorInfos.empty() || info.m_OutputTensorInfos.size() != 1)
+    {
+        throw InvalidArgumentException("RefFusedElementwiseWorkload: expected at least one input and one output");
+    }
+
+    for (const TensorInfo& inputInfo : info.m_InputTensorInfos)
+    {
+        m_InputShapes.push_back(inputInfo.GetShape());
+    }
+    m_OutputShape = info.m_OutputTensorInfos[0].GetShape();
+}
+
+void RefFusedElementwiseWorkload::Execute() const
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefFusedElementwiseWorkload_Execute");
+
+    std::vector<const float*> inputs;
+    inputs.reserve(m_Data.m_Inputs.size());
+    for (unsigned int i = 0; i < m_Data.m_Inputs.size(); ++i)
+    {
+        inputs.push_back(GetInputTensorDataFloat(i, m_Data));
+    }
+
+    FusedElementwise(*m_Program, m_InputShapes, inputs, m_OutputShape, GetOutputTensorDataFloat(0, m_Data));
+}
+
+} // namespace armnn
@@ -0,0 +1,32 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "FusedElementwise.hpp"
+
+#include <backendsCommon/Workload.hpp>
+#include <backendsCommon/WorkloadData.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+
+/// Evaluates a chain of elementwise, unary and activation layers collapsed by RefBackend::OptimizeSubgraphView
+/// in a single pass over the output.
+class RefFusedElementwiseWorkload : public BaseWorkload<PreCompiledQueueDescriptor>
+{
+public:
+    RefFusedElementwiseWorkload(const PreCompiledQueueDescriptor& descriptor, const WorkloadInfo& info);
+    void Execute() const override;
+
+private:
+    const FusedElementwiseProgram* m_Program;
+    std::vector<TensorShape> m_InputShapes;
+    TensorShape m_OutputShape;
+};
+
+} // namespace armnn
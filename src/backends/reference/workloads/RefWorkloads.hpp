@@ -12,6 +12,7 @@
 #include "Concatenate.hpp"
 #include "ElementwiseFunction.hpp"
 #include "FullyConnected.hpp"
+#include "FusedElementwise.hpp"
 #include "Gather.hpp"
 #include "Pooling2d.hpp"
 #include "RefActivationWorkload.hpp"
@@ -22,7 +23,9 @@
 #include "RefConvolution2dWorkload.hpp"
 #include "RefConstantWorkload.hpp"
 #include "RefConcatWorkload.hpp"
+#include "RefConvertBf16ToFp32Workload.hpp"
 #include "RefConvertFp16ToFp32Workload.hpp"
+#include "RefConvertFp32ToBf16Workload.hpp"
 #include "RefConvertFp32ToFp16Workload.hpp"
 #include "RefDebugWorkload.hpp"
 #include "RefDepthToSpaceWorkload.hpp"
@@ -34,6 +37,7 @@
 #include "RefElementwiseUnaryWorkload.hpp"
 #include "RefFullyConnectedWorkload.hpp"
 #include "RefFloorWorkload.hpp"
+#include "RefFusedElementwiseWorkload.hpp"
 #include "RefFakeQuantizationFloat32Workload.hpp"
 #include "RefGatherWorkload.hpp"
 #include "RefInstanceNormalizationWorkload.hpp"
@@ -0,0 +1,194 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "BufferedFileWriter.hpp"
+#include "CaptureFile.hpp"
+
+#include <boost/assert.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+
+#include <algorithm>
+
+namespace armnn
+{
+
+namespace profiling
+{
+
+BufferedFileWriter::BufferedFileWriter(bool compress, size_t bufferSize, size_t numberOfBuffers)
+    : m_Compress(compress)
+    , m_BufferSize(std::max<size_t>(bufferSize, 1))
+    , m_NumberOfBuffers(std::max<size_t>(numberOfBuffers, 2))
+    , m_AllocatedBuffers(0)
+    , m_Writing(false)
+    , m_Stop(false)
+    , m_Good(false)
+{}
+
+BufferedFileWriter::~BufferedFileWriter()
+{
+    Close();
+}
+
+bool BufferedFileWriter::Open(const std::string& fileName)
+{
+    BOOST_ASSERT(!IsOpen());
+
+    m_File.open(fileName, std::ios::out | std::ios::binary);
+    if (!m_File.is_open())
+    {
+        return false;
+    }
+
+    if (m_Compress)
+    {
+        std::vector<unsigned char> header;
+        AppendCompressedCaptureFileHeader(header);
+        m_File.write(reinterpret_cast<const char*>(header.data()),
+                     boost::numeric_cast<std::streamsize>(header.size()));
+    }
+
+    m_Good = m_File.good();
+    m_CurrentBuffer.reserve(m_BufferSize);
+    m_AllocatedBuffers = 1;
+    m_Stop = false;
+    m_WriterThread = std::thread(&BufferedFileWriter::WriteBuffers, this);
+    return m_Good;
+}
+
+bool BufferedFileWriter::Write(const unsigned char* data, size_t length)
+{
+    if (!IsOpen())
+    {
+        return false;
+    }
+
+    // Only full buffers are handed to the writing thread, which leaves the current one to the calling thread
+    while (length > 0)
+    {
+        const size_t copyLength = std::min(length, m_BufferSize - m_CurrentBuffer.size());
+        m_CurrentBuffer.insert(m_CurrentBuffer.end(), data, data + copyLength);
+        data += copyLength;
+        length -= copyLength;
+
+        if (m_CurrentBuffer.size() == m_BufferSize)
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            SubmitCurrentBuffer(lock);
+        }
+    }
+
+    return m_Good.load();
+}
+
+bool BufferedFileWriter::Flush()
+{
+    if (!IsOpen())
+    {
+        return false;
+    }
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    if (!m_CurrentBuffer.empty())
+    {
+        SubmitCurrentBuffer(lock);
+    }
+    m_BufferWritten.wait(lock, [&]() { return m_SubmittedBuffers.empty() && !m_Writing; });
+
+    // The writing thread is idle until more data is submitted
+    m_File.flush();
+    if (!m_File.good())
+    {
+        m_Good = false;
+    }
+    return m_Good.load();
+}
+
+void BufferedFileWriter::Close()
+{
+    if (!IsOpen())
+    {
+        return;
+    }
+
+    Flush();
+
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        m_Stop = true;
+    }
+    m_BufferSubmitted.notify_one();
+    m_WriterThread.join();
+
+    m_File.close();
+    m_CurrentBuffer = std::vector<unsigned char>();
+    m_FreeBuffers.clear();
+    m_AllocatedBuffers = 0;
+}
+
+void BufferedFileWriter::SubmitCurrentBuffer(std::unique_lock<std::mutex>& lock)
+{
+    m_SubmittedBuffers.push_back(std::move(m_CurrentBuffer));
+    m_BufferSubmitted.notify_one();
+
+    // Takes a free buffer, or allocates one while under the limit, or else waits for a buffer to be written
+    m_BufferWritten.wait(lock, [&]() { return !m_FreeBuffers.empty() || m_AllocatedBuffers < m_NumberOfBuffers; });
+    if (m_FreeBuffers.empty())
+    {
+        m_CurrentBuffer = std::vector<unsigned char>();
+        m_CurrentBuffer.reserve(m_BufferSize);
+        ++m_AllocatedBuffers;
+    }
+    else
+    {
+        m_CurrentBuffer = std::move(m_FreeBuffers.back());
+        m_FreeBuffers.pop_back();
+    }
+}
+
+void BufferedFileWriter::WriteBuffers()
+{
+    std::vector<unsigned char> compressedBuffer;
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true)
+    {
+        m_BufferSubmitted.wait(lock, [&]() { return m_Stop || !m_SubmittedBuffers.empty(); });
+        if (m_SubmittedBuffers.empty())
+        {
+            // Stopped, with all the buffers written
+            break;
+        }
+
+        std::vector<unsigned char> buffer = std::move(m_SubmittedBuffers.front());
+        m_SubmittedBuffers.pop_front();
+        m_Writing = true;
+        lock.unlock();
+
+        const std::vector<unsigned char>* output = &buffer;
+        if (m_Compress)
+        {
+            compressedBuffer.clear();
+            AppendCompressedCaptureBlock(buffer.data(), buffer.size(), compressedBuffer);
+            output = &compressedBuffer;
+        }
+        m_File.write(reinterpret_cast<const char*>(output->data()),
+                     boost::numeric_cast<std::streamsize>(output->size()));
+        if (!m_File.good())
+        {
+            m_Good = false;
+        }
+        buffer.clear();
+
+        lock.lock();
+        m_FreeBuffers.push_back(std::move(buffer));
+        m_Writing = false;
+        m_BufferWritten.notify_all();
+    }
+}
+
+} // namespace profiling
+
+} // namespace armnn
@@ -0,0 +1,72 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace armnn
+{
+
+namespace profiling
+{
+
+/// Writes a file from a thread of its own, so the thread producing the data only copies it into large buffers.
+/// The data can be compressed in the format read by CaptureFileReader, by the writing thread too.
+/// A bounded number of buffers is used: when they are all waiting to be written, writes wait for one to be free.
+class BufferedFileWriter
+{
+public:
+    BufferedFileWriter(bool compress = false, size_t bufferSize = 1u << 20, size_t numberOfBuffers = 4);
+
+    ~BufferedFileWriter();
+
+    /// Opens the file for writing and starts the writing thread, returning false if the file can not be opened
+    bool Open(const std::string& fileName);
+
+    bool IsOpen() const { return m_File.is_open(); }
+
+    /// Returns false if the writer is not open or if writing the file failed, then or earlier
+    bool Write(const unsigned char* data, size_t length);
+
+    /// Waits until all the data written so far is in the file
+    bool Flush();
+
+    /// Flushes the data and closes the file
+    void Close();
+
+private:
+    void SubmitCurrentBuffer(std::unique_lock<std::mutex>& lock);
+    void WriteBuffers();
+
+    const bool   m_Compress;
+    const size_t m_BufferSize;
+    const size_t m_NumberOfBuffers;
+
+    std::ofstream m_File;
+    std::thread m_WriterThread;
+
+    std::mutex m_Mutex;
+    std::condition_variable m_BufferSubmitted;
+    std::condition_variable m_BufferWritten;
+    std::vector<unsigned char> m_CurrentBuffer;
+    std::deque<std::vector<unsigned char>> m_SubmittedBuffers;
+    std::vector<std::vector<unsigned char>> m_FreeBuffers;
+    size_t m_AllocatedBuffers;
+    bool m_Writing;
+    bool m_Stop;
+    std::atomic<bool> m_Good;
+};
+
+} // namespace profiling
+
+} // namespace armnn
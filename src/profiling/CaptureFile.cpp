@@ -0,0 +1,343 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "CaptureFile.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/numeric/conversion/cast.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace armnn
+{
+
+namespace profiling
+{
+
+namespace
+{
+
+// Every sequence of the compressed form is a token, the literals to copy and a match to copy from the output already
+// decompressed. The high and low nibbles of the token are the number of literals and the length of the match minus
+// the minimum match length, with extra bytes to add to them when a nibble is 15. The last sequence has no match.
+constexpr size_t   g_MinMatchLength = 4;
+constexpr size_t   g_MaxMatchOffset = 65535;
+constexpr unsigned g_HashBits       = 14;
+constexpr uint32_t g_NoPosition     = 0xffffffff;
+
+uint32_t ReadUint32Unaligned(const unsigned char* data)
+{
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+void AppendLength(size_t length, std::vector<unsigned char>& output)
+{
+    while (length >= 255)
+    {
+        output.push_back(255);
+        length -= 255;
+    }
+    output.push_back(static_cast<unsigned char>(length));
+}
+
+void AppendSequence(const unsigned char* literals,
+                    size_t literalCount,
+                    size_t matchOffset,
+                    size_t matchLength,
+                    std::vector<unsigned char>& output)
+{
+    const size_t matchCode = matchLength == 0 ? 0 : matchLength - g_MinMatchLength;
+
+    output.push_back(static_cast<unsigned char>((std::min<size_t>(literalCount, 15) << 4) |
+                                                std::min<size_t>(matchCode, 15)));
+    if (literalCount >= 15)
+    {
+        AppendLength(literalCount - 15, output);
+    }
+    output.insert(output.end(), literals, literals + literalCount);
+
+    if (matchLength == 0)
+    {
+        // The last sequence
+        return;
+    }
+    output.push_back(static_cast<unsigned char>(matchOffset & 0xff));
+    output.push_back(static_cast<unsigned char>(matchOffset >> 8));
+    if (matchCode >= 15)
+    {
+        AppendLength(matchCode - 15, output);
+    }
+}
+
+size_t ReadLength(size_t length, const unsigned char*& input, const unsigned char* inputEnd)
+{
+    if (length != 15)
+    {
+        return length;
+    }
+
+    unsigned char extra = 255;
+    while (extra == 255)
+    {
+        if (input == inputEnd)
+        {
+            throw RuntimeException("Corrupt capture block: truncated length");
+        }
+        extra = *input++;
+        length += extra;
+    }
+    return length;
+}
+
+void AppendUint32(uint32_t value, std::vector<unsigned char>& output)
+{
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        output.push_back(static_cast<unsigned char>(value >> (8 * i)));
+    }
+}
+
+uint32_t ReadUint32LittleEndian(const unsigned char* data)
+{
+    return static_cast<uint32_t>(data[0])         | static_cast<uint32_t>(data[1]) << 8 |
+           static_cast<uint32_t>(data[2]) << 16   | static_cast<uint32_t>(data[3]) << 24;
+}
+
+} // anonymous namespace
+
+void CompressCaptureBlock(const unsigned char* data, size_t length, std::vector<unsigned char>& output)
+{
+    // The positions of the last sequences of the minimum match length seen, by hash
+    std::vector<uint32_t> lastPositions(1u << g_HashBits, g_NoPosition);
+
+    size_t anchor = 0;
+    size_t position = 0;
+    while (position + g_MinMatchLength <= length)
+    {
+        const uint32_t sequence = ReadUint32Unaligned(data + position);
+        const uint32_t hash = (sequence * 2654435761u) >> (32 - g_HashBits);
+        const uint32_t candidate = lastPositions[hash];
+        lastPositions[hash] = static_cast<uint32_t>(position);
+
+        if (candidate == g_NoPosition ||
+            position - candidate > g_MaxMatchOffset ||
+            ReadUint32Unaligned(data + candidate) != sequence)
+        {
+            ++position;
+            continue;
+        }
+
+        size_t matchLength = g_MinMatchLength;
+        while (position + matchLength < length && data[candidate + matchLength] == data[position + matchLength])
+        {
+            ++matchLength;
+        }
+
+        AppendSequence(data + anchor, position - anchor, position - candidate, matchLength, output);
+        position += matchLength;
+        anchor = position;
+    }
+
+    AppendSequence(data + anchor, length - anchor, 0, 0, output);
+}
+
+void DecompressCaptureBlock(const unsigned char* data, size_t length, unsigned char* output, size_t rawLength)
+{
+    const unsigned char* input = data;
+    const unsigned char* inputEnd = data + length;
+    size_t outputLength = 0;
+
+    // A block always ends with a sequence without a match, so running out of input before it means it was truncated
+    while (true)
+    {
+        if (input == inputEnd)
+        {
+            throw RuntimeException("Corrupt capture block: missing last sequence");
+        }
+        const unsigned char token = *input++;
+
+        const size_t literalCount = ReadLength(static_cast<size_t>(token >> 4), input, inputEnd);
+        if (literalCount > static_cast<size_t>(inputEnd - input) || literalCount > rawLength - outputLength)
+        {
+            throw RuntimeException("Corrupt capture block: literals out of bounds");
+        }
+        std::memcpy(output + outputLength, input, literalCount);
+        input += literalCount;
+        outputLength += literalCount;
+
+        if (input == inputEnd)
+        {
+            // The last sequence has no match
+            break;
+        }
+
+        if (inputEnd - input < 2)
+        {
+            throw RuntimeException("Corrupt capture block: truncated match");
+        }
+        const size_t matchOffset = static_cast<size_t>(input[0]) | static_cast<size_t>(input[1]) << 8;
+        input += 2;
+        const size_t matchLength = ReadLength(static_cast<size_t>(token & 0x0f), input, inputEnd) + g_MinMatchLength;
+        if (matchOffset == 0 || matchOffset > outputLength || matchLength > rawLength - outputLength)
+        {
+            throw RuntimeException("Corrupt capture block: match out of bounds");
+        }
+
+        // The match may overlap the bytes it produces, so it is copied byte by byte
+        const unsigned char* match = output + outputLength - matchOffset;
+        for (size_t i = 0; i < matchLength; ++i)
+        {
+            output[outputLength + i] = match[i];
+        }
+        outputLength += matchLength;
+    }
+
+    if (outputLength != rawLength)
+    {
+        throw RuntimeException("Corrupt capture block: unexpected size");
+    }
+}
+
+void AppendCompressedCaptureFileHeader(std::vector<unsigned char>& output)
+{
+    AppendUint32(COMPRESSED_CAPTURE_FILE_MAGIC, output);
+    AppendUint32(COMPRESSED_CAPTURE_FILE_VERSION, output);
+}
+
+void AppendCompressedCaptureBlock(const unsigned char* data, size_t length, std::vector<unsigned char>& output)
+{
+    const size_t headerOffset = output.size();
+    AppendUint32(boost::numeric_cast<uint32_t>(length), output);
+    AppendUint32(0, output);
+
+    const size_t blockOffset = output.size();
+    CompressCaptureBlock(data, length, output);
+    if (output.size() - blockOffset >= length)
+    {
+        // Stores the block as it is
+        output.resize(blockOffset);
+        output.insert(output.end(), data, data + length);
+    }
+
+    const uint32_t storedSize = boost::numeric_cast<uint32_t>(output.size() - blockOffset);
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        output[headerOffset + sizeof(uint32_t) + i] = static_cast<unsigned char>(storedSize >> (8 * i));
+    }
+}
+
+CaptureFileReader::CaptureFileReader(const std::string& fileName)
+    : m_File(fileName, std::ios::in | std::ios::binary)
+    , m_Compressed(false)
+    , m_BlockOffset(0)
+{
+    if (!m_File.is_open())
+    {
+        throw RuntimeException("Failed to open \"" + fileName + "\" for reading");
+    }
+
+    unsigned char header[COMPRESSED_CAPTURE_FILE_HEADER_SIZE];
+    m_File.read(reinterpret_cast<char*>(header), sizeof(header));
+    if (m_File.gcount() == sizeof(header) && ReadUint32LittleEndian(header) == COMPRESSED_CAPTURE_FILE_MAGIC)
+    {
+        if (ReadUint32LittleEndian(header + sizeof(uint32_t)) != COMPRESSED_CAPTURE_FILE_VERSION)
+        {
+            throw RuntimeException("Unsupported version of compressed capture file \"" + fileName + "\"");
+        }
+        m_Compressed = true;
+    }
+    else
+    {
+        // A raw capture file is read as it is, from its start
+        m_File.clear();
+        m_File.seekg(0);
+    }
+}
+
+size_t CaptureFileReader::Read(unsigned char* data, size_t length)
+{
+    if (!m_Compressed)
+    {
+        m_File.read(reinterpret_cast<char*>(data), boost::numeric_cast<std::streamsize>(length));
+        return boost::numeric_cast<size_t>(m_File.gcount());
+    }
+
+    size_t readLength = 0;
+    while (readLength < length)
+    {
+        if (m_BlockOffset == m_Block.size() && !ReadNextBlock())
+        {
+            break;
+        }
+
+        const size_t copyLength = std::min(length - readLength, m_Block.size() - m_BlockOffset);
+        std::memcpy(data + readLength, m_Block.data() + m_BlockOffset, copyLength);
+        m_BlockOffset += copyLength;
+        readLength += copyLength;
+    }
+    return readLength;
+}
+
+std::vector<unsigned char> CaptureFileReader::ReadAll()
+{
+    std::vector<unsigned char> content;
+    unsigned char chunk[4096];
+    size_t readLength = 0;
+    while ((readLength = Read(chunk, sizeof(chunk))) != 0)
+    {
+        content.insert(content.end(), chunk, chunk + readLength);
+    }
+    return content;
+}
+
+bool CaptureFileReader::ReadNextBlock()
+{
+    unsigned char header[COMPRESSED_CAPTURE_BLOCK_HEADER_SIZE];
+    m_File.read(reinterpret_cast<char*>(header), sizeof(header));
+    if (m_File.gcount() == 0)
+    {
+        return false;
+    }
+    if (m_File.gcount() != sizeof(header))
+    {
+        throw RuntimeException("Corrupt capture file: truncated block header");
+    }
+
+    const uint32_t rawSize = ReadUint32LittleEndian(header);
+    const uint32_t storedSize = ReadUint32LittleEndian(header + sizeof(uint32_t));
+    if (storedSize > rawSize)
+    {
+        throw RuntimeException("Corrupt capture file: invalid block size");
+    }
+
+    m_Block.resize(rawSize);
+    m_BlockOffset = 0;
+    if (storedSize == rawSize)
+    {
+        m_File.read(reinterpret_cast<char*>(m_Block.data()), storedSize);
+    }
+    else
+    {
+        m_StoredBlock.resize(storedSize);
+        m_File.read(reinterpret_cast<char*>(m_StoredBlock.data()), storedSize);
+    }
+    if (m_File.gcount() != storedSize)
+    {
+        throw RuntimeException("Corrupt capture file: truncated block");
+    }
+    if (storedSize != rawSize)
+    {
+        DecompressCaptureBlock(m_StoredBlock.data(), storedSize, m_Block.data(), rawSize);
+    }
+    return true;
+}
+
+} // namespace profiling
+
+} // namespace armnn
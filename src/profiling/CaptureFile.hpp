@@ -0,0 +1,71 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace armnn
+{
+
+namespace profiling
+{
+
+/// A compressed capture file starts with this magic ("ANPZ" in file order) and the version of its format. It is
+/// followed by blocks of the capture, each one made of its raw size, its stored size and its stored bytes: a block
+/// whose stored size is its raw size is stored as is, otherwise it is compressed with CompressCaptureBlock().
+/// Raw capture files start with the header of the stream metadata packet, so they can not be taken for compressed
+/// ones.
+constexpr uint32_t COMPRESSED_CAPTURE_FILE_MAGIC   = 0x5a504e41;
+constexpr uint32_t COMPRESSED_CAPTURE_FILE_VERSION = 1;
+constexpr size_t   COMPRESSED_CAPTURE_FILE_HEADER_SIZE = 2 * sizeof(uint32_t);
+constexpr size_t   COMPRESSED_CAPTURE_BLOCK_HEADER_SIZE = 2 * sizeof(uint32_t);
+
+/// Appends the compressed form of the data to the output, with a fast byte oriented LZ77 coding which suits the
+/// repetitive headers and identifiers of the profiling packets.
+void CompressCaptureBlock(const unsigned char* data, size_t length, std::vector<unsigned char>& output);
+
+/// Decompresses a block of the given raw size, throwing a RuntimeException if it is corrupt.
+void DecompressCaptureBlock(const unsigned char* data, size_t length, unsigned char* output, size_t rawLength);
+
+/// Appends the header of a compressed capture file to the output.
+void AppendCompressedCaptureFileHeader(std::vector<unsigned char>& output);
+
+/// Appends a block of a compressed capture file to the output, compressed unless that does not make it smaller.
+void AppendCompressedCaptureBlock(const unsigned char* data, size_t length, std::vector<unsigned char>& output);
+
+/// Reads the content of a capture file, whether it is compressed or not, streaming the compressed ones block by block.
+class CaptureFileReader
+{
+public:
+    /// Throws a RuntimeException if the file can not be opened
+    CaptureFileReader(const std::string& fileName);
+
+    bool IsCompressed() const { return m_Compressed; }
+
+    /// Reads up to the given number of bytes of the capture, returning the number of bytes read: 0 at its end.
+    /// Throws a RuntimeException if the file is corrupt.
+    size_t Read(unsigned char* data, size_t length);
+
+    /// Reads the rest of the capture
+    std::vector<unsigned char> ReadAll();
+
+private:
+    bool ReadNextBlock();
+
+    std::ifstream m_File;
+    bool m_Compressed;
+    std::vector<unsigned char> m_Block;
+    size_t m_BlockOffset;
+    std::vector<unsigned char> m_StoredBlock;
+};
+
+} // namespace profiling
+
+} // namespace armnn
@@ -74,13 +74,48 @@ bool CaptureData::IsCounterIdInCaptureData(uint16_t counterId)
 void Holder::SetCaptureData(uint32_t capturePeriod,
                             const std::vector<uint16_t>& counterIds,
                             const std::set<armnn::BackendId>& activeBackends)
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(m_CaptureThreadMutex);
+
+        m_CaptureData.SetCapturePeriod(capturePeriod);
+        m_CaptureData.SetCounterIds(counterIds);
+        m_CaptureData.SetActiveBackends(activeBackends);
+        ++m_CaptureDataVersion;
+    }
+
+    m_CaptureDataChanged.notify_all();
+}
+
+uint64_t Holder::GetCaptureDataVersion() const
 {
     std::lock_guard<std::mutex> lockGuard(m_CaptureThreadMutex);
 
-    m_CaptureData.SetCapturePeriod(capturePeriod);
-    m_CaptureData.SetCounterIds(counterIds);
-    m_CaptureData.SetActiveBackends(activeBackends);
+    return m_CaptureDataVersion;
+}
+
+void Holder::WaitForCaptureDataChange(uint64_t version) const
+{
+    std::unique_lock<std::mutex> lock(m_CaptureThreadMutex);
+
+    m_CaptureDataChanged.wait(lock, [&]() { return m_CaptureDataVersion != version; });
+}
+
+bool Holder::WaitForCaptureDataChange(uint64_t version, std::chrono::steady_clock::time_point deadline) const
+{
+    std::unique_lock<std::mutex> lock(m_CaptureThreadMutex);
+
+    return m_CaptureDataChanged.wait_until(lock, deadline, [&]() { return m_CaptureDataVersion != version; });
+}
+
+void Holder::WakeUpWaiters() const
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(m_CaptureThreadMutex);
+        ++m_CaptureDataVersion;
+    }
 
+    m_CaptureDataChanged.notify_all();
 }
 
 } // namespace profiling
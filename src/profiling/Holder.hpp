@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
 #include <mutex>
 #include <vector>
 #include <set>
@@ -52,15 +54,32 @@ class Holder
 {
 public:
     Holder()
-        : m_CaptureData() {}
+        : m_CaptureData()
+        , m_CaptureDataVersion(0) {}
     CaptureData GetCaptureData() const;
     void SetCaptureData(uint32_t capturePeriod,
                         const std::vector<uint16_t>& counterIds,
                         const std::set<armnn::BackendId>& activeBackends);
 
+    /// Returns a version of the capture data which changes each time it is set, or its waiters are woken up.
+    /// It must be read before the capture data for a wait on it not to miss a change.
+    uint64_t GetCaptureDataVersion() const;
+
+    /// Blocks until the version of the capture data differs from the given one.
+    void WaitForCaptureDataChange(uint64_t version) const;
+
+    /// Blocks until the version of the capture data differs from the given one, or until the deadline.
+    /// Returns false if the deadline was reached without a change.
+    bool WaitForCaptureDataChange(uint64_t version, std::chrono::steady_clock::time_point deadline) const;
+
+    /// Wakes up the threads waiting for a change of the capture data, such as a capture thread being stopped.
+    void WakeUpWaiters() const;
+
 private:
     mutable std::mutex m_CaptureThreadMutex;
+    mutable std::condition_variable m_CaptureDataChanged;
     CaptureData m_CaptureData;
+    mutable uint64_t m_CaptureDataVersion;
 };
 
 } // namespace profiling
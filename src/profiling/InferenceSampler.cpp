@@ -0,0 +1,74 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "InferenceSampler.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/format.hpp>
+
+#include <cmath>
+
+namespace armnn
+{
+
+namespace profiling
+{
+
+namespace
+{
+
+constexpr unsigned int g_ProbabilityBits = 53;
+
+// The finalizer of SplitMix64, which spreads consecutive indexes over the whole range of the hash
+uint64_t HashInferenceIndex(uint64_t inferenceIndex)
+{
+    uint64_t hash = inferenceIndex + 0x9e3779b97f4a7c15ull;
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+    return hash ^ (hash >> 31);
+}
+
+} // anonymous namespace
+
+InferenceSampler::InferenceSampler()
+    : m_Options()
+    , m_SamplesEveryInference(true)
+    , m_ProbabilityThreshold(1ull << g_ProbabilityBits)
+    , m_InferenceCount(0)
+{}
+
+void InferenceSampler::SetOptions(const InferenceSamplingOptions& options)
+{
+    if (options.m_Interval == 0)
+    {
+        throw InvalidArgumentException("The inference sampling interval must be at least 1");
+    }
+    if (!(options.m_Probability > 0.0f && options.m_Probability <= 1.0f))
+    {
+        throw InvalidArgumentException(boost::str(boost::format("The inference sampling probability must be "
+                                                                "greater than 0 and at most 1, not %1%")
+                                                  % options.m_Probability));
+    }
+
+    m_Options = options;
+    m_SamplesEveryInference = options.m_Interval == 1 && options.m_Probability == 1.0f;
+    m_ProbabilityThreshold = static_cast<uint64_t>(std::ldexp(static_cast<double>(options.m_Probability),
+                                                              static_cast<int>(g_ProbabilityBits)));
+    m_InferenceCount.store(0, std::memory_order_relaxed);
+}
+
+bool InferenceSampler::SampleInference(uint64_t inferenceIndex) const
+{
+    if (inferenceIndex % m_Options.m_Interval != 0)
+    {
+        return false;
+    }
+    return (HashInferenceIndex(inferenceIndex) >> (64 - g_ProbabilityBits)) < m_ProbabilityThreshold;
+}
+
+} // namespace profiling
+
+} // namespace armnn
@@ -0,0 +1,54 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/IProfiler.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace armnn
+{
+
+namespace profiling
+{
+
+/// Decides which inferences are profiled according to InferenceSamplingOptions, once per inference. The inferences
+/// sampled with a probability are picked by a hash of their index rather than a random number generator, so the
+/// decision takes no lock and the same inferences are picked on every run.
+class InferenceSampler
+{
+public:
+    InferenceSampler();
+
+    /// Sets the sampling options and starts counting the inferences again, while no inference is being sampled.
+    /// Throws an InvalidArgumentException if the options are invalid.
+    void SetOptions(const InferenceSamplingOptions& options);
+
+    const InferenceSamplingOptions& GetOptions() const { return m_Options; }
+
+    /// Returns whether every inference is sampled
+    bool SamplesEveryInference() const { return m_SamplesEveryInference; }
+
+    /// Decides whether the next inference is sampled, and can be called from any thread
+    bool SampleNextInference()
+    {
+        return m_SamplesEveryInference || SampleInference(m_InferenceCount.fetch_add(1, std::memory_order_relaxed));
+    }
+
+private:
+    bool SampleInference(uint64_t inferenceIndex) const;
+
+    InferenceSamplingOptions m_Options;
+    bool m_SamplesEveryInference;
+    // The inferences whose hash, on 53 bits, is below this threshold pass the probability test
+    uint64_t m_ProbabilityThreshold;
+    std::atomic<uint64_t> m_InferenceCount;
+};
+
+} // namespace profiling
+
+} // namespace armnn
@@ -0,0 +1,64 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "InferenceTimelineRecorder.hpp"
+#include "LabelsAndEventClasses.hpp"
+
+namespace armnn
+{
+
+namespace profiling
+{
+
+InferenceTimelineRecorder& InferenceTimelineRecorder::GetThreadRecorder()
+{
+    thread_local InferenceTimelineRecorder recorder;
+    return recorder;
+}
+
+void InferenceTimelineRecorder::BeginInference(size_t numberOfWorkloads)
+{
+    // Keeps the capacity of the previous inferences, so recording the workloads does not allocate
+    m_Workloads.clear();
+    m_Workloads.reserve(numberOfWorkloads);
+
+    m_ThreadId = std::this_thread::get_id();
+    m_InferenceEnd = 0;
+    m_InferenceStart = GetTimestamp();
+}
+
+void InferenceTimelineRecorder::SendInference(TimelineUtilityMethods& timelineUtils,
+                                              ProfilingGuid networkGuid,
+                                              ProfilingGuid inferenceGuid) const
+{
+    timelineUtils.CreateTypedEntity(inferenceGuid, LabelsAndEventClasses::INFERENCE_GUID);
+    timelineUtils.CreateRelationship(ProfilingRelationshipType::RetentionLink, networkGuid, inferenceGuid);
+    timelineUtils.RecordEvent(inferenceGuid,
+                              LabelsAndEventClasses::ARMNN_PROFILING_SOL_EVENT_CLASS,
+                              m_InferenceStart,
+                              m_ThreadId);
+
+    for (const WorkloadRecord& workload : m_Workloads)
+    {
+        ProfilingDynamicGuid workloadInferenceGuid =
+            timelineUtils.RecordWorkloadInferenceAndStartOfLifeEvent(workload.m_WorkloadGuid,
+                                                                     inferenceGuid,
+                                                                     workload.m_Start,
+                                                                     m_ThreadId);
+        if (workload.m_End != 0)
+        {
+            timelineUtils.RecordEndOfLifeEvent(workloadInferenceGuid, workload.m_End, m_ThreadId);
+        }
+    }
+
+    timelineUtils.RecordEvent(inferenceGuid,
+                              LabelsAndEventClasses::ARMNN_PROFILING_EOL_EVENT_CLASS,
+                              m_InferenceEnd,
+                              m_ThreadId);
+}
+
+} // namespace profiling
+
+} // namespace armnn
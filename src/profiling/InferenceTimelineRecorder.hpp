@@ -0,0 +1,70 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "ProfilingUtils.hpp"
+#include "TimelineUtilityMethods.hpp"
+
+#include <armnn/Types.hpp>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace armnn
+{
+
+namespace profiling
+{
+
+/// Records when an inference and each of its workloads start and end as fixed size records, so that the timeline
+/// packets describing them can be sent in bulk once the inference is over, rather than while it executes.
+/// Recording a workload costs a timestamp and a store into a buffer which is kept between inferences.
+class InferenceTimelineRecorder
+{
+public:
+    /// Returns the recorder of the calling thread
+    static InferenceTimelineRecorder& GetThreadRecorder();
+
+    /// Clears the records of the previous inference, and records the start of a new one
+    void BeginInference(size_t numberOfWorkloads);
+
+    /// Records the end of the inference
+    void EndInference() { m_InferenceEnd = GetTimestamp(); }
+
+    void BeginWorkload(ProfilingGuid workloadGuid)
+    {
+        m_Workloads.push_back({ workloadGuid, GetTimestamp(), 0 });
+    }
+
+    /// Records the end of the workload which began last
+    void EndWorkload() { m_Workloads.back().m_End = GetTimestamp(); }
+
+    /// Sends the timeline packets of the recorded inference, leaving them to be committed by the caller
+    void SendInference(TimelineUtilityMethods& timelineUtils,
+                       ProfilingGuid networkGuid,
+                       ProfilingGuid inferenceGuid) const;
+
+private:
+    InferenceTimelineRecorder() = default;
+
+    struct WorkloadRecord
+    {
+        ProfilingGuid m_WorkloadGuid;
+        uint64_t      m_Start;
+        /// Zero if the workload did not end, as it threw
+        uint64_t      m_End;
+    };
+
+    std::thread::id m_ThreadId;
+    uint64_t m_InferenceStart = 0;
+    uint64_t m_InferenceEnd = 0;
+    std::vector<WorkloadRecord> m_Workloads;
+};
+
+} // namespace profiling
+
+} // namespace armnn
@@ -0,0 +1,143 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace armnn
+{
+
+namespace profiling
+{
+
+/// A bounded queue which any number of threads can push to and pop from without locking.
+/// Each slot holds a sequence number telling whether it is free for the push, or full for the pop, of a given
+/// position, so that producers and consumers only contend on the position they advance.
+/// T is meant to be a pointer or another trivially copyable value.
+template <typename T>
+class LockFreeRing
+{
+public:
+    /// The capacity is rounded up to a power of two.
+    explicit LockFreeRing(size_t minCapacity)
+        : m_Capacity(RoundUpToPowerOfTwo(minCapacity))
+        , m_Mask(m_Capacity - 1)
+        , m_Slots(new Slot[m_Capacity])
+        , m_PushPosition(0)
+        , m_PopPosition(0)
+    {
+        for (size_t i = 0; i < m_Capacity; ++i)
+        {
+            m_Slots[i].m_Sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    LockFreeRing(const LockFreeRing&) = delete;
+    LockFreeRing& operator=(const LockFreeRing&) = delete;
+
+    /// Returns false if the ring is full.
+    bool TryPush(T value)
+    {
+        size_t position = m_PushPosition.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot& slot = m_Slots[position & m_Mask];
+            const size_t sequence = slot.m_Sequence.load(std::memory_order_acquire);
+            const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+            if (difference == 0)
+            {
+                // The slot is free for this position: claim the position, then fill the slot
+                if (m_PushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    slot.m_Value = value;
+                    slot.m_Sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                // The slot still holds the value pushed a lap ago
+                return false;
+            }
+            else
+            {
+                // Another producer claimed the position
+                position = m_PushPosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Returns false if the ring is empty.
+    bool TryPop(T& value)
+    {
+        size_t position = m_PopPosition.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot& slot = m_Slots[position & m_Mask];
+            const size_t sequence = slot.m_Sequence.load(std::memory_order_acquire);
+            const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+            if (difference == 0)
+            {
+                // The slot is full for this position: claim the position, then free the slot for the next lap
+                if (m_PopPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    value = slot.m_Value;
+                    slot.m_Sequence.store(position + m_Capacity, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                // Nothing was pushed at this position yet
+                return false;
+            }
+            else
+            {
+                // Another consumer claimed the position
+                position = m_PopPosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    size_t GetCapacity() const { return m_Capacity; }
+
+private:
+    struct Slot
+    {
+        std::atomic<size_t> m_Sequence;
+        T m_Value;
+    };
+
+    static size_t RoundUpToPowerOfTwo(size_t value)
+    {
+        size_t result = 2;
+        while (result < value)
+        {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    static constexpr size_t CacheLineSize = 64;
+
+    const size_t m_Capacity;
+    const size_t m_Mask;
+    std::unique_ptr<Slot[]> m_Slots;
+
+    // The positions are kept on cache lines of their own, as producers and consumers update them all the time
+    char m_PaddingBeforePush[CacheLineSize];
+    std::atomic<size_t> m_PushPosition;
+    char m_PaddingBeforePop[CacheLineSize - sizeof(std::atomic<size_t>)];
+    std::atomic<size_t> m_PopPosition;
+    char m_PaddingAfterPop[CacheLineSize - sizeof(std::atomic<size_t>)];
+};
+
+} // namespace profiling
+
+} // namespace armnn
@@ -7,6 +7,7 @@
 
 #include <armnn/Logging.hpp>
 
+#include <algorithm>
 #include <iostream>
 
 namespace armnn
@@ -30,14 +31,20 @@ void PeriodicCounterCapture::Start()
     // Keep the capture procedure going until the capture thread is signalled to stop
     m_KeepRunning.store(true);
 
+    {
+        std::lock_guard<std::mutex> lockGuard(m_CaptureTimingStatsMutex);
+        m_CaptureTimingStats = CaptureTimingStats();
+    }
+
     // Start the new capture thread.
     m_PeriodCaptureThread = std::thread(&PeriodicCounterCapture::Capture, this, std::ref(m_ReadCounterValues));
 }
 
 void PeriodicCounterCapture::Stop()
 {
-    // Signal the capture thread to stop
+    // Signal the capture thread to stop, waking it up if it is waiting for its next capture
     m_KeepRunning.store(false);
+    m_CaptureDataHolder.WakeUpWaiters();
 
     // Check that the capture thread is running
     if (m_PeriodCaptureThread.joinable())
@@ -73,63 +80,123 @@ void PeriodicCounterCapture::DispatchPeriodicCounterCapturePacket(
     }
 }
 
+CaptureTimingStats PeriodicCounterCapture::GetCaptureTimingStats() const
+{
+    std::lock_guard<std::mutex> lockGuard(m_CaptureTimingStatsMutex);
+    return m_CaptureTimingStats;
+}
+
+void PeriodicCounterCapture::CaptureCounterValues(const IReadCounterValues& readCounterValues,
+                                                  const CaptureData& captureData)
+{
+    const std::vector<uint16_t>& counterIds = captureData.GetCounterIds();
+    if(counterIds.size() != 0)
+    {
+        std::vector<CounterValue> counterValues;
+
+        auto numCounters = counterIds.size();
+        counterValues.reserve(numCounters);
+
+        // Create a vector of pairs of CounterIndexes and Values
+        for (uint16_t index = 0; index < numCounters; ++index)
+        {
+            auto requestedId = counterIds[index];
+            uint32_t counterValue = 0;
+            try
+            {
+                counterValue = readCounterValues.GetCounterValue(requestedId);
+            }
+            catch (const Exception& e)
+            {
+                // Report the error and continue
+                ARMNN_LOG(warning) << "An error has occurred when getting a counter value: "
+                                   << e.what();
+                continue;
+            }
+
+            counterValues.emplace_back(CounterValue {requestedId, counterValue });
+        }
+
+        // Send Periodic Counter Capture Packet for the Timestamp
+        m_SendCounterPacket.SendPeriodicCounterCapturePacket(GetTimestamp(), counterValues);
+    }
+
+    // Report counter values for each active backend
+    auto activeBackends = captureData.GetActiveBackends();
+    for_each(activeBackends.begin(), activeBackends.end(), [&](const armnn::BackendId& backendId)
+    {
+        DispatchPeriodicCounterCapturePacket(
+            backendId, m_BackendProfilingContext.at(backendId)->ReportCounterValues());
+    });
+}
+
 void PeriodicCounterCapture::Capture(const IReadCounterValues& readCounterValues)
 {
+    using Clock = std::chrono::steady_clock;
+
+    // The captures are scheduled on absolute deadlines, so the time taken by the captures does not delay the next ones
+    Clock::time_point deadline;
+    uint32_t scheduledPeriod = 0;
+
     do
     {
+        // The version is read before the capture data and the running flag, for the waits not to miss their changes
+        const uint64_t captureDataVersion = m_CaptureDataHolder.GetCaptureDataVersion();
+
         // Check if the current capture data indicates that there's data capture
         auto currentCaptureData = ReadCaptureData();
-        const std::vector<uint16_t>& counterIds = currentCaptureData.GetCounterIds();
         const uint32_t capturePeriod = currentCaptureData.GetCapturePeriod();
 
         if (capturePeriod == 0)
         {
-            // No data capture, wait the indicated capture period (milliseconds), if it is not zero
-            std::this_thread::sleep_for(std::chrono::milliseconds(50u));
+            // No data capture, sleep until the capture data changes or the thread is stopped
+            scheduledPeriod = 0;
+            if (m_KeepRunning.load())
+            {
+                m_CaptureDataHolder.WaitForCaptureDataChange(captureDataVersion);
+            }
             continue;
         }
 
-        if(counterIds.size() != 0)
+        const std::chrono::microseconds period(capturePeriod);
+        Clock::time_point now = Clock::now();
+        if (capturePeriod != scheduledPeriod)
         {
-            std::vector<CounterValue> counterValues;
-
-            auto numCounters = counterIds.size();
-            counterValues.reserve(numCounters);
+            // Captures straight away with a new capture period, and every period from then on
+            scheduledPeriod = capturePeriod;
+            deadline = now;
+        }
 
-            // Create a vector of pairs of CounterIndexes and Values
-            for (uint16_t index = 0; index < numCounters; ++index)
+        if (now < deadline)
+        {
+            // Sleeps until the deadline, unless the capture data changes or the thread is stopped before
+            if (m_KeepRunning.load())
             {
-                auto requestedId = counterIds[index];
-                uint32_t counterValue = 0;
-                try
-                {
-                    counterValue = readCounterValues.GetCounterValue(requestedId);
-                }
-                catch (const Exception& e)
-                {
-                    // Report the error and continue
-                    ARMNN_LOG(warning) << "An error has occurred when getting a counter value: "
-                                       << e.what();
-                    continue;
-                }
-
-                counterValues.emplace_back(CounterValue {requestedId, counterValue });
+                m_CaptureDataHolder.WaitForCaptureDataChange(captureDataVersion, deadline);
             }
-
-            // Send Periodic Counter Capture Packet for the Timestamp
-            m_SendCounterPacket.SendPeriodicCounterCapturePacket(GetTimestamp(), counterValues);
+            continue;
         }
 
-        // Report counter values for each active backend
-        auto activeBackends = currentCaptureData.GetActiveBackends();
-        for_each(activeBackends.begin(), activeBackends.end(), [&](const armnn::BackendId& backendId)
+        const auto lateness = std::chrono::duration_cast<std::chrono::microseconds>(now - deadline);
+
+        CaptureCounterValues(readCounterValues, currentCaptureData);
+
+        // Schedules the next capture, skipping the deadlines the capture overran rather than catching up with them
+        uint64_t missedCaptures = 0;
+        deadline += period;
+        now = Clock::now();
+        if (deadline <= now)
         {
-            DispatchPeriodicCounterCapturePacket(
-                backendId, m_BackendProfilingContext.at(backendId)->ReportCounterValues());
-        });
+            const auto overrun = (now - deadline) / period + 1;
+            missedCaptures = static_cast<uint64_t>(overrun);
+            deadline += overrun * period;
+        }
 
-        // Wait the indicated capture period (microseconds)
-        std::this_thread::sleep_for(std::chrono::microseconds(capturePeriod));
+        std::lock_guard<std::mutex> lockGuard(m_CaptureTimingStatsMutex);
+        ++m_CaptureTimingStats.m_CaptureCount;
+        m_CaptureTimingStats.m_MissedCaptureCount += missedCaptures;
+        m_CaptureTimingStats.m_TotalLateness += lateness;
+        m_CaptureTimingStats.m_MaxLateness = std::max(m_CaptureTimingStats.m_MaxLateness, lateness);
     }
     while (m_KeepRunning.load());
 }
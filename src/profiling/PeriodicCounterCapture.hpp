@@ -13,6 +13,7 @@
 #include "CounterIdMap.hpp"
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <thread>
 #include <armnn/backends/profiling/IBackendProfilingContext.hpp>
@@ -23,6 +24,23 @@ namespace armnn
 namespace profiling
 {
 
+/// Timing of the captures against their deadlines, which are a whole number of capture periods apart
+struct CaptureTimingStats
+{
+    CaptureTimingStats()
+        : m_CaptureCount(0)
+        , m_MissedCaptureCount(0)
+        , m_TotalLateness(0)
+        , m_MaxLateness(0)
+    {}
+
+    uint64_t m_CaptureCount;
+    /// Number of deadlines which were skipped as the previous capture overran them
+    uint64_t m_MissedCaptureCount;
+    std::chrono::microseconds m_TotalLateness;
+    std::chrono::microseconds m_MaxLateness;
+};
+
 class PeriodicCounterCapture final : public IPeriodicCounterCapture
 {
 public:
@@ -47,7 +65,12 @@ public:
     void Stop() override;
     bool IsRunning() const { return m_IsRunning; }
 
+    /// Returns the timing of the captures made since the capture thread was last started
+    CaptureTimingStats GetCaptureTimingStats() const;
+
 private:
+    void CaptureCounterValues(const IReadCounterValues& readCounterValues, const CaptureData& captureData);
+
     CaptureData ReadCaptureData();
     void Capture(const IReadCounterValues& readCounterValues);
     void DispatchPeriodicCounterCapturePacket(
@@ -62,6 +85,8 @@ private:
     const ICounterMappings&   m_CounterIdMap;
     const std::unordered_map<armnn::BackendId,
             std::shared_ptr<armnn::profiling::IBackendProfilingContext>>& m_BackendProfilingContext;
+    mutable std::mutex        m_CaptureTimingStatsMutex;
+    CaptureTimingStats        m_CaptureTimingStats;
 };
 
 } // namespace profiling
@@ -23,6 +23,7 @@ ProfilingConnectionDumpToFileDecorator::ProfilingConnectionDumpToFileDecorator(
     bool ignoreFailures)
       : m_Connection(std::move(connection))
       , m_Options(options)
+      , m_OutgoingDumpFileWriter(options.m_CompressOutgoingCaptureFile)
       , m_IgnoreFileErrors(ignoreFailures)
 {
     if (!m_Connection)
@@ -45,8 +46,7 @@ void ProfilingConnectionDumpToFileDecorator::Close()
 {
     m_IncomingDumpFileStream.flush();
     m_IncomingDumpFileStream.close();
-    m_OutgoingDumpFileStream.flush();
-    m_OutgoingDumpFileStream.close();
+    m_OutgoingDumpFileWriter.Close();
     m_Connection->Close();
 }
 
@@ -79,8 +79,7 @@ bool ProfilingConnectionDumpToFileDecorator::OpenIncomingDumpFile()
 
 bool ProfilingConnectionDumpToFileDecorator::OpenOutgoingDumpFile()
 {
-    m_OutgoingDumpFileStream.open(m_Options.m_OutgoingCaptureFile, std::ios::out | std::ios::binary);
-    return m_OutgoingDumpFileStream.is_open();
+    return m_OutgoingDumpFileWriter.Open(m_Options.m_OutgoingCaptureFile);
 }
 
 
@@ -119,7 +118,8 @@ void ProfilingConnectionDumpToFileDecorator::DumpIncomingToFile(const Packet& pa
     }
 }
 
-/// Dumps outgoing data into the file specified by m_Settings.m_OutgoingDumpFileName.
+/// Dumps outgoing data into the file specified by m_Settings.m_OutgoingDumpFileName, compressed if requested.
+/// The data is written to the file by a thread of its own, so write errors may only be reported by later calls.
 /// If m_IgnoreFileErrors is set to true in m_Settings, write errors will be ignored,
 /// i.e. the method will not throw an exception if it encounters an error while trying
 /// to write the data into the specified file. However, the return value will still
@@ -130,7 +130,7 @@ void ProfilingConnectionDumpToFileDecorator::DumpIncomingToFile(const Packet& pa
 bool ProfilingConnectionDumpToFileDecorator::DumpOutgoingToFile(const unsigned char* buffer, uint32_t length)
 {
     bool success = true;
-    if (!m_OutgoingDumpFileStream.is_open())
+    if (!m_OutgoingDumpFileWriter.IsOpen())
     {
         // attempt to open dump file
         success &= OpenOutgoingDumpFile();
@@ -141,9 +141,7 @@ bool ProfilingConnectionDumpToFileDecorator::DumpOutgoingToFile(const unsigned c
     }
 
     // attempt to write binary data
-    m_OutgoingDumpFileStream.write(reinterpret_cast<const char*>(buffer),
-                                   boost::numeric_cast<std::streamsize>(length));
-    success &= m_OutgoingDumpFileStream.good();
+    success &= m_OutgoingDumpFileWriter.Write(buffer, length);
     if (!(success || m_IgnoreFileErrors))
     {
         Fail("Error writing outgoing packet of " + std::to_string(length) + " bytes");
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "BufferedFileWriter.hpp"
 #include "IProfilingConnection.hpp"
 #include "ProfilingUtils.hpp"
 
@@ -54,7 +55,7 @@ private:
     std::unique_ptr<IProfilingConnection>              m_Connection;
     Runtime::CreationOptions::ExternalProfilingOptions m_Options;
     std::ofstream                                      m_IncomingDumpFileStream;
-    std::ofstream                                      m_OutgoingDumpFileStream;
+    BufferedFileWriter                                 m_OutgoingDumpFileWriter;
     bool                                               m_IgnoreFileErrors;
 };
 
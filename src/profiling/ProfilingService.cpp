@@ -19,7 +19,8 @@ namespace profiling
 void ProfilingService::ResetExternalProfilingOptions(const ExternalProfilingOptions& options,
                                                      bool resetProfilingService)
 {
-    // Update the profiling options
+    // Update the profiling options, the sampling options first as they throw if they are invalid
+    m_TimelineSampler.SetOptions(options.m_TimelineSampling);
     m_Options = options;
 
     // Check if the profiling service needs to be reset
@@ -212,15 +213,13 @@ uint16_t ProfilingService::GetCounterCount() const
 
 bool ProfilingService::IsCounterRegistered(uint16_t counterUid) const
 {
-    return counterUid < m_CounterIndex.size();
+    return counterUid < m_CounterValues.GetCounterCount();
 }
 
 uint32_t ProfilingService::GetCounterValue(uint16_t counterUid) const
 {
     CheckCounterUid(counterUid);
-    std::atomic<uint32_t>* counterValuePtr = m_CounterIndex.at(counterUid);
-    BOOST_ASSERT(counterValuePtr);
-    return counterValuePtr->load(std::memory_order::memory_order_relaxed);
+    return m_CounterValues.GetValue(counterUid);
 }
 
 const ICounterMappings& ProfilingService::GetCounterMappings() const
@@ -248,33 +247,25 @@ void ProfilingService::SetCaptureData(uint32_t capturePeriod,
 void ProfilingService::SetCounterValue(uint16_t counterUid, uint32_t value)
 {
     CheckCounterUid(counterUid);
-    std::atomic<uint32_t>* counterValuePtr = m_CounterIndex.at(counterUid);
-    BOOST_ASSERT(counterValuePtr);
-    counterValuePtr->store(value, std::memory_order::memory_order_relaxed);
+    m_CounterValues.SetValue(counterUid, value);
 }
 
 uint32_t ProfilingService::AddCounterValue(uint16_t counterUid, uint32_t value)
 {
     CheckCounterUid(counterUid);
-    std::atomic<uint32_t>* counterValuePtr = m_CounterIndex.at(counterUid);
-    BOOST_ASSERT(counterValuePtr);
-    return counterValuePtr->fetch_add(value, std::memory_order::memory_order_relaxed);
+    return m_CounterValues.AddValue(counterUid, value);
 }
 
 uint32_t ProfilingService::SubtractCounterValue(uint16_t counterUid, uint32_t value)
 {
     CheckCounterUid(counterUid);
-    std::atomic<uint32_t>* counterValuePtr = m_CounterIndex.at(counterUid);
-    BOOST_ASSERT(counterValuePtr);
-    return counterValuePtr->fetch_sub(value, std::memory_order::memory_order_relaxed);
+    return m_CounterValues.SubtractValue(counterUid, value);
 }
 
 uint32_t ProfilingService::IncrementCounterValue(uint16_t counterUid)
 {
     CheckCounterUid(counterUid);
-    std::atomic<uint32_t>* counterValuePtr = m_CounterIndex.at(counterUid);
-    BOOST_ASSERT(counterValuePtr);
-    return counterValuePtr->operator++(std::memory_order::memory_order_relaxed);
+    return m_CounterValues.IncrementValue(counterUid);
 }
 
 ProfilingDynamicGuid ProfilingService::NextGuid()
@@ -384,18 +375,9 @@ void ProfilingService::Initialize()
 
 void ProfilingService::InitializeCounterValue(uint16_t counterUid)
 {
-    // Increase the size of the counter index if necessary
-    if (counterUid >= m_CounterIndex.size())
-    {
-        m_CounterIndex.resize(boost::numeric_cast<size_t>(counterUid) + 1);
-    }
-
-    // Create a new atomic counter and add it to the list
-    m_CounterValues.emplace_back(0);
-
-    // Register the new counter to the counter index for quick access
-    std::atomic<uint32_t>* counterValuePtr = &(m_CounterValues.back());
-    m_CounterIndex.at(counterUid) = counterValuePtr;
+    // Increase the number of counters if necessary, and start the counter from zero
+    m_CounterValues.Resize(boost::numeric_cast<size_t>(counterUid) + 1);
+    m_CounterValues.SetValue(counterUid, 0);
 }
 
 void ProfilingService::Reset()
@@ -404,8 +386,7 @@ void ProfilingService::Reset()
     Stop();
 
     // ...then delete all the counter data and configuration...
-    m_CounterIndex.clear();
-    m_CounterValues.clear();
+    m_CounterValues.Clear();
     m_CounterDirectory.Clear();
     m_CounterIdMap.Reset();
     m_BufferManager.Reset();
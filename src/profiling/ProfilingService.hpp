@@ -5,7 +5,6 @@
 
 #pragma once
 
-#include "BufferManager.hpp"
 #include "CommandHandler.hpp"
 #include "ConnectionAcknowledgedCommandHandler.hpp"
 #include "CounterDirectory.hpp"
@@ -13,6 +12,7 @@
 #include "ICounterRegistry.hpp"
 #include "ICounterValues.hpp"
 #include "IProfilingService.hpp"
+#include "InferenceSampler.hpp"
 #include "PeriodicCounterCapture.hpp"
 #include "PeriodicCounterSelectionCommandHandler.hpp"
 #include "PerJobCounterSelectionCommandHandler.hpp"
@@ -20,9 +20,11 @@
 #include "ProfilingGuidGenerator.hpp"
 #include "ProfilingStateMachine.hpp"
 #include "RequestCounterDirectoryCommandHandler.hpp"
+#include "RingBufferManager.hpp"
 #include "SendCounterPacket.hpp"
 #include "SendThread.hpp"
 #include "SendTimelinePacket.hpp"
+#include "ShardedCounterValues.hpp"
 #include "TimelinePacketWriterFactory.hpp"
 #include <armnn/backends/profiling/IBackendProfilingContext.hpp>
 
@@ -45,8 +47,6 @@ public:
     using ExternalProfilingOptions = IRuntime::CreationOptions::ExternalProfilingOptions;
     using IProfilingConnectionFactoryPtr = std::unique_ptr<IProfilingConnectionFactory>;
     using IProfilingConnectionPtr = std::unique_ptr<IProfilingConnection>;
-    using CounterIndices = std::vector<std::atomic<uint32_t>*>;
-    using CounterValues = std::list<std::atomic<uint32_t>>;
 
     // Getter for the singleton instance
     static ProfilingService& Instance()
@@ -111,6 +111,9 @@ public:
     /// Check if the profiling is enabled
     bool IsEnabled() { return m_Options.m_EnableProfiling; }
 
+    /// Decides whether the timeline of the next inference is recorded, according to the timeline sampling options
+    bool SampleNextInference() { return m_TimelineSampler.SampleNextInference(); }
+
 private:
     // Copy/move constructors/destructors and copy/move assignment operators are deleted
     ProfilingService(const ProfilingService&) = delete;
@@ -129,17 +132,19 @@ private:
 
     // Profiling service components
     ExternalProfilingOptions m_Options;
+    InferenceSampler m_TimelineSampler;
     CounterDirectory m_CounterDirectory;
     CounterIdMap m_CounterIdMap;
     IProfilingConnectionFactoryPtr m_ProfilingConnectionFactory;
     IProfilingConnectionPtr m_ProfilingConnection;
     ProfilingStateMachine m_StateMachine;
-    CounterIndices m_CounterIndex;
-    CounterValues m_CounterValues;
+    // Indexed by counter UID, and sharded for the threads of different cores not to contend on their updates
+    ShardedCounterValues m_CounterValues;
     CommandHandlerRegistry m_CommandHandlerRegistry;
     PacketVersionResolver m_PacketVersionResolver;
     CommandHandler m_CommandHandler;
-    BufferManager m_BufferManager;
+    // Lock free, so that the threads recording timeline and counter packets do not contend with each other
+    RingBufferManager m_BufferManager;
     SendCounterPacket m_SendCounterPacket;
     SendThread m_SendThread;
     SendTimelinePacket m_SendTimelinePacket;
@@ -159,11 +164,11 @@ protected:
     // Default constructor/destructor kept protected for testing
     ProfilingService()
         : m_Options()
+        , m_TimelineSampler()
         , m_CounterDirectory()
         , m_ProfilingConnectionFactory(new ProfilingConnectionFactory())
         , m_ProfilingConnection()
         , m_StateMachine()
-        , m_CounterIndex()
         , m_CounterValues()
         , m_CommandHandlerRegistry()
         , m_PacketVersionResolver()
@@ -246,7 +251,7 @@ protected:
         return instance.m_SendThread.WaitForPacketSent(timeout);
     }
 
-    BufferManager& GetBufferManager(ProfilingService& instance)
+    RingBufferManager& GetBufferManager(ProfilingService& instance)
     {
         return instance.m_BufferManager;
     }
@@ -0,0 +1,174 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "RingBufferManager.hpp"
+#include "PacketBuffer.hpp"
+
+#include <boost/assert.hpp>
+
+#include <memory>
+#include <thread>
+
+namespace armnn
+{
+
+namespace profiling
+{
+
+RingBufferManager::RingBufferManager(unsigned int numberOfBuffers,
+                                     unsigned int maxPacketSize,
+                                     unsigned int maxReserveRetries)
+    : m_MaxBufferSize(maxPacketSize)
+    , m_NumberOfBuffers(numberOfBuffers)
+    , m_MaxReserveRetries(maxReserveRetries)
+    , m_AvailableRing(numberOfBuffers)
+    , m_ReadableRing(numberOfBuffers)
+    , m_BackPressureCount(0)
+    , m_DroppedPacketCount(0)
+    , m_Consumer(nullptr)
+{
+    Initialize();
+}
+
+RingBufferManager::~RingBufferManager()
+{
+    DeleteBuffers();
+}
+
+IPacketBufferPtr RingBufferManager::Reserve(unsigned int requestedSize, unsigned int& reservedSize)
+{
+    reservedSize = 0;
+    if (requestedSize > m_MaxBufferSize)
+    {
+        m_DroppedPacketCount.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    IPacketBuffer* buffer = nullptr;
+    for (unsigned int retries = 0; !m_AvailableRing.TryPop(buffer); ++retries)
+    {
+        if (retries == 0)
+        {
+            // All the buffers are waiting to be read: have the consumer drain them
+            m_BackPressureCount.fetch_add(1, std::memory_order_relaxed);
+            FlushReadList();
+        }
+        if (retries == m_MaxReserveRetries)
+        {
+            m_DroppedPacketCount.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        std::this_thread::yield();
+    }
+
+    reservedSize = requestedSize;
+    return IPacketBufferPtr(buffer);
+}
+
+void RingBufferManager::Commit(IPacketBufferPtr& packetBuffer, unsigned int size, bool notifyConsumer)
+{
+    packetBuffer->Commit(size);
+
+    // The ring has room for every buffer of the manager, so the push only fails for a buffer from elsewhere
+    const bool pushed = m_ReadableRing.TryPush(packetBuffer.get());
+    BOOST_ASSERT_MSG(pushed, "Committed a packet buffer which does not belong to the buffer manager");
+    if (pushed)
+    {
+        packetBuffer.release();
+    }
+
+    if (notifyConsumer)
+    {
+        FlushReadList();
+    }
+}
+
+void RingBufferManager::Initialize()
+{
+    for (unsigned int i = 0; i < m_NumberOfBuffers; ++i)
+    {
+        IPacketBufferPtr buffer = std::make_unique<PacketBuffer>(m_MaxBufferSize);
+        const bool pushed = m_AvailableRing.TryPush(buffer.get());
+        BOOST_ASSERT(pushed);
+        if (pushed)
+        {
+            buffer.release();
+        }
+    }
+}
+
+void RingBufferManager::DeleteBuffers()
+{
+    IPacketBuffer* buffer = nullptr;
+    while (m_AvailableRing.TryPop(buffer))
+    {
+        delete buffer;
+    }
+    while (m_ReadableRing.TryPop(buffer))
+    {
+        delete buffer;
+    }
+}
+
+void RingBufferManager::Release(IPacketBufferPtr& packetBuffer)
+{
+    packetBuffer->Release();
+    MakeAvailable(packetBuffer);
+}
+
+void RingBufferManager::Reset()
+{
+    //This method should only be called once all threads have been joined
+    DeleteBuffers();
+    m_BackPressureCount.store(0, std::memory_order_relaxed);
+    m_DroppedPacketCount.store(0, std::memory_order_relaxed);
+
+    Initialize();
+}
+
+IPacketBufferPtr RingBufferManager::GetReadableBuffer()
+{
+    IPacketBuffer* buffer = nullptr;
+    if (m_ReadableRing.TryPop(buffer))
+    {
+        return IPacketBufferPtr(buffer);
+    }
+    return nullptr;
+}
+
+void RingBufferManager::MarkRead(IPacketBufferPtr& packetBuffer)
+{
+    packetBuffer->MarkRead();
+    MakeAvailable(packetBuffer);
+}
+
+void RingBufferManager::MakeAvailable(IPacketBufferPtr& packetBuffer)
+{
+    const bool pushed = m_AvailableRing.TryPush(packetBuffer.get());
+    BOOST_ASSERT_MSG(pushed, "Returned a packet buffer which does not belong to the buffer manager");
+    if (pushed)
+    {
+        packetBuffer.release();
+    }
+}
+
+void RingBufferManager::SetConsumer(IConsumer* consumer)
+{
+    m_Consumer.store(consumer, std::memory_order_release);
+}
+
+void RingBufferManager::FlushReadList()
+{
+    // notify consumer that packet is ready to read
+    IConsumer* consumer = m_Consumer.load(std::memory_order_acquire);
+    if (consumer != nullptr)
+    {
+        consumer->SetReadyToRead();
+    }
+}
+
+} // namespace profiling
+
+} // namespace armnn
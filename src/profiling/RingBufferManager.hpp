@@ -0,0 +1,92 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "IBufferManager.hpp"
+#include "IConsumer.hpp"
+#include "LockFreeRing.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace armnn
+{
+
+namespace profiling
+{
+
+/// A buffer manager which hands packet buffers between the threads sending profiling packets and the thread reading
+/// them through lock free rings, so that producers never wait on each other or on the reader.
+/// Readable buffers are returned in the order they were committed in.
+/// When no buffer is available, Reserve() notifies the consumer and retries up to maxReserveRetries times before
+/// giving up, which is counted as a dropped packet.
+class RingBufferManager : public IBufferManager
+{
+public:
+    RingBufferManager(unsigned int numberOfBuffers = 64,
+                      unsigned int maxPacketSize = 4096,
+                      unsigned int maxReserveRetries = 64);
+
+    ~RingBufferManager();
+
+    IPacketBufferPtr Reserve(unsigned int requestedSize, unsigned int& reservedSize) override;
+
+    /// This method should only be called once all threads have been joined
+    void Reset();
+
+    void Commit(IPacketBufferPtr& packetBuffer, unsigned int size, bool notifyConsumer = true) override;
+
+    void Release(IPacketBufferPtr& packetBuffer) override;
+
+    IPacketBufferPtr GetReadableBuffer() override;
+
+    void MarkRead(IPacketBufferPtr& packetBuffer) override;
+
+    /// Set Consumer on the buffer manager to be notified when there is a Commit
+    /// Can only be one consumer
+    void SetConsumer(IConsumer* consumer) override;
+
+    /// Notify the Consumer buffer can be read
+    void FlushReadList() override;
+
+    unsigned int GetNumberOfBuffers() const { return m_NumberOfBuffers; }
+
+    /// Number of times Reserve() found no buffer available and had to wait for the consumer to return one
+    uint64_t GetBackPressureCount() const { return m_BackPressureCount.load(std::memory_order_relaxed); }
+
+    /// Number of packets which could not be reserved, as they were too large or no buffer became available
+    uint64_t GetDroppedPacketCount() const { return m_DroppedPacketCount.load(std::memory_order_relaxed); }
+
+private:
+    void Initialize();
+    void DeleteBuffers();
+
+    // Returns a buffer to the available ring
+    void MakeAvailable(IPacketBufferPtr& packetBuffer);
+
+    // Maximum buffer size
+    unsigned int m_MaxBufferSize;
+    // Number of buffers
+    unsigned int m_NumberOfBuffers;
+    // Number of times Reserve() retries when no buffer is available
+    unsigned int m_MaxReserveRetries;
+
+    // Ring of available packet buffers, owned by the manager while they are in it
+    LockFreeRing<IPacketBuffer*> m_AvailableRing;
+
+    // Ring of readable packet buffers, owned by the manager while they are in it
+    LockFreeRing<IPacketBuffer*> m_ReadableRing;
+
+    std::atomic<uint64_t> m_BackPressureCount;
+    std::atomic<uint64_t> m_DroppedPacketCount;
+
+    // Consumer thread to notify packet is ready to read
+    std::atomic<IConsumer*> m_Consumer;
+};
+
+} // namespace profiling
+
+} // namespace armnn
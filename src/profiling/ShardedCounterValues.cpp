@@ -0,0 +1,155 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ShardedCounterValues.hpp"
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <thread>
+
+namespace armnn
+{
+
+namespace profiling
+{
+
+namespace
+{
+
+// Bounds the memory of the counters on machines with a large number of hardware threads
+constexpr unsigned int g_MaxShardCount = 64;
+
+unsigned int RoundUpToPowerOfTwo(unsigned int value)
+{
+    unsigned int powerOfTwo = 1;
+    while (powerOfTwo < value)
+    {
+        powerOfTwo <<= 1;
+    }
+    return powerOfTwo;
+}
+
+} // anonymous namespace
+
+ShardedCounterValues::ShardedCounterValues()
+    : ShardedCounterValues(std::min(std::max(std::thread::hardware_concurrency(), 1u), g_MaxShardCount))
+{}
+
+ShardedCounterValues::ShardedCounterValues(unsigned int numberOfShards)
+    : m_ShardCount(RoundUpToPowerOfTwo(std::max(numberOfShards, 1u)))
+    , m_CounterCount(0)
+    , m_ShardStride(0)
+    , m_Storage()
+    , m_Values(nullptr)
+{}
+
+void ShardedCounterValues::Resize(size_t counterCount)
+{
+    if (counterCount <= m_CounterCount)
+    {
+        return;
+    }
+
+    const size_t shardStride = (counterCount + ValuesPerCacheLine - 1) / ValuesPerCacheLine * ValuesPerCacheLine;
+    const size_t valueCount = m_ShardCount * shardStride;
+
+    // Allocates an extra cache line to align the values on a cache line
+    std::unique_ptr<std::atomic<uint32_t>[]> storage(new std::atomic<uint32_t>[valueCount + ValuesPerCacheLine]);
+    const size_t misalignment = reinterpret_cast<uintptr_t>(storage.get()) % CacheLineSize;
+    std::atomic<uint32_t>* values =
+        storage.get() + (misalignment == 0 ? 0 : (CacheLineSize - misalignment) / sizeof(std::atomic<uint32_t>));
+
+    for (unsigned int shardIndex = 0; shardIndex < m_ShardCount; ++shardIndex)
+    {
+        for (size_t counterIndex = 0; counterIndex < shardStride; ++counterIndex)
+        {
+            const uint32_t value = counterIndex < m_CounterCount ?
+                                   GetValueOfShard(shardIndex, counterIndex).load(std::memory_order_relaxed) : 0;
+            values[shardIndex * shardStride + counterIndex].store(value, std::memory_order_relaxed);
+        }
+    }
+
+    m_Storage = std::move(storage);
+    m_Values = values;
+    m_ShardStride = shardStride;
+    m_CounterCount = counterCount;
+}
+
+void ShardedCounterValues::Clear()
+{
+    m_Storage.reset();
+    m_Values = nullptr;
+    m_ShardStride = 0;
+    m_CounterCount = 0;
+}
+
+uint32_t ShardedCounterValues::GetValue(size_t counterIndex) const
+{
+    BOOST_ASSERT(counterIndex < m_CounterCount);
+
+    // The values of the shards wrap around like a single counter would
+    uint32_t value = 0;
+    for (unsigned int shardIndex = 0; shardIndex < m_ShardCount; ++shardIndex)
+    {
+        value += GetValueOfShard(shardIndex, counterIndex).load(std::memory_order_relaxed);
+    }
+    return value;
+}
+
+void ShardedCounterValues::SetValue(size_t counterIndex, uint32_t value)
+{
+    BOOST_ASSERT(counterIndex < m_CounterCount);
+
+    std::atomic<uint32_t>& threadValue = GetValueOfThread(counterIndex);
+    for (unsigned int shardIndex = 0; shardIndex < m_ShardCount; ++shardIndex)
+    {
+        std::atomic<uint32_t>& shardValue = GetValueOfShard(shardIndex, counterIndex);
+        if (&shardValue != &threadValue)
+        {
+            shardValue.store(0, std::memory_order_relaxed);
+        }
+    }
+    threadValue.store(value, std::memory_order_relaxed);
+}
+
+uint32_t ShardedCounterValues::AddValue(size_t counterIndex, uint32_t value)
+{
+    BOOST_ASSERT(counterIndex < m_CounterCount);
+    return GetValueOfThread(counterIndex).fetch_add(value, std::memory_order_relaxed);
+}
+
+uint32_t ShardedCounterValues::SubtractValue(size_t counterIndex, uint32_t value)
+{
+    BOOST_ASSERT(counterIndex < m_CounterCount);
+    return GetValueOfThread(counterIndex).fetch_sub(value, std::memory_order_relaxed);
+}
+
+uint32_t ShardedCounterValues::IncrementValue(size_t counterIndex)
+{
+    BOOST_ASSERT(counterIndex < m_CounterCount);
+    return GetValueOfThread(counterIndex).fetch_add(1, std::memory_order_relaxed);
+}
+
+std::atomic<uint32_t>& ShardedCounterValues::GetValueOfShard(unsigned int shardIndex, size_t counterIndex) const
+{
+    return m_Values[shardIndex * m_ShardStride + counterIndex];
+}
+
+std::atomic<uint32_t>& ShardedCounterValues::GetValueOfThread(size_t counterIndex) const
+{
+    return GetValueOfShard(GetThreadIndex() & (m_ShardCount - 1), counterIndex);
+}
+
+unsigned int ShardedCounterValues::GetThreadIndex()
+{
+    static std::atomic<unsigned int> nextThreadIndex(0);
+    thread_local unsigned int threadIndex = nextThreadIndex.fetch_add(1, std::memory_order_relaxed);
+    return threadIndex;
+}
+
+} // namespace profiling
+
+} // namespace armnn
@@ -0,0 +1,74 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace armnn
+{
+
+namespace profiling
+{
+
+/// Stores the values of counters in shards, each thread updating the counters of its own shard so that the threads
+/// of different cores do not contend for the same cache lines. Reading a counter sums its values over the shards.
+/// The shards are laid out contiguously, each one starting on a cache line of its own.
+class ShardedCounterValues
+{
+public:
+    /// Uses a shard per hardware thread
+    ShardedCounterValues();
+
+    /// The number of shards is rounded up to a power of two
+    explicit ShardedCounterValues(unsigned int numberOfShards);
+
+    /// Adds zero valued counters up to the given number of counters, keeping the values of the existing ones.
+    /// It must not be called while the counters are updated.
+    void Resize(size_t counterCount);
+
+    /// Removes all the counters. It must not be called while the counters are updated.
+    void Clear();
+
+    size_t GetCounterCount() const { return m_CounterCount; }
+    unsigned int GetShardCount() const { return m_ShardCount; }
+
+    /// Returns the sum of the values of the counter in all the shards
+    uint32_t GetValue(size_t counterIndex) const;
+
+    /// Sets the value of the counter in the shard of the calling thread, and clears it in the other shards.
+    /// Updates made concurrently from other threads may be lost.
+    void SetValue(size_t counterIndex, uint32_t value);
+
+    /// The updates return the value of the counter in the shard of the calling thread before they are applied
+    uint32_t AddValue(size_t counterIndex, uint32_t value);
+    uint32_t SubtractValue(size_t counterIndex, uint32_t value);
+    uint32_t IncrementValue(size_t counterIndex);
+
+private:
+    static constexpr size_t CacheLineSize = 64;
+    static constexpr size_t ValuesPerCacheLine = CacheLineSize / sizeof(std::atomic<uint32_t>);
+
+    std::atomic<uint32_t>& GetValueOfShard(unsigned int shardIndex, size_t counterIndex) const;
+    std::atomic<uint32_t>& GetValueOfThread(size_t counterIndex) const;
+
+    /// Returns a distinct index for each thread, in order of their first use of the counters
+    static unsigned int GetThreadIndex();
+
+    unsigned int m_ShardCount;
+    size_t m_CounterCount;
+    /// Distance between the values of a counter in consecutive shards, a whole number of cache lines
+    size_t m_ShardStride;
+    std::unique_ptr<std::atomic<uint32_t>[]> m_Storage;
+    /// The first value of the storage which starts a cache line
+    std::atomic<uint32_t>* m_Values;
+};
+
+} // namespace profiling
+
+} // namespace armnn
@@ -367,6 +367,14 @@ ProfilingDynamicGuid TimelineUtilityMethods::RecordEvent(ProfilingGuid entityGui
     // Get the thread id
     std::thread::id threadId = std::this_thread::get_id();
 
+    return RecordEvent(entityGuid, eventClassGuid, timestamp, threadId);
+}
+
+ProfilingDynamicGuid TimelineUtilityMethods::RecordEvent(ProfilingGuid entityGuid,
+                                                         ProfilingStaticGuid eventClassGuid,
+                                                         uint64_t timestamp,
+                                                         std::thread::id threadId)
+{
     // Generate a GUID for the event
     ProfilingDynamicGuid eventGuid = ProfilingService::Instance().NextGuid();
 
@@ -396,12 +404,23 @@ ProfilingDynamicGuid TimelineUtilityMethods::RecordEvent(ProfilingGuid entityGui
 
 ProfilingDynamicGuid TimelineUtilityMethods::RecordWorkloadInferenceAndStartOfLifeEvent(ProfilingGuid workloadGuid,
                                                                                         ProfilingGuid inferenceGuid)
+{
+    return RecordWorkloadInferenceAndStartOfLifeEvent(workloadGuid,
+                                                      inferenceGuid,
+                                                      GetTimestamp(),
+                                                      std::this_thread::get_id());
+}
+
+ProfilingDynamicGuid TimelineUtilityMethods::RecordWorkloadInferenceAndStartOfLifeEvent(ProfilingGuid workloadGuid,
+                                                                                        ProfilingGuid inferenceGuid,
+                                                                                        uint64_t timestamp,
+                                                                                        std::thread::id threadId)
 {
     ProfilingDynamicGuid workloadInferenceGuid = ProfilingService::Instance().NextGuid();
     CreateTypedEntity(workloadInferenceGuid, LabelsAndEventClasses::WORKLOAD_EXECUTION_GUID);
     CreateRelationship(ProfilingRelationshipType::RetentionLink, inferenceGuid, workloadInferenceGuid);
     CreateRelationship(ProfilingRelationshipType::RetentionLink, workloadGuid, workloadInferenceGuid);
-    RecordEvent(workloadInferenceGuid, LabelsAndEventClasses::ARMNN_PROFILING_SOL_EVENT_CLASS);
+    RecordEvent(workloadInferenceGuid, LabelsAndEventClasses::ARMNN_PROFILING_SOL_EVENT_CLASS, timestamp, threadId);
     return workloadInferenceGuid;
 }
 
@@ -410,6 +429,13 @@ void TimelineUtilityMethods::RecordEndOfLifeEvent(ProfilingGuid entityGuid)
     RecordEvent(entityGuid, LabelsAndEventClasses::ARMNN_PROFILING_EOL_EVENT_CLASS);
 }
 
+void TimelineUtilityMethods::RecordEndOfLifeEvent(ProfilingGuid entityGuid,
+                                                  uint64_t timestamp,
+                                                  std::thread::id threadId)
+{
+    RecordEvent(entityGuid, LabelsAndEventClasses::ARMNN_PROFILING_EOL_EVENT_CLASS, timestamp, threadId);
+}
+
 } // namespace profiling
 
 } // namespace armnn
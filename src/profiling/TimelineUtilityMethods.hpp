@@ -80,11 +80,24 @@ public:
 
     ProfilingDynamicGuid RecordEvent(ProfilingGuid entityGuid, ProfilingStaticGuid eventClassGuid);
 
+    /// Records an event which happened at the given time on the given thread
+    ProfilingDynamicGuid RecordEvent(ProfilingGuid entityGuid,
+                                     ProfilingStaticGuid eventClassGuid,
+                                     uint64_t timestamp,
+                                     std::thread::id threadId);
+
     ProfilingDynamicGuid RecordWorkloadInferenceAndStartOfLifeEvent(ProfilingGuid workloadGuid,
                                                                     ProfilingGuid inferenceGuid);
 
+    ProfilingDynamicGuid RecordWorkloadInferenceAndStartOfLifeEvent(ProfilingGuid workloadGuid,
+                                                                    ProfilingGuid inferenceGuid,
+                                                                    uint64_t timestamp,
+                                                                    std::thread::id threadId);
+
     void RecordEndOfLifeEvent(ProfilingGuid entityGuid);
 
+    void RecordEndOfLifeEvent(ProfilingGuid entityGuid, uint64_t timestamp, std::thread::id threadId);
+
     void Commit() { m_SendTimelinePacket->Commit(); }
 
 private:
@@ -6,11 +6,16 @@
 #include "BufferManager.hpp"
 #include "PacketBuffer.hpp"
 #include "ProfilingUtils.hpp"
+#include "RingBufferManager.hpp"
 
 #include <armnn/Exceptions.hpp>
 
 #include <boost/test/unit_test.hpp>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 using namespace armnn::profiling;
 
 BOOST_AUTO_TEST_SUITE(BufferTests)
@@ -293,4 +298,161 @@ BOOST_AUTO_TEST_CASE(BufferMarkReadTest)
     BOOST_TEST(packetBuffer3.get());
 }
 
+namespace
+{
+
+class CountingConsumer : public IConsumer
+{
+public:
+    void SetReadyToRead() override { ++m_ReadyToReadCount; }
+
+    std::atomic<unsigned int> m_ReadyToReadCount{ 0 };
+};
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(RingBufferReadOrderTest)
+{
+    RingBufferManager bufferManager(4, 512);
+
+    // Commit three packets holding their index
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        unsigned int reservedSize = 0;
+        auto packetBuffer = bufferManager.Reserve(4, reservedSize);
+        BOOST_TEST(reservedSize == 4);
+        BOOST_TEST(packetBuffer.get());
+
+        WriteUint32(packetBuffer, 0, i);
+        bufferManager.Commit(packetBuffer, 4);
+        BOOST_TEST(!packetBuffer.get());
+    }
+
+    // Packets are read in the order they were committed in
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        auto packetBuffer = bufferManager.GetReadableBuffer();
+        BOOST_TEST(packetBuffer.get());
+        BOOST_TEST(packetBuffer->GetSize() == 4);
+        BOOST_TEST(ReadUint32(packetBuffer->GetReadableData(), 0) == i);
+        bufferManager.MarkRead(packetBuffer);
+        BOOST_TEST(!packetBuffer.get());
+    }
+    BOOST_TEST(!bufferManager.GetReadableBuffer());
+    BOOST_TEST(bufferManager.GetDroppedPacketCount() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(RingBufferExhaustionTest)
+{
+    RingBufferManager bufferManager(2, 512, 0);
+    CountingConsumer consumer;
+    bufferManager.SetConsumer(&consumer);
+
+    unsigned int reservedSize0 = 0;
+    auto packetBuffer0 = bufferManager.Reserve(512, reservedSize0);
+    unsigned int reservedSize1 = 0;
+    auto packetBuffer1 = bufferManager.Reserve(128, reservedSize1);
+    BOOST_TEST(reservedSize0 == 512);
+    BOOST_TEST(reservedSize1 == 128);
+    BOOST_TEST(bufferManager.GetBackPressureCount() == 0);
+
+    // Cannot reserve when no buffer is available: the consumer is asked to read, then the packet is dropped
+    unsigned int reservedSize2 = 0;
+    auto reservedBuffer = bufferManager.Reserve(512, reservedSize2);
+    BOOST_TEST(reservedSize2 == 0);
+    BOOST_TEST(!reservedBuffer.get());
+    BOOST_TEST(consumer.m_ReadyToReadCount == 1);
+    BOOST_TEST(bufferManager.GetBackPressureCount() == 1);
+    BOOST_TEST(bufferManager.GetDroppedPacketCount() == 1);
+
+    // Packets too large for the buffers are dropped too
+    reservedBuffer = bufferManager.Reserve(1024, reservedSize2);
+    BOOST_TEST(!reservedBuffer.get());
+    BOOST_TEST(bufferManager.GetDroppedPacketCount() == 2);
+
+    // Released buffers can be reserved again
+    bufferManager.Release(packetBuffer1);
+    reservedBuffer = bufferManager.Reserve(512, reservedSize2);
+    BOOST_TEST(reservedSize2 == 512);
+    BOOST_TEST(reservedBuffer.get());
+
+    bufferManager.Release(packetBuffer0);
+    bufferManager.Release(reservedBuffer);
+    bufferManager.Reset();
+    BOOST_TEST(bufferManager.GetBackPressureCount() == 0);
+    BOOST_TEST(bufferManager.GetDroppedPacketCount() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(RingBufferMultipleProducersTest)
+{
+    const uint32_t numberOfProducers = 4;
+    const uint32_t packetsPerProducer = 2000;
+    RingBufferManager bufferManager(8, 8, 1000000);
+
+    std::atomic<bool> producersDone(false);
+    std::vector<uint32_t> nextSequence(numberOfProducers, 0);
+    unsigned int packetsRead = 0;
+    bool inOrder = true;
+
+    // A single consumer reads the packets while the producers commit them
+    std::thread consumer([&]()
+    {
+        while (true)
+        {
+            const bool done = producersDone.load();
+            auto packetBuffer = bufferManager.GetReadableBuffer();
+            if (!packetBuffer)
+            {
+                if (done)
+                {
+                    break;
+                }
+                std::this_thread::yield();
+                continue;
+            }
+
+            const uint32_t producer = ReadUint32(packetBuffer->GetReadableData(), 0);
+            const uint32_t sequence = ReadUint32(packetBuffer->GetReadableData(), 4);
+            inOrder = inOrder && producer < numberOfProducers && sequence == nextSequence[producer];
+            if (producer < numberOfProducers)
+            {
+                nextSequence[producer] = sequence + 1;
+            }
+            ++packetsRead;
+            bufferManager.MarkRead(packetBuffer);
+        }
+    });
+
+    std::vector<std::thread> producers;
+    for (uint32_t producer = 0; producer < numberOfProducers; ++producer)
+    {
+        producers.emplace_back([&bufferManager, producer]()
+        {
+            for (uint32_t sequence = 0; sequence < packetsPerProducer;)
+            {
+                unsigned int reservedSize = 0;
+                auto packetBuffer = bufferManager.Reserve(8, reservedSize);
+                if (!packetBuffer)
+                {
+                    continue;
+                }
+                WriteUint32(packetBuffer, 0, producer);
+                WriteUint32(packetBuffer, 4, sequence++);
+                bufferManager.Commit(packetBuffer, 8, false);
+            }
+        });
+    }
+    for (std::thread& producer : producers)
+    {
+        producer.join();
+    }
+    producersDone.store(true);
+    consumer.join();
+
+    // Every packet is read once, and the packets of each producer are read in the order they were committed in
+    BOOST_TEST(inOrder);
+    BOOST_TEST(packetsRead == numberOfProducers * packetsPerProducer);
+    BOOST_TEST(bufferManager.GetDroppedPacketCount() == 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
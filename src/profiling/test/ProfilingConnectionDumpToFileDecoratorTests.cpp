@@ -3,10 +3,13 @@
 // SPDX-License-Identifier: MIT
 //
 
+#include "../BufferedFileWriter.hpp"
+#include "../CaptureFile.hpp"
 #include "../ProfilingConnectionDumpToFileDecorator.hpp"
 #include <Runtime.hpp>
 
 #include <fstream>
+#include <random>
 #include <sstream>
 
 #include <boost/core/ignore_unused.hpp>
@@ -166,4 +169,90 @@ BOOST_AUTO_TEST_CASE(DumpOutgoingValidFile)
     BOOST_CHECK(diff == 0);
 }
 
+BOOST_AUTO_TEST_CASE(DumpOutgoingCompressedFile)
+{
+    boost::filesystem::path fileName =
+        boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+
+    armnn::Runtime::CreationOptions::ExternalProfilingOptions options;
+    options.m_IncomingCaptureFile = "";
+    options.m_OutgoingCaptureFile = fileName.string();
+    options.m_CompressOutgoingCaptureFile = true;
+
+    ProfilingConnectionDumpToFileDecorator decorator(std::make_unique<DummyProfilingConnection>(), options, false);
+
+    // Packets of counter values, whose headers and counter UIDs repeat
+    std::vector<unsigned char> expectedData;
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        const uint32_t packet[] = { 0x0c000000, 12, i, 0x00050000 + (i % 7) };
+        const unsigned char* packetData = reinterpret_cast<const unsigned char*>(packet);
+        BOOST_CHECK(decorator.WritePacket(packetData, sizeof(packet)));
+        expectedData.insert(expectedData.end(), packetData, packetData + sizeof(packet));
+    }
+
+    decorator.Close();
+
+    // The capture is read back as it was written, from a smaller file
+    CaptureFileReader reader(options.m_OutgoingCaptureFile);
+    BOOST_CHECK(reader.IsCompressed());
+    BOOST_CHECK(reader.ReadAll() == expectedData);
+    BOOST_CHECK(boost::filesystem::file_size(fileName) < expectedData.size() / 2);
+
+    boost::filesystem::remove(fileName);
+}
+
+BOOST_AUTO_TEST_CASE(BufferedCompressedFileWriter)
+{
+    boost::filesystem::path fileName =
+        boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+
+    // Random data does not compress, so its blocks are stored as they are, mixed with blocks of repeated data
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(0, 255);
+    std::vector<unsigned char> expectedData(10000);
+    for (size_t i = 0; i < expectedData.size(); ++i)
+    {
+        expectedData[i] = static_cast<unsigned char>(i < 5000 ? distribution(generator) : static_cast<int>(i % 3));
+    }
+
+    // Small buffers are all in use most of the time, so the writes wait for the writing thread
+    BufferedFileWriter writer(true, 64, 2);
+    BOOST_CHECK(writer.Open(fileName.string()));
+    size_t offset = 0;
+    for (size_t length = 1; offset < expectedData.size(); ++length)
+    {
+        length = std::min(length, expectedData.size() - offset);
+        BOOST_CHECK(writer.Write(expectedData.data() + offset, length));
+        offset += length;
+    }
+    BOOST_CHECK(writer.Flush());
+    writer.Close();
+    BOOST_CHECK(!writer.IsOpen());
+
+    CaptureFileReader reader(fileName.string());
+    BOOST_CHECK(reader.IsCompressed());
+    std::vector<unsigned char> data(expectedData.size() + 1);
+    size_t readLength = 0;
+    size_t chunkLength = 0;
+    while ((chunkLength = reader.Read(data.data() + readLength, std::min<size_t>(100, data.size() - readLength))) != 0)
+    {
+        readLength += chunkLength;
+    }
+    BOOST_CHECK(readLength == expectedData.size());
+    data.resize(readLength);
+    BOOST_CHECK(data == expectedData);
+
+    // A corrupt block is detected
+    std::vector<unsigned char> compressedBlock;
+    CompressCaptureBlock(expectedData.data() + 5000, 5000, compressedBlock);
+    BOOST_CHECK(compressedBlock.size() < 100);
+    std::vector<unsigned char> block(5000);
+    BOOST_CHECK_NO_THROW(DecompressCaptureBlock(compressedBlock.data(), compressedBlock.size(), block.data(), 5000));
+    BOOST_CHECK_THROW(DecompressCaptureBlock(compressedBlock.data(), compressedBlock.size() - 1, block.data(), 5000),
+                      armnn::RuntimeException);
+
+    boost::filesystem::remove(fileName);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -428,7 +428,7 @@ void VerifyPostOptimisationStructureTestImpl(armnn::BackendId backendId)
     BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
 
     profiling::ProfilingServiceRuntimeHelper profilingServiceHelper;
-    profiling::BufferManager& bufferManager = profilingServiceHelper.GetProfilingBufferManager();
+    profiling::RingBufferManager& bufferManager = profilingServiceHelper.GetProfilingBufferManager();
     auto readableBuffer = bufferManager.GetReadableBuffer();
 
     // Profiling is enable, the post-optimisation structure should be created
@@ -834,17 +834,18 @@ void VerifyPostOptimisationStructureTestImpl(armnn::BackendId backendId)
     // Does the inference.
     runtime->EnqueueWorkload(netId, inputTensors, outputTensors);
 
-    // Get readable buffer for inference timeline
-    auto inferenceReadableBuffer = bufferManager.GetReadableBuffer();
-    BOOST_CHECK(inferenceReadableBuffer != nullptr);
+    // The buffers are read in the order they were committed in
+    // Get readable buffer for input workload
+    auto inputReadableBuffer = bufferManager.GetReadableBuffer();
+    BOOST_CHECK(inputReadableBuffer != nullptr);
 
     // Get readable buffer for output workload
     auto outputReadableBuffer = bufferManager.GetReadableBuffer();
     BOOST_CHECK(outputReadableBuffer != nullptr);
 
-    // Get readable buffer for input workload
-    auto inputReadableBuffer = bufferManager.GetReadableBuffer();
-    BOOST_CHECK(inputReadableBuffer != nullptr);
+    // Get readable buffer for inference timeline
+    auto inferenceReadableBuffer = bufferManager.GetReadableBuffer();
+    BOOST_CHECK(inferenceReadableBuffer != nullptr);
 
     // Validate input workload data
     size = inputReadableBuffer->GetSize();
@@ -10,8 +10,8 @@
 #include <armnn/BackendId.hpp>
 #include <armnn/Optional.hpp>
 #include <armnn/Types.hpp>
-#include <BufferManager.hpp>
 #include <ProfilingService.hpp>
+#include <RingBufferManager.hpp>
 
 using namespace armnn;
 using namespace armnn::profiling;
@@ -58,7 +58,7 @@ public:
     ProfilingServiceRuntimeHelper() = default;
     ~ProfilingServiceRuntimeHelper() = default;
 
-    BufferManager& GetProfilingBufferManager()
+    RingBufferManager& GetProfilingBufferManager()
     {
         return GetBufferManager(ProfilingService::Instance());
     }
@@ -14,6 +14,7 @@
 #include <CounterIdMap.hpp>
 #include <EncodeVersion.hpp>
 #include <Holder.hpp>
+#include <InferenceSampler.hpp>
 #include <ICounterValues.hpp>
 #include <Packet.hpp>
 #include <PacketVersionResolver.hpp>
@@ -28,6 +29,7 @@
 #include <SendCounterPacket.hpp>
 #include <SendThread.hpp>
 #include <SendTimelinePacket.hpp>
+#include <ShardedCounterValues.hpp>
 
 #include <armnn/Conversion.hpp>
 #include <armnn/Types.hpp>
@@ -727,6 +729,100 @@ BOOST_AUTO_TEST_CASE(CheckProfilingServiceCounterValues)
     profilingService.ResetExternalProfilingOptions(options, true);
 }
 
+BOOST_AUTO_TEST_CASE(CheckInferenceSampler)
+{
+    InferenceSampler sampler;
+    BOOST_CHECK(sampler.SamplesEveryInference());
+    BOOST_CHECK(sampler.SampleNextInference());
+
+    BOOST_CHECK_THROW(sampler.SetOptions(armnn::InferenceSamplingOptions(0)), armnn::InvalidArgumentException);
+    BOOST_CHECK_THROW(sampler.SetOptions(armnn::InferenceSamplingOptions(1, 1.5f)), armnn::InvalidArgumentException);
+
+    // Every third inference, starting with the first one
+    sampler.SetOptions(armnn::InferenceSamplingOptions(3));
+    BOOST_CHECK(!sampler.SamplesEveryInference());
+    for (unsigned int i = 0; i < 9; ++i)
+    {
+        BOOST_CHECK(sampler.SampleNextInference() == (i % 3 == 0));
+    }
+
+    // A quarter of the inferences, picked the same way again when the options are set again
+    const unsigned int inferenceCount = 10000;
+    std::vector<bool> sampled;
+    for (unsigned int run = 0; run < 2; ++run)
+    {
+        sampler.SetOptions(armnn::InferenceSamplingOptions(1, 0.25f));
+        std::vector<bool> runSampled;
+        for (unsigned int i = 0; i < inferenceCount; ++i)
+        {
+            runSampled.push_back(sampler.SampleNextInference());
+        }
+        BOOST_CHECK(run == 0 || runSampled == sampled);
+        sampled = runSampled;
+    }
+    const auto sampledCount = std::count(sampled.begin(), sampled.end(), true);
+    BOOST_CHECK(sampledCount > 2300);
+    BOOST_CHECK(sampledCount < 2700);
+
+    // Both: half of every other inference
+    sampler.SetOptions(armnn::InferenceSamplingOptions(2, 0.5f));
+    unsigned int combinedCount = 0;
+    for (unsigned int i = 0; i < inferenceCount; ++i)
+    {
+        if (sampler.SampleNextInference())
+        {
+            BOOST_CHECK(i % 2 == 0);
+            ++combinedCount;
+        }
+    }
+    BOOST_CHECK(combinedCount > 2300);
+    BOOST_CHECK(combinedCount < 2700);
+}
+
+BOOST_AUTO_TEST_CASE(CheckShardedCounterValues)
+{
+    ShardedCounterValues counterValues(3);
+    BOOST_CHECK(counterValues.GetShardCount() == 4);
+    BOOST_CHECK(counterValues.GetCounterCount() == 0);
+
+    counterValues.Resize(2);
+    BOOST_CHECK(counterValues.GetCounterCount() == 2);
+    BOOST_CHECK(counterValues.GetValue(0) == 0);
+    BOOST_CHECK(counterValues.GetValue(1) == 0);
+
+    // The updates of many threads are spread over the shards, and summed when the counters are read
+    std::vector<std::thread> writers;
+    for (int i = 0; i < 8; ++i)
+    {
+        writers.push_back(std::thread([&counterValues]()
+        {
+            for (int j = 0; j < 1000; ++j)
+            {
+                counterValues.IncrementValue(0);
+                counterValues.AddValue(1, 3);
+                counterValues.SubtractValue(1, 1);
+            }
+        }));
+    }
+    std::for_each(writers.begin(), writers.end(), mem_fn(&std::thread::join));
+    BOOST_CHECK(counterValues.GetValue(0) == 8000);
+    BOOST_CHECK(counterValues.GetValue(1) == 16000);
+
+    // A counter decremented below zero in a shard wraps around like a single counter would
+    std::thread([&counterValues]() { counterValues.SubtractValue(1, 17000); }).join();
+    BOOST_CHECK(counterValues.GetValue(1) == std::numeric_limits<uint32_t>::max() - 999);
+
+    // Growing keeps the values of the existing counters, and setting a value overrides all the shards
+    counterValues.Resize(40);
+    BOOST_CHECK(counterValues.GetValue(0) == 8000);
+    BOOST_CHECK(counterValues.GetValue(39) == 0);
+    counterValues.SetValue(0, 5);
+    BOOST_CHECK(counterValues.GetValue(0) == 5);
+
+    counterValues.Clear();
+    BOOST_CHECK(counterValues.GetCounterCount() == 0);
+}
+
 BOOST_AUTO_TEST_CASE(CheckProfilingObjectUids)
 {
     uint16_t uid = 0;
@@ -2219,6 +2315,80 @@ BOOST_AUTO_TEST_CASE(CheckPeriodicCounterCaptureThread)
     BOOST_TEST((valueB * numSteps) == readValue);
 }
 
+BOOST_AUTO_TEST_CASE(CheckPeriodicCounterCaptureSchedule)
+{
+    class CountingReader : public IReadCounterValues
+    {
+    public:
+        CountingReader() : m_ReadCount(0) {}
+
+        bool IsCounterRegistered(uint16_t counterUid) const override
+        {
+            boost::ignore_unused(counterUid);
+            return true;
+        }
+
+        uint16_t GetCounterCount() const override
+        {
+            return 1;
+        }
+
+        uint32_t GetCounterValue(uint16_t counterUid) const override
+        {
+            boost::ignore_unused(counterUid);
+            return ++m_ReadCount;
+        }
+
+        uint32_t GetReadCount() const
+        {
+            return m_ReadCount.load();
+        }
+
+    private:
+        mutable std::atomic<uint32_t> m_ReadCount;
+    };
+
+    const std::unordered_map<armnn::BackendId,
+            std::shared_ptr<armnn::profiling::IBackendProfilingContext>> backendProfilingContext;
+    CounterIdMap counterIdMap;
+    Holder data;
+    MockBufferManager mockBuffer(1024);
+    MockSendCounterPacket sendCounterPacket(mockBuffer);
+    CountingReader countingReader;
+
+    PeriodicCounterCapture periodicCounterCapture(std::ref(data), std::ref(sendCounterPacket), countingReader,
+                                                  counterIdMap, backendProfilingContext);
+
+    // Without a capture period the capture thread sleeps until the capture data is set
+    periodicCounterCapture.Start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    BOOST_TEST(countingReader.GetReadCount() == 0);
+
+    const uint32_t capturePeriod = 5000;
+    auto start = std::chrono::steady_clock::now();
+    data.SetCaptureData(capturePeriod, { 0 }, {});
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    periodicCounterCapture.Stop();
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    // The captures are made on deadlines a capture period apart, from the first one: the deadlines which were
+    // missed are counted, so that the captures and the missed ones account for the whole duration
+    const CaptureTimingStats stats = periodicCounterCapture.GetCaptureTimingStats();
+    const uint64_t deadlines = static_cast<uint64_t>(elapsed.count()) / capturePeriod + 1;
+    BOOST_TEST(stats.m_CaptureCount == countingReader.GetReadCount());
+    BOOST_TEST(stats.m_CaptureCount + stats.m_MissedCaptureCount <= deadlines);
+    BOOST_TEST(stats.m_CaptureCount + stats.m_MissedCaptureCount + 2 >= deadlines);
+    BOOST_TEST(stats.m_MaxLateness.count() <= stats.m_TotalLateness.count());
+
+    // Stopping an idle capture thread wakes it up rather than waiting for it to poll
+    data.SetCaptureData(0, {}, {});
+    periodicCounterCapture.Start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    periodicCounterCapture.Stop();
+    BOOST_TEST(!periodicCounterCapture.IsRunning());
+    BOOST_TEST(periodicCounterCapture.GetCaptureTimingStats().m_CaptureCount == 0);
+}
+
 BOOST_AUTO_TEST_CASE(RequestCounterDirectoryCommandHandlerTest1)
 {
     using boost::numeric_cast;
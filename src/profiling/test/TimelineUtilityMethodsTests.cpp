@@ -6,6 +6,7 @@
 #include "ProfilingMocks.hpp"
 #include "ProfilingTestUtils.hpp"
 
+#include <InferenceTimelineRecorder.hpp>
 #include <SendTimelinePacket.hpp>
 #include <TimelineUtilityMethods.hpp>
 #include <LabelsAndEventClasses.hpp>
@@ -441,4 +442,118 @@ BOOST_AUTO_TEST_CASE(RecordEventTest)
     mockBufferManager.MarkRead(readableBuffer);
 }
 
+BOOST_AUTO_TEST_CASE(InferenceTimelineRecorderTest)
+{
+    MockBufferManager mockBufferManager(4096);
+    std::unique_ptr<ISendTimelinePacket> sendTimelinePacket = std::make_unique<SendTimelinePacket>(mockBufferManager);
+    TimelineUtilityMethods timelineUtilityMethods(sendTimelinePacket);
+    // Generate first guid to ensure that the named typed entity guid is not 0 on local single test.
+    ProfilingService::Instance().NextGuid();
+
+    ProfilingGuid networkGuid(123);
+    ProfilingGuid inferenceGuid(456);
+    ProfilingGuid workloadGuid0(789);
+    ProfilingGuid workloadGuid1(1011);
+
+    // Record an inference whose second workload does not end, as if it threw
+    InferenceTimelineRecorder& recorder = InferenceTimelineRecorder::GetThreadRecorder();
+    recorder.BeginInference(2);
+    recorder.BeginWorkload(workloadGuid0);
+    recorder.EndWorkload();
+    recorder.BeginWorkload(workloadGuid1);
+    recorder.EndInference();
+
+    BOOST_CHECK_NO_THROW(recorder.SendInference(timelineUtilityMethods, networkGuid, inferenceGuid));
+
+    // Commit all packets at once
+    timelineUtilityMethods.Commit();
+
+    // Get the readable buffer
+    auto readableBuffer = mockBufferManager.GetReadableBuffer();
+    BOOST_CHECK(readableBuffer != nullptr);
+    const unsigned char* readableData = readableBuffer->GetReadableData();
+    BOOST_CHECK(readableData != nullptr);
+
+    // Utils
+    unsigned int offset = 0;
+    const std::thread::id threadId = std::this_thread::get_id();
+
+    auto VerifyEvent = [&](Optional<ProfilingGuid> entityGuid, ProfilingStaticGuid eventClassGuid)
+    {
+        // The events are timestamped on the thread which recorded them
+        VerifyTimelineEventBinaryPacket(EmptyOptional(), threadId, EmptyOptional(), readableData, offset);
+        VerifyTimelineRelationshipBinaryPacket(ProfilingRelationshipType::ExecutionLink,
+                                               EmptyOptional(),
+                                               entityGuid,
+                                               EmptyOptional(),
+                                               readableData,
+                                               offset);
+        VerifyTimelineRelationshipBinaryPacket(ProfilingRelationshipType::DataLink,
+                                               EmptyOptional(),
+                                               EmptyOptional(),
+                                               eventClassGuid,
+                                               readableData,
+                                               offset);
+    };
+
+    auto VerifyTypedEntity = [&](Optional<ProfilingGuid> entityGuid, ProfilingStaticGuid typeGuid)
+    {
+        VerifyTimelineEntityBinaryPacket(entityGuid, readableData, offset);
+        VerifyTimelineRelationshipBinaryPacket(ProfilingRelationshipType::LabelLink,
+                                               EmptyOptional(),
+                                               EmptyOptional(),
+                                               typeGuid,
+                                               readableData,
+                                               offset);
+        VerifyTimelineRelationshipBinaryPacket(ProfilingRelationshipType::LabelLink,
+                                               EmptyOptional(),
+                                               EmptyOptional(),
+                                               LabelsAndEventClasses::TYPE_GUID,
+                                               readableData,
+                                               offset);
+    };
+
+    auto VerifyWorkloadExecution = [&](ProfilingGuid workloadGuid)
+    {
+        VerifyTypedEntity(EmptyOptional(), LabelsAndEventClasses::WORKLOAD_EXECUTION_GUID);
+        VerifyTimelineRelationshipBinaryPacket(ProfilingRelationshipType::RetentionLink,
+                                               EmptyOptional(),
+                                               inferenceGuid,
+                                               EmptyOptional(),
+                                               readableData,
+                                               offset);
+        VerifyTimelineRelationshipBinaryPacket(ProfilingRelationshipType::RetentionLink,
+                                               EmptyOptional(),
+                                               workloadGuid,
+                                               EmptyOptional(),
+                                               readableData,
+                                               offset);
+        VerifyEvent(EmptyOptional(), LabelsAndEventClasses::ARMNN_PROFILING_SOL_EVENT_CLASS);
+    };
+
+    // Inference entity and start of life
+    VerifyTypedEntity(inferenceGuid, LabelsAndEventClasses::INFERENCE_GUID);
+    VerifyTimelineRelationshipBinaryPacket(ProfilingRelationshipType::RetentionLink,
+                                           EmptyOptional(),
+                                           networkGuid,
+                                           inferenceGuid,
+                                           readableData,
+                                           offset);
+    VerifyEvent(inferenceGuid, LabelsAndEventClasses::ARMNN_PROFILING_SOL_EVENT_CLASS);
+
+    // First workload execution, which ended
+    VerifyWorkloadExecution(workloadGuid0);
+    VerifyEvent(EmptyOptional(), LabelsAndEventClasses::ARMNN_PROFILING_EOL_EVENT_CLASS);
+
+    // Second workload execution, which has no end of life
+    VerifyWorkloadExecution(workloadGuid1);
+
+    // Inference end of life
+    VerifyEvent(inferenceGuid, LabelsAndEventClasses::ARMNN_PROFILING_EOL_EVENT_CLASS);
+    BOOST_CHECK(offset == readableBuffer->GetSize());
+
+    // Mark the buffer as read
+    mockBufferManager.MarkRead(readableBuffer);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
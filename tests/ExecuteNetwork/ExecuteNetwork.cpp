@@ -33,6 +33,7 @@ int main(int argc, const char* argv[])
     std::string outgoingCaptureFile;
     std::string incomingCaptureFile;
     uint32_t counterCapturePeriod;
+    uint32_t timelineSamplingInterval;
 
     double thresholdTime = 0.0;
 
@@ -106,10 +107,14 @@ int main(int argc, const char* argv[])
              "If specified the outgoing external profiling packets will be captured in this binary file")
             ("incoming-capture-file,k", po::value(&incomingCaptureFile),
              "If specified the incoming external profiling packets will be captured in this binary file")
+            ("compress-outgoing-capture-file", po::bool_switch()->default_value(false),
+             "If enabled then the outgoing capture file will be compressed")
             ("file-only-external-profiling,g", po::bool_switch()->default_value(false),
              "If enabled then the 'file-only' test mode of external profiling will be enabled")
             ("counter-capture-period,u", po::value<uint32_t>(&counterCapturePeriod)->default_value(150u),
              "If profiling is enabled in 'file-only' mode this is the capture period that will be used in the test")
+            ("timeline-sampling-interval", po::value<uint32_t>(&timelineSamplingInterval)->default_value(1u),
+             "If external profiling is enabled, only every n-th inference is recorded in the timeline")
             ("parse-unsupported", po::bool_switch()->default_value(false),
                 "Add unsupported operators as stand-in layers (where supported by parser)");
     }
@@ -156,6 +161,7 @@ int main(int argc, const char* argv[])
     bool printIntermediate = vm["print-intermediate-layers"].as<bool>();
     bool enableExternalProfiling = vm["enable-external-profiling"].as<bool>();
     bool fileOnlyExternalProfiling = vm["file-only-external-profiling"].as<bool>();
+    bool compressOutgoingCaptureFile = vm["compress-outgoing-capture-file"].as<bool>();
     bool parseUnsupported = vm["parse-unsupported"].as<bool>();
 
 
@@ -189,6 +195,8 @@ int main(int argc, const char* argv[])
         options.m_ProfilingOptions.m_OutgoingCaptureFile = outgoingCaptureFile;
         options.m_ProfilingOptions.m_FileOnly = fileOnlyExternalProfiling;
         options.m_ProfilingOptions.m_CapturePeriod = counterCapturePeriod;
+        options.m_ProfilingOptions.m_CompressOutgoingCaptureFile = compressOutgoingCaptureFile;
+        options.m_ProfilingOptions.m_TimelineSampling = armnn::InferenceSamplingOptions(timelineSamplingInterval);
         std::shared_ptr<armnn::IRuntime> runtime(armnn::IRuntime::Create(options));
 
         const std::string executableName("ExecuteNetwork");
@@ -266,6 +274,8 @@ int main(int argc, const char* argv[])
         options.m_ProfilingOptions.m_OutgoingCaptureFile = outgoingCaptureFile;
         options.m_ProfilingOptions.m_FileOnly            = fileOnlyExternalProfiling;
         options.m_ProfilingOptions.m_CapturePeriod       = counterCapturePeriod;
+        options.m_ProfilingOptions.m_CompressOutgoingCaptureFile = compressOutgoingCaptureFile;
+        options.m_ProfilingOptions.m_TimelineSampling = armnn::InferenceSamplingOptions(timelineSamplingInterval);
         std::shared_ptr<armnn::IRuntime> runtime(armnn::IRuntime::Create(options));
 
         return RunTest(modelFormat, inputTensorShapes, computeDevices, dynamicBackendsPath, modelPath, inputNames,
@@ -195,9 +195,7 @@ public:
                                                    errorCode %
                                                    CHECK_LOCATION().AsString()));
             }
-            std::ifstream file(params.m_ModelPath, std::ios::binary);
-
-            network = parser->CreateNetworkFromBinary(file);
+            network = parser->CreateNetworkFromBinaryFile(params.m_ModelPath.c_str());
         }
 
         unsigned int subgraphId = boost::numeric_cast<unsigned int>(params.m_SubgraphId);
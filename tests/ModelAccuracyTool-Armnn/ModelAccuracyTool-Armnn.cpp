@@ -146,14 +146,13 @@ int main(int argc, char* argv[])
         // Create runtime
         armnn::IRuntime::CreationOptions options;
         armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
-        std::ifstream file(modelPath);
 
         // Create Parser
         using IParser = armnnDeserializer::IDeserializer;
         auto armnnparser(IParser::Create());
 
         // Create a network
-        armnn::INetworkPtr network = armnnparser->CreateNetworkFromBinary(file);
+        armnn::INetworkPtr network = armnnparser->CreateNetworkFromBinaryFile(modelPath.c_str());
 
         // Optimizes the network.
         armnn::IOptimizedNetworkPtr optimizedNet(nullptr, nullptr);
@@ -0,0 +1,187 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <BufferManager.hpp>
+#include <ProfilingUtils.hpp>
+#include <RingBufferManager.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace armnn::profiling;
+
+namespace
+{
+
+struct BenchmarkOptions
+{
+    unsigned int m_NumberOfProducers;
+    unsigned int m_PacketsPerProducer;
+    unsigned int m_NumberOfBuffers;
+    unsigned int m_PacketSize;
+};
+
+struct BenchmarkResult
+{
+    double   m_Seconds;
+    uint64_t m_PacketsRead;
+    uint64_t m_PacketsDropped;
+};
+
+/// Has every producer thread try to send its packets once through the buffer manager, while a single thread reads
+/// them, as the send thread of the profiling service does. A packet which can not be reserved is dropped.
+BenchmarkResult RunBenchmark(IBufferManager& bufferManager, const BenchmarkOptions& options)
+{
+    std::atomic<bool> producersDone(false);
+    std::atomic<uint64_t> packetsDropped(0);
+    uint64_t packetsRead = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    std::thread consumer([&]()
+    {
+        while (true)
+        {
+            const bool done = producersDone.load();
+            IPacketBufferPtr packetBuffer = bufferManager.GetReadableBuffer();
+            if (!packetBuffer)
+            {
+                if (done)
+                {
+                    break;
+                }
+                std::this_thread::yield();
+                continue;
+            }
+            ++packetsRead;
+            bufferManager.MarkRead(packetBuffer);
+        }
+    });
+
+    std::vector<std::thread> producers;
+    for (unsigned int producer = 0; producer < options.m_NumberOfProducers; ++producer)
+    {
+        producers.emplace_back([&, producer]()
+        {
+            for (unsigned int packet = 0; packet < options.m_PacketsPerProducer; ++packet)
+            {
+                unsigned int reservedSize = 0;
+                IPacketBufferPtr packetBuffer = bufferManager.Reserve(options.m_PacketSize, reservedSize);
+                if (!packetBuffer || reservedSize < options.m_PacketSize)
+                {
+                    packetsDropped.fetch_add(1, std::memory_order_relaxed);
+                    if (packetBuffer)
+                    {
+                        bufferManager.Release(packetBuffer);
+                    }
+                    continue;
+                }
+                WriteUint32(packetBuffer, 0, producer);
+                WriteUint32(packetBuffer, 4, packet);
+                bufferManager.Commit(packetBuffer, options.m_PacketSize, false);
+            }
+        });
+    }
+
+    for (std::thread& producer : producers)
+    {
+        producer.join();
+    }
+    producersDone.store(true);
+    consumer.join();
+
+    const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+    return { duration.count(), packetsRead, packetsDropped.load() };
+}
+
+void PrintResult(const std::string& name, const BenchmarkResult& result)
+{
+    const double packetsPerSecond = result.m_Seconds > 0.0 ? static_cast<double>(result.m_PacketsRead) /
+                                                              result.m_Seconds : 0.0;
+    std::cout << std::left << std::setw(20) << name
+              << std::right << std::setw(12) << std::fixed << std::setprecision(3) << result.m_Seconds * 1000.0
+              << " ms" << std::setw(14) << static_cast<uint64_t>(packetsPerSecond) << " packets/s"
+              << std::setw(12) << result.m_PacketsRead << " read"
+              << std::setw(12) << result.m_PacketsDropped << " dropped" << std::endl;
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    namespace po = boost::program_options;
+
+    BenchmarkOptions options;
+    unsigned int maxReserveRetries = 0;
+    unsigned int iterations = 0;
+
+    po::options_description desc("Options");
+    desc.add_options()
+        ("help,h", "Display help messages")
+        ("producers,p", po::value<unsigned int>(&options.m_NumberOfProducers)->default_value(8),
+         "Number of threads sending packets")
+        ("packets,n", po::value<unsigned int>(&options.m_PacketsPerProducer)->default_value(100000),
+         "Number of packets each thread sends")
+        ("buffers,b", po::value<unsigned int>(&options.m_NumberOfBuffers)->default_value(64),
+         "Number of packet buffers of the buffer managers")
+        ("size,s", po::value<unsigned int>(&options.m_PacketSize)->default_value(64),
+         "Size of the packets in bytes, at least 8")
+        ("retries,r", po::value<unsigned int>(&maxReserveRetries)->default_value(64),
+         "Number of times the ring buffer manager retries a reservation when no buffer is available")
+        ("iterations,i", po::value<unsigned int>(&iterations)->default_value(3),
+         "Number of times each buffer manager is measured");
+
+    po::variables_map vm;
+    try
+    {
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        if (vm.count("help"))
+        {
+            std::cout << "Measures the throughput of the profiling buffer managers with many threads sending packets "
+                         "to a single reading thread." << std::endl;
+            std::cout << desc << std::endl;
+            return EXIT_SUCCESS;
+        }
+        po::notify(vm);
+    }
+    catch (const po::error& e)
+    {
+        std::cerr << e.what() << std::endl << std::endl;
+        std::cerr << desc << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (options.m_PacketSize < 8)
+    {
+        std::cerr << "The packets must be at least 8 bytes" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << options.m_NumberOfProducers << " producers sending " << options.m_PacketsPerProducer
+              << " packets of " << options.m_PacketSize << " bytes each through " << options.m_NumberOfBuffers
+              << " buffers" << std::endl;
+
+    for (unsigned int i = 0; i < iterations; ++i)
+    {
+        BufferManager bufferManager(options.m_NumberOfBuffers, options.m_PacketSize);
+        PrintResult("BufferManager", RunBenchmark(bufferManager, options));
+
+        RingBufferManager ringBufferManager(options.m_NumberOfBuffers, options.m_PacketSize, maxReserveRetries);
+        const BenchmarkResult result = RunBenchmark(ringBufferManager, options);
+        PrintResult("RingBufferManager", result);
+        std::cout << std::setw(20) << "" << std::setw(12) << ringBufferManager.GetBackPressureCount()
+                  << " back pressure waits" << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
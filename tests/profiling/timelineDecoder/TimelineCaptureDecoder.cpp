@@ -0,0 +1,185 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "TimelineCaptureDecoder.hpp"
+
+#include <CaptureFile.hpp>
+#include <ProfilingUtils.hpp>
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/format.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace armnn
+{
+
+namespace gatordmock
+{
+
+namespace
+{
+
+constexpr uint32_t g_TimelinePacketFamily    = 1;
+constexpr uint32_t g_TimelineMessagePacketId = 1;
+
+constexpr uint32_t g_PacketHeaderSize = 2 * sizeof(uint32_t);
+constexpr uint32_t g_DeclIdSize       = sizeof(uint32_t);
+constexpr uint32_t g_GuidSize         = sizeof(uint64_t);
+
+void CheckRecordLength(uint32_t length, uint32_t minimumLength, const char* recordName)
+{
+    if (length < minimumLength)
+    {
+        throw RuntimeException(boost::str(boost::format("Truncated timeline %1% record: %2% bytes instead of %3%")
+                                          % recordName
+                                          % length
+                                          % minimumLength));
+    }
+}
+
+} // anonymous namespace
+
+void TimelineCaptureDecoder::DecodePacket(uint32_t headerWord0, const unsigned char* data, uint32_t length)
+{
+    ++m_PacketCount;
+
+    const uint32_t packetFamily = headerWord0 >> 26;
+    const uint32_t packetId     = (headerWord0 >> 16) & 1023;
+    if (packetFamily != g_TimelinePacketFamily || packetId != g_TimelineMessagePacketId)
+    {
+        return;
+    }
+
+    DecodeRecord(data, length);
+}
+
+void TimelineCaptureDecoder::DecodeRecord(const unsigned char* data, uint32_t length)
+{
+    CheckRecordLength(length, g_DeclIdSize, "message");
+    const uint32_t declId = profiling::ReadUint32(data, 0);
+    uint32_t offset = g_DeclIdSize;
+
+    // The records are laid out as the Write...BinaryPacket functions of the ProfilingUtils write them
+    switch (declId)
+    {
+        case 0: // Label
+        {
+            CheckRecordLength(length, offset + g_GuidSize + sizeof(uint32_t), "label");
+            const uint64_t guid = profiling::ReadUint64(data, offset);
+            offset += g_GuidSize;
+            uint32_t nameLength = profiling::ReadUint32(data, offset);
+            offset += sizeof(uint32_t);
+            CheckRecordLength(length, offset + nameLength, "label");
+
+            // The length of the name includes its null terminator
+            const char* name = reinterpret_cast<const char*>(data + offset);
+            while (nameLength > 0 && name[nameLength - 1] == '\0')
+            {
+                --nameLength;
+            }
+            m_Index.AddLabel(guid, name, nameLength);
+            break;
+        }
+        case 1: // Entity
+            CheckRecordLength(length, offset + g_GuidSize, "entity");
+            m_Index.AddEntity(profiling::ReadUint64(data, offset));
+            break;
+        case 2: // Event class
+            CheckRecordLength(length, offset + g_GuidSize, "event class");
+            m_Index.AddEventClass(profiling::ReadUint64(data, offset));
+            break;
+        case 3: // Relationship
+        {
+            CheckRecordLength(length, offset + sizeof(uint32_t) + 3 * g_GuidSize, "relationship");
+            const RelationshipType relationshipType =
+                static_cast<RelationshipType>(profiling::ReadUint32(data, offset));
+            offset += sizeof(uint32_t);
+            const uint64_t guid = profiling::ReadUint64(data, offset);
+            offset += g_GuidSize;
+            const uint64_t headGuid = profiling::ReadUint64(data, offset);
+            offset += g_GuidSize;
+            const uint64_t tailGuid = profiling::ReadUint64(data, offset);
+            m_Index.AddRelationship(relationshipType, guid, headGuid, tailGuid);
+            break;
+        }
+        case 4: // Event
+        {
+            // The thread id takes what is left of the record, so captures made on other platforms decode too
+            CheckRecordLength(length, offset + 2 * g_GuidSize, "event");
+            const uint32_t threadIdSize = length - offset - 2 * g_GuidSize;
+            const uint64_t timestamp = profiling::ReadUint64(data, offset);
+            offset += g_GuidSize;
+            const unsigned char* threadId = data + offset;
+            offset += threadIdSize;
+            const uint64_t guid = profiling::ReadUint64(data, offset);
+            m_Index.AddEvent(guid, timestamp, threadId, threadIdSize);
+            break;
+        }
+        default:
+            // Skips the records of declarations added after this decoder was written
+            return;
+    }
+
+    ++m_RecordCount;
+}
+
+void TimelineCaptureDecoder::DecodeCaptureFile(const std::string& fileName, size_t chunkSize)
+{
+    profiling::CaptureFileReader reader(fileName);
+
+    // The packets are decoded where they are read, and only the start of a packet spanning two chunks is kept
+    std::vector<unsigned char> buffer(std::max<size_t>(chunkSize, g_PacketHeaderSize));
+    size_t bufferLength = 0;
+    while (true)
+    {
+        if (bufferLength == buffer.size())
+        {
+            // A packet larger than a chunk
+            buffer.resize(buffer.size() * 2);
+        }
+
+        const size_t readLength = reader.Read(buffer.data() + bufferLength, buffer.size() - bufferLength);
+        if (readLength == 0)
+        {
+            break;
+        }
+        bufferLength += readLength;
+
+        size_t offset = 0;
+        while (bufferLength - offset >= g_PacketHeaderSize)
+        {
+            const unsigned int headerOffset = static_cast<unsigned int>(offset);
+            const uint32_t headerWord0 = profiling::ReadUint32(buffer.data(), headerOffset);
+            const uint32_t headerWord1 = profiling::ReadUint32(buffer.data(), headerOffset + sizeof(uint32_t));
+            const uint32_t dataLength  = headerWord1 & 0xffffff;
+            if (bufferLength - offset - g_PacketHeaderSize < dataLength)
+            {
+                break;
+            }
+
+            DecodePacket(headerWord0, buffer.data() + offset + g_PacketHeaderSize, dataLength);
+            offset += g_PacketHeaderSize + dataLength;
+        }
+
+        std::memmove(buffer.data(), buffer.data() + offset, bufferLength - offset);
+        bufferLength -= offset;
+    }
+
+    if (bufferLength != 0)
+    {
+        throw RuntimeException(boost::str(boost::format("Truncated packet at the end of the capture file \"%1%\"")
+                                          % fileName));
+    }
+
+    m_Index.Finalize();
+}
+
+} // namespace gatordmock
+
+} // namespace armnn
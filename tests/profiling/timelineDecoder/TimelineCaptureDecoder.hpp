@@ -0,0 +1,52 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "TimelineIndex.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace armnn
+{
+
+namespace gatordmock
+{
+
+/// Decodes the timeline records of a capture straight into a TimelineIndex, as the packets are read: unlike the
+/// TimelineCaptureCommandHandler, it neither copies the packets nor allocates memory for each record.
+class TimelineCaptureDecoder
+{
+public:
+    TimelineCaptureDecoder(TimelineIndex& index)
+        : m_Index(index)
+        , m_PacketCount(0)
+        , m_RecordCount(0)
+    {}
+
+    /// Decodes a packet given its first header word and its data, skipping the packets other than timeline messages.
+    /// Throws a RuntimeException if a timeline record is truncated.
+    void DecodePacket(uint32_t headerWord0, const unsigned char* data, uint32_t length);
+
+    /// Decodes all the packets of a capture file, compressed or not, reading it in chunks of the given size, and then
+    /// finalizes the index. Throws a RuntimeException if the file can not be read or its last packet is truncated.
+    void DecodeCaptureFile(const std::string& fileName, size_t chunkSize = 1u << 20);
+
+    size_t GetPacketCount() const { return m_PacketCount; }
+    size_t GetRecordCount() const { return m_RecordCount; }
+
+private:
+    void DecodeRecord(const unsigned char* data, uint32_t length);
+
+    TimelineIndex& m_Index;
+    size_t m_PacketCount;
+    size_t m_RecordCount;
+};
+
+} // namespace gatordmock
+
+} // namespace armnn
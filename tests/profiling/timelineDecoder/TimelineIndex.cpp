@@ -0,0 +1,202 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "TimelineIndex.hpp"
+
+#include <boost/numeric/conversion/cast.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+namespace armnn
+{
+
+namespace gatordmock
+{
+
+namespace
+{
+
+void SortAndRemoveDuplicates(std::vector<uint64_t>& guids)
+{
+    std::sort(guids.begin(), guids.end());
+    guids.erase(std::unique(guids.begin(), guids.end()), guids.end());
+}
+
+// Sorts the rows by the GUID they have in the given column, keeping the order in which they were added for equal GUIDs
+void SortRows(std::vector<uint32_t>& rows, const std::vector<uint64_t>& keys)
+{
+    rows.resize(keys.size());
+    std::iota(rows.begin(), rows.end(), 0u);
+    std::stable_sort(rows.begin(), rows.end(), [&keys](uint32_t lhs, uint32_t rhs) { return keys[lhs] < keys[rhs]; });
+}
+
+// Compares the rows by the GUID they have in the given column, and to GUIDs
+struct RowKeyCompare
+{
+    bool operator()(uint32_t row, uint64_t guid) const { return m_Keys[row] < guid; }
+    bool operator()(uint64_t guid, uint32_t row) const { return guid < m_Keys[row]; }
+
+    const std::vector<uint64_t>& m_Keys;
+};
+
+bool ContainsSorted(const std::vector<uint64_t>& guids, uint64_t guid)
+{
+    return std::binary_search(guids.begin(), guids.end(), guid);
+}
+
+} // anonymous namespace
+
+void TimelineIndex::AddEntity(uint64_t guid)
+{
+    m_EntityGuids.push_back(guid);
+}
+
+void TimelineIndex::AddEventClass(uint64_t guid)
+{
+    m_EventClassGuids.push_back(guid);
+}
+
+void TimelineIndex::AddEvent(uint64_t guid, uint64_t timestamp, const unsigned char* threadId, size_t threadIdSize)
+{
+    std::string threadIdBytes(reinterpret_cast<const char*>(threadId), threadIdSize);
+    auto threadIndex = m_ThreadIndexes.find(threadIdBytes);
+    if (threadIndex == m_ThreadIndexes.end())
+    {
+        threadIndex = m_ThreadIndexes.emplace(threadIdBytes, boost::numeric_cast<uint32_t>(m_ThreadIds.size())).first;
+        m_ThreadIds.push_back(threadIdBytes);
+    }
+
+    m_EventGuids.push_back(guid);
+    m_EventTimestamps.push_back(timestamp);
+    m_EventThreads.push_back(threadIndex->second);
+}
+
+void TimelineIndex::AddLabel(uint64_t guid, const char* name, size_t nameLength)
+{
+    m_LabelGuids.push_back(guid);
+    m_LabelNameOffsets.push_back(boost::numeric_cast<uint32_t>(m_LabelNames.size()));
+    m_LabelNameLengths.push_back(boost::numeric_cast<uint32_t>(nameLength));
+    m_LabelNames.append(name, nameLength);
+}
+
+void TimelineIndex::AddRelationship(RelationshipType relationshipType,
+                                    uint64_t guid,
+                                    uint64_t headGuid,
+                                    uint64_t tailGuid)
+{
+    m_RelationshipTypes.push_back(relationshipType);
+    m_RelationshipGuids.push_back(guid);
+    m_RelationshipHeads.push_back(headGuid);
+    m_RelationshipTails.push_back(tailGuid);
+}
+
+void TimelineIndex::Finalize()
+{
+    SortAndRemoveDuplicates(m_EntityGuids);
+    SortAndRemoveDuplicates(m_EventClassGuids);
+
+    SortRows(m_EventsByGuid, m_EventGuids);
+    SortRows(m_LabelsByGuid, m_LabelGuids);
+    SortRows(m_RelationshipsByHead, m_RelationshipHeads);
+    SortRows(m_RelationshipsByTail, m_RelationshipTails);
+}
+
+bool TimelineIndex::HasEntity(uint64_t guid) const
+{
+    return ContainsSorted(m_EntityGuids, guid);
+}
+
+bool TimelineIndex::HasEventClass(uint64_t guid) const
+{
+    return ContainsSorted(m_EventClassGuids, guid);
+}
+
+std::string TimelineIndex::GetLabelName(uint64_t labelGuid) const
+{
+    RowRange rows = FindRows(m_LabelsByGuid, m_LabelGuids, labelGuid);
+    if (rows.empty())
+    {
+        return std::string();
+    }
+
+    const uint32_t row = *rows.begin();
+    return m_LabelNames.substr(m_LabelNameOffsets[row], m_LabelNameLengths[row]);
+}
+
+uint64_t TimelineIndex::GetEventTimestamp(uint64_t eventGuid) const
+{
+    RowRange rows = FindRows(m_EventsByGuid, m_EventGuids, eventGuid);
+    return rows.empty() ? InvalidTimestamp : m_EventTimestamps[*rows.begin()];
+}
+
+TimelineIndex::RowRange TimelineIndex::GetRelationshipsWithHead(uint64_t headGuid) const
+{
+    return FindRows(m_RelationshipsByHead, m_RelationshipHeads, headGuid);
+}
+
+TimelineIndex::RowRange TimelineIndex::GetRelationshipsWithTail(uint64_t tailGuid) const
+{
+    return FindRows(m_RelationshipsByTail, m_RelationshipTails, tailGuid);
+}
+
+bool TimelineIndex::HasType(uint64_t entityGuid, uint64_t typeGuid) const
+{
+    for (uint32_t row : GetRelationshipsWithHead(entityGuid))
+    {
+        if (m_RelationshipTypes[row] == LabelLink && m_RelationshipTails[row] == typeGuid)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string TimelineIndex::GetLabelOfType(uint64_t entityGuid, uint64_t labelTypeGuid) const
+{
+    // The label links of an entity are themselves linked to the type of their label
+    for (uint32_t row : GetRelationshipsWithHead(entityGuid))
+    {
+        if (m_RelationshipTypes[row] == LabelLink && HasType(m_RelationshipGuids[row], labelTypeGuid))
+        {
+            return GetLabelName(m_RelationshipTails[row]);
+        }
+    }
+    return std::string();
+}
+
+uint64_t TimelineIndex::GetEntityEventTimestamp(uint64_t entityGuid, uint64_t eventClassGuid) const
+{
+    // An event is linked to the entity it is recorded for by an execution link, and to its class by a data link
+    for (uint32_t row : GetRelationshipsWithHead(entityGuid))
+    {
+        if (m_RelationshipTypes[row] != ExecutionLink)
+        {
+            continue;
+        }
+
+        const uint64_t eventGuid = m_RelationshipTails[row];
+        for (uint32_t eventRow : GetRelationshipsWithHead(eventGuid))
+        {
+            if (m_RelationshipTypes[eventRow] == DataLink && m_RelationshipTails[eventRow] == eventClassGuid)
+            {
+                return GetEventTimestamp(eventGuid);
+            }
+        }
+    }
+    return InvalidTimestamp;
+}
+
+TimelineIndex::RowRange TimelineIndex::FindRows(const std::vector<uint32_t>& rows,
+                                                const std::vector<uint64_t>& keys,
+                                                uint64_t guid)
+{
+    auto range = std::equal_range(rows.begin(), rows.end(), guid, RowKeyCompare{ keys });
+    return RowRange(rows.data() + (range.first - rows.begin()), rows.data() + (range.second - rows.begin()));
+}
+
+} // namespace gatordmock
+
+} // namespace armnn
@@ -0,0 +1,123 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "TimelineModel.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace armnn
+{
+
+namespace gatordmock
+{
+
+/// Holds the records of a timeline capture in compact columns, one vector per field, instead of one allocation per
+/// record like the Model does. Once all the records are added, Finalize() sorts indexes of the rows by GUID, so the
+/// entities, events, labels and relationships can be looked up with binary searches.
+class TimelineIndex
+{
+public:
+    /// The rows of a column matching a lookup
+    class RowRange
+    {
+    public:
+        RowRange(const uint32_t* begin, const uint32_t* end) : m_Begin(begin), m_End(end) {}
+
+        const uint32_t* begin() const { return m_Begin; }
+        const uint32_t* end() const   { return m_End; }
+        bool empty() const            { return m_Begin == m_End; }
+
+    private:
+        const uint32_t* m_Begin;
+        const uint32_t* m_End;
+    };
+
+    static constexpr uint64_t InvalidTimestamp = UINT64_MAX;
+
+    void AddEntity(uint64_t guid);
+    void AddEventClass(uint64_t guid);
+    void AddEvent(uint64_t guid, uint64_t timestamp, const unsigned char* threadId, size_t threadIdSize);
+    void AddLabel(uint64_t guid, const char* name, size_t nameLength);
+    void AddRelationship(RelationshipType relationshipType, uint64_t guid, uint64_t headGuid, uint64_t tailGuid);
+
+    /// Builds the indexes: required before any lookup, and again after adding more records
+    void Finalize();
+
+    size_t GetEntityCount() const       { return m_EntityGuids.size(); }
+    size_t GetEventClassCount() const   { return m_EventClassGuids.size(); }
+    size_t GetEventCount() const        { return m_EventGuids.size(); }
+    size_t GetLabelCount() const        { return m_LabelGuids.size(); }
+    size_t GetRelationshipCount() const { return m_RelationshipGuids.size(); }
+    size_t GetThreadCount() const       { return m_ThreadIds.size(); }
+
+    bool HasEntity(uint64_t guid) const;
+    bool HasEventClass(uint64_t guid) const;
+
+    /// Returns the name of a label, empty if there is no such label
+    std::string GetLabelName(uint64_t labelGuid) const;
+
+    /// Returns the timestamp of an event, or InvalidTimestamp if there is no such event
+    uint64_t GetEventTimestamp(uint64_t eventGuid) const;
+
+    RowRange GetRelationshipsWithHead(uint64_t headGuid) const;
+    RowRange GetRelationshipsWithTail(uint64_t tailGuid) const;
+
+    RelationshipType GetRelationshipType(uint32_t row) const { return m_RelationshipTypes[row]; }
+    uint64_t GetRelationshipGuid(uint32_t row) const         { return m_RelationshipGuids[row]; }
+    uint64_t GetRelationshipHead(uint32_t row) const         { return m_RelationshipHeads[row]; }
+    uint64_t GetRelationshipTail(uint32_t row) const         { return m_RelationshipTails[row]; }
+
+    /// Returns whether an entity is marked with the given type, like LabelsAndEventClasses::WORKLOAD_GUID
+    bool HasType(uint64_t entityGuid, uint64_t typeGuid) const;
+
+    /// Returns the name of the label of the given type an entity is marked with, like LabelsAndEventClasses::NAME_GUID,
+    /// empty if there is none
+    std::string GetLabelOfType(uint64_t entityGuid, uint64_t labelTypeGuid) const;
+
+    /// Returns the timestamp of the first event of the given class recorded for an entity, or InvalidTimestamp
+    uint64_t GetEntityEventTimestamp(uint64_t entityGuid, uint64_t eventClassGuid) const;
+
+private:
+    static RowRange FindRows(const std::vector<uint32_t>& rows, const std::vector<uint64_t>& keys, uint64_t guid);
+
+    // Entities and event classes, sorted by Finalize()
+    std::vector<uint64_t> m_EntityGuids;
+    std::vector<uint64_t> m_EventClassGuids;
+
+    // Events, with the thread ids stored once each
+    std::vector<uint64_t> m_EventGuids;
+    std::vector<uint64_t> m_EventTimestamps;
+    std::vector<uint32_t> m_EventThreads;
+    std::vector<std::string> m_ThreadIds;
+    std::unordered_map<std::string, uint32_t> m_ThreadIndexes;
+
+    // Labels, with their names one after the other in a single string
+    std::vector<uint64_t> m_LabelGuids;
+    std::vector<uint32_t> m_LabelNameOffsets;
+    std::vector<uint32_t> m_LabelNameLengths;
+    std::string m_LabelNames;
+
+    // Relationships
+    std::vector<RelationshipType> m_RelationshipTypes;
+    std::vector<uint64_t> m_RelationshipGuids;
+    std::vector<uint64_t> m_RelationshipHeads;
+    std::vector<uint64_t> m_RelationshipTails;
+
+    // The rows sorted by GUID, built by Finalize()
+    std::vector<uint32_t> m_EventsByGuid;
+    std::vector<uint32_t> m_LabelsByGuid;
+    std::vector<uint32_t> m_RelationshipsByHead;
+    std::vector<uint32_t> m_RelationshipsByTail;
+};
+
+} // namespace gatordmock
+
+} // namespace armnn
@@ -0,0 +1,133 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "TimelineQueries.hpp"
+
+#include <LabelsAndEventClasses.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+namespace armnn
+{
+
+namespace gatordmock
+{
+
+using profiling::LabelsAndEventClasses;
+
+namespace
+{
+
+// Calls the function with every entity of the given type, in the order they were typed
+template <typename Function>
+void ForEachEntityOfType(const TimelineIndex& index, uint64_t typeGuid, Function function)
+{
+    for (uint32_t row : index.GetRelationshipsWithTail(typeGuid))
+    {
+        if (index.GetRelationshipType(row) == LabelLink)
+        {
+            function(index.GetRelationshipHead(row));
+        }
+    }
+}
+
+// Returns the entity of the given type retaining an entity, 0 if there is none
+uint64_t GetRetainingEntityOfType(const TimelineIndex& index, uint64_t entityGuid, uint64_t typeGuid)
+{
+    for (uint32_t row : index.GetRelationshipsWithTail(entityGuid))
+    {
+        if (index.GetRelationshipType(row) == RetentionLink && index.HasType(index.GetRelationshipHead(row), typeGuid))
+        {
+            return index.GetRelationshipHead(row);
+        }
+    }
+    return 0;
+}
+
+bool GetLifetime(const TimelineIndex& index, uint64_t entityGuid, uint64_t& lifetime)
+{
+    const uint64_t start = index.GetEntityEventTimestamp(entityGuid,
+                                                         LabelsAndEventClasses::ARMNN_PROFILING_SOL_EVENT_CLASS);
+    const uint64_t end = index.GetEntityEventTimestamp(entityGuid,
+                                                       LabelsAndEventClasses::ARMNN_PROFILING_EOL_EVENT_CLASS);
+    if (start == TimelineIndex::InvalidTimestamp || end == TimelineIndex::InvalidTimestamp || end < start)
+    {
+        return false;
+    }
+
+    lifetime = end - start;
+    return true;
+}
+
+} // anonymous namespace
+
+std::vector<uint64_t> GetInferenceLatencies(const TimelineIndex& index)
+{
+    std::vector<uint64_t> latencies;
+    ForEachEntityOfType(index, LabelsAndEventClasses::INFERENCE_GUID, [&](uint64_t inferenceGuid)
+    {
+        uint64_t latency = 0;
+        if (GetLifetime(index, inferenceGuid, latency))
+        {
+            latencies.push_back(latency);
+        }
+    });
+    return latencies;
+}
+
+std::vector<WorkloadLatencies> GetWorkloadLatencies(const TimelineIndex& index)
+{
+    std::vector<WorkloadLatencies> workloads;
+    std::unordered_map<uint64_t, size_t> workloadIndexes;
+
+    ForEachEntityOfType(index, LabelsAndEventClasses::WORKLOAD_EXECUTION_GUID, [&](uint64_t workloadExecutionGuid)
+    {
+        uint64_t latency = 0;
+        if (!GetLifetime(index, workloadExecutionGuid, latency))
+        {
+            return;
+        }
+
+        const uint64_t workloadGuid =
+            GetRetainingEntityOfType(index, workloadExecutionGuid, LabelsAndEventClasses::WORKLOAD_GUID);
+        auto workloadIndex = workloadIndexes.find(workloadGuid);
+        if (workloadIndex == workloadIndexes.end())
+        {
+            // The name of a workload is the one of the layer it executes
+            const uint64_t layerGuid = GetRetainingEntityOfType(index, workloadGuid, LabelsAndEventClasses::LAYER_GUID);
+            workloads.push_back({ workloadGuid,
+                                  index.GetLabelOfType(layerGuid, LabelsAndEventClasses::NAME_GUID),
+                                  index.GetLabelOfType(workloadGuid, LabelsAndEventClasses::BACKENDID_GUID),
+                                  {} });
+            workloadIndex = workloadIndexes.emplace(workloadGuid, workloads.size() - 1).first;
+        }
+        workloads[workloadIndex->second].m_Latencies.push_back(latency);
+    });
+
+    return workloads;
+}
+
+uint64_t GetPercentile(const std::vector<uint64_t>& sortedLatencies, double percentile)
+{
+    BOOST_ASSERT(std::is_sorted(sortedLatencies.begin(), sortedLatencies.end()));
+
+    if (sortedLatencies.empty())
+    {
+        return 0;
+    }
+
+    const double clampedPercentile = std::min(std::max(percentile, 0.0), 100.0);
+    const size_t rank = static_cast<size_t>(std::ceil(clampedPercentile / 100.0 *
+                                                      static_cast<double>(sortedLatencies.size())));
+    return sortedLatencies[std::max<size_t>(rank, 1) - 1];
+}
+
+} // namespace gatordmock
+
+} // namespace armnn
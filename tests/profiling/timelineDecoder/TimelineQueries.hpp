@@ -0,0 +1,42 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "TimelineIndex.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace armnn
+{
+
+namespace gatordmock
+{
+
+/// The latencies of a workload in each of the inferences it was executed in, in ticks of the timeline timestamps
+struct WorkloadLatencies
+{
+    uint64_t m_WorkloadGuid;
+    std::string m_LayerName;
+    std::string m_BackendId;
+    std::vector<uint64_t> m_Latencies;
+};
+
+/// Returns the latencies of the inferences of a capture, in the order they were recorded, in ticks of the timeline
+/// timestamps. The inferences without both a start and an end of life event are left out.
+std::vector<uint64_t> GetInferenceLatencies(const TimelineIndex& index);
+
+/// Returns the latencies of the workloads of a capture across its inferences, in the order the workloads were first
+/// executed. The executions without both a start and an end of life event are left out.
+std::vector<WorkloadLatencies> GetWorkloadLatencies(const TimelineIndex& index);
+
+/// Returns the given percentile, from 0 to 100, of sorted latencies, by nearest rank: 0 if there are no latencies.
+uint64_t GetPercentile(const std::vector<uint64_t>& sortedLatencies, double percentile);
+
+} // namespace gatordmock
+
+} // namespace armnn
@@ -0,0 +1,206 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "TimelineCaptureDecoder.hpp"
+#include "TimelineIndex.hpp"
+#include "TimelineQueries.hpp"
+
+#include <ProfilingUtils.hpp>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using namespace armnn::gatordmock;
+
+// The timeline timestamps are taken in nanoseconds, the latencies are printed in microseconds
+std::string FormatLatency(uint64_t latency)
+{
+    std::ostringstream stream;
+    stream.setf(std::ios::fixed);
+    stream.precision(3);
+    stream << static_cast<double>(latency) / 1000.0;
+    return stream.str();
+}
+
+void PrintLatencyTable(const std::string& title,
+                       const std::string& firstColumn,
+                       const std::vector<std::pair<std::string, std::vector<uint64_t>>>& rows,
+                       const std::vector<double>& percentiles)
+{
+    using armnn::profiling::CentreAlignFormatting;
+
+    std::string header;
+    header.append(CentreAlignFormatting(firstColumn, 40));
+    header.append(" | ");
+    header.append(CentreAlignFormatting("count", 8));
+    for (double percentile : percentiles)
+    {
+        std::ostringstream column;
+        column << "p" << percentile << " (us)";
+        header.append(" | ");
+        header.append(CentreAlignFormatting(column.str(), 12));
+    }
+    header.append("\n");
+
+    std::cout << "\n" << "\n";
+    std::cout << CentreAlignFormatting(title, static_cast<int>(header.size()));
+    std::cout << "\n";
+    std::cout << std::string(header.size(), '=') << "\n";
+    std::cout << header;
+
+    for (const auto& row : rows)
+    {
+        std::vector<uint64_t> sortedLatencies = row.second;
+        std::sort(sortedLatencies.begin(), sortedLatencies.end());
+
+        std::string body;
+        body.append(CentreAlignFormatting(row.first, 40));
+        body.append(" | ");
+        body.append(CentreAlignFormatting(std::to_string(sortedLatencies.size()), 8));
+        for (double percentile : percentiles)
+        {
+            body.append(" | ");
+            body.append(CentreAlignFormatting(FormatLatency(GetPercentile(sortedLatencies, percentile)), 12));
+        }
+        body.append("\n");
+
+        std::cout << std::string(body.size(), '-') << "\n";
+        std::cout << body;
+    }
+}
+
+bool ParsePercentiles(const std::string& text, std::vector<double>& percentiles)
+{
+    std::vector<std::string> tokens;
+    boost::split(tokens, text, boost::is_any_of(","));
+    for (const std::string& token : tokens)
+    {
+        try
+        {
+            percentiles.push_back(std::stod(boost::trim_copy(token)));
+        }
+        catch (const std::exception&)
+        {
+            std::cerr << "Invalid percentile: \"" << token << "\"" << std::endl;
+            return false;
+        }
+    }
+    return !percentiles.empty();
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    namespace po = boost::program_options;
+
+    std::string fileName;
+    std::string query;
+    std::string percentilesText;
+
+    po::options_description desc("Options");
+    desc.add_options()
+        ("help,h", "Display help messages")
+        ("file,f", po::value<std::string>(&fileName),
+                   "The capture file to query, as written by the runtime with the outgoing capture file option, "
+                   "compressed or not")
+        ("query,q", po::value<std::string>(&query)->default_value("workloads"),
+                    "The query to answer: \"summary\" for the number of records of the capture, \"inferences\" for "
+                    "the percentiles of the latencies of the inferences, \"workloads\" for the percentiles of the "
+                    "latencies of each workload across the inferences")
+        ("percentiles,p", po::value<std::string>(&percentilesText)->default_value("50,90,99"),
+                          "The comma separated percentiles of the latencies to report");
+
+    po::variables_map vm;
+    try
+    {
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        if (vm.count("help") || !vm.count("file"))
+        {
+            std::cout << "Answers queries about the timeline of an external profiling capture file." << std::endl;
+            std::cout << std::endl;
+            std::cout << desc << std::endl;
+            return vm.count("help") ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+        po::notify(vm);
+    }
+    catch (const po::error& e)
+    {
+        std::cerr << e.what() << std::endl << std::endl;
+        std::cerr << desc << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<double> percentiles;
+    if (!ParsePercentiles(percentilesText, percentiles))
+    {
+        return EXIT_FAILURE;
+    }
+    if (query != "summary" && query != "inferences" && query != "workloads")
+    {
+        std::cerr << "Unknown query: \"" << query << "\"" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    TimelineIndex index;
+    TimelineCaptureDecoder decoder(index);
+    const auto decodeStart = std::chrono::steady_clock::now();
+    try
+    {
+        decoder.DecodeCaptureFile(fileName);
+    }
+    catch (const armnn::Exception& e)
+    {
+        std::cerr << "Failed to decode the capture: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    const auto decodeTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - decodeStart);
+
+    std::cout << "Decoded " << decoder.GetRecordCount() << " timeline records of " << decoder.GetPacketCount()
+              << " packets in " << decodeTime.count() << " ms" << std::endl;
+
+    if (query == "summary")
+    {
+        std::cout << "Entities:      " << index.GetEntityCount() << std::endl;
+        std::cout << "Event classes: " << index.GetEventClassCount() << std::endl;
+        std::cout << "Events:        " << index.GetEventCount() << std::endl;
+        std::cout << "Labels:        " << index.GetLabelCount() << std::endl;
+        std::cout << "Relationships: " << index.GetRelationshipCount() << std::endl;
+        std::cout << "Threads:       " << index.GetThreadCount() << std::endl;
+    }
+    else if (query == "inferences")
+    {
+        PrintLatencyTable("INFERENCE LATENCIES", "inferences", { { "all", GetInferenceLatencies(index) } },
+                          percentiles);
+    }
+    else
+    {
+        std::vector<std::pair<std::string, std::vector<uint64_t>>> rows;
+        for (WorkloadLatencies& workload : GetWorkloadLatencies(index))
+        {
+            std::string name = workload.m_LayerName.empty() ? std::to_string(workload.m_WorkloadGuid)
+                                                            : workload.m_LayerName;
+            if (!workload.m_BackendId.empty())
+            {
+                name += " (" + workload.m_BackendId + ")";
+            }
+            rows.emplace_back(name, std::move(workload.m_Latencies));
+        }
+        PrintLatencyTable("WORKLOAD LATENCIES", "workload", rows, percentiles);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -4,19 +4,29 @@
 //
 
 #include "../TimelineCaptureCommandHandler.hpp"
+#include "../TimelineCaptureDecoder.hpp"
 #include "../TimelineDirectoryCaptureCommandHandler.hpp"
+#include "../TimelineIndex.hpp"
+#include "../TimelineQueries.hpp"
 #include "../ITimelineDecoder.h"
 #include "../TimelineModel.h"
 #include "TimelineTestFunctions.hpp"
 
+#include <BufferedFileWriter.hpp>
+#include <BufferManager.hpp>
 #include <CommandHandlerFunctor.hpp>
+#include <LabelsAndEventClasses.hpp>
 #include <ProfilingService.hpp>
 #include <PacketBuffer.hpp>
 #include <TimelinePacketWriterFactory.hpp>
+#include <TimelineUtilityMethods.hpp>
 
+#include <boost/filesystem.hpp>
 #include <boost/test/test_tools.hpp>
 #include <boost/test/unit_test_suite.hpp>
 
+#include <algorithm>
+
 BOOST_AUTO_TEST_SUITE(TimelineDecoderTests)
 
 using namespace armnn;
@@ -217,4 +227,127 @@ BOOST_AUTO_TEST_CASE(TimelineCaptureTest)
     DestroyModel(&modelPtr);
 }
 
+BOOST_AUTO_TEST_CASE(TimelineIndexedCaptureTest)
+{
+    using profiling::LabelsAndEventClasses;
+
+    profiling::BufferManager bufferManager(50);
+    profiling::TimelinePacketWriterFactory timelinePacketWriterFactory(bufferManager);
+    std::unique_ptr<profiling::ISendTimelinePacket> sendTimelinePacket =
+        timelinePacketWriterFactory.GetSendTimelinePacket();
+    profiling::TimelineUtilityMethods timelineUtils(sendTimelinePacket);
+
+    // The capture is written in the format of the outgoing capture files, raw and compressed
+    boost::filesystem::path rawFileName =
+        boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    boost::filesystem::path compressedFileName =
+        boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    std::ofstream rawFile(rawFileName.string(), std::ios::out | std::ios::binary);
+    profiling::BufferedFileWriter compressedFileWriter(true, 256);
+    BOOST_CHECK(compressedFileWriter.Open(compressedFileName.string()));
+
+    auto commitPackets = [&]()
+    {
+        timelineUtils.Commit();
+        while (profiling::IPacketBufferPtr packetBuffer = bufferManager.GetReadableBuffer())
+        {
+            rawFile.write(reinterpret_cast<const char*>(packetBuffer->GetReadableData()), packetBuffer->GetSize());
+            compressedFileWriter.Write(packetBuffer->GetReadableData(), packetBuffer->GetSize());
+            bufferManager.MarkRead(packetBuffer);
+        }
+    };
+
+    // A network of two layers, with a workload each
+    const profiling::ProfilingGuid networkGuid = profiling::ProfilingService::Instance().NextGuid();
+    timelineUtils.CreateTypedEntity(networkGuid, LabelsAndEventClasses::NETWORK_GUID);
+
+    const std::vector<std::string> layerNames = { "convolution", "softmax" };
+    const std::vector<std::string> backendIds = { "CpuRef", "CpuAcc" };
+    std::vector<profiling::ProfilingGuid> workloadGuids;
+    for (size_t i = 0; i < layerNames.size(); ++i)
+    {
+        const profiling::ProfilingGuid layerGuid = profiling::ProfilingService::Instance().NextGuid();
+        timelineUtils.CreateNamedTypedChildEntity(layerGuid, networkGuid, layerNames[i],
+                                                  LabelsAndEventClasses::LAYER_GUID);
+
+        workloadGuids.push_back(profiling::ProfilingService::Instance().NextGuid());
+        timelineUtils.CreateTypedEntity(workloadGuids.back(), LabelsAndEventClasses::WORKLOAD_GUID);
+        timelineUtils.MarkEntityWithLabel(workloadGuids.back(), backendIds[i], LabelsAndEventClasses::BACKENDID_GUID);
+        timelineUtils.CreateRelationship(profiling::ProfilingRelationshipType::RetentionLink,
+                                         layerGuid, workloadGuids.back());
+    }
+    commitPackets();
+
+    // Inference i takes 100 * (i + 1) ticks: 10 * (i + 1) in the first workload and 50 * (i + 1) in the second one
+    const std::thread::id threadId = std::this_thread::get_id();
+    const unsigned int numberOfInferences = 20;
+    for (unsigned int i = 0; i < numberOfInferences; ++i)
+    {
+        const uint64_t start = 1000u * i;
+        const uint64_t scale = i + 1;
+
+        const profiling::ProfilingGuid inferenceGuid = profiling::ProfilingService::Instance().NextGuid();
+        timelineUtils.CreateTypedEntity(inferenceGuid, LabelsAndEventClasses::INFERENCE_GUID);
+        timelineUtils.CreateRelationship(profiling::ProfilingRelationshipType::RetentionLink,
+                                         networkGuid, inferenceGuid);
+        timelineUtils.RecordEvent(inferenceGuid, LabelsAndEventClasses::ARMNN_PROFILING_SOL_EVENT_CLASS,
+                                  start, threadId);
+
+        profiling::ProfilingGuid executionGuid =
+            timelineUtils.RecordWorkloadInferenceAndStartOfLifeEvent(workloadGuids[0], inferenceGuid,
+                                                                     start + 10, threadId);
+        timelineUtils.RecordEndOfLifeEvent(executionGuid, start + 10 + 10 * scale, threadId);
+        executionGuid = timelineUtils.RecordWorkloadInferenceAndStartOfLifeEvent(workloadGuids[1], inferenceGuid,
+                                                                                 start + 30 * scale, threadId);
+        timelineUtils.RecordEndOfLifeEvent(executionGuid, start + 80 * scale, threadId);
+
+        timelineUtils.RecordEvent(inferenceGuid, LabelsAndEventClasses::ARMNN_PROFILING_EOL_EVENT_CLASS,
+                                  start + 100 * scale, threadId);
+        commitPackets();
+    }
+    rawFile.close();
+    compressedFileWriter.Close();
+
+    for (const boost::filesystem::path& fileName : { rawFileName, compressedFileName })
+    {
+        // Small chunks make packets span chunks
+        gatordmock::TimelineIndex index;
+        gatordmock::TimelineCaptureDecoder decoder(index);
+        decoder.DecodeCaptureFile(fileName.string(), 64);
+
+        BOOST_CHECK(decoder.GetRecordCount() == decoder.GetPacketCount());
+        BOOST_CHECK(index.GetEventCount() == numberOfInferences * 6);
+        BOOST_CHECK(index.GetThreadCount() == 1);
+        BOOST_CHECK(index.HasEntity(networkGuid));
+        BOOST_CHECK(index.HasType(networkGuid, LabelsAndEventClasses::NETWORK_GUID));
+        BOOST_CHECK(!index.HasType(networkGuid, LabelsAndEventClasses::LAYER_GUID));
+        BOOST_CHECK(index.GetLabelOfType(workloadGuids[1], LabelsAndEventClasses::BACKENDID_GUID) == "CpuAcc");
+
+        std::vector<uint64_t> inferenceLatencies = gatordmock::GetInferenceLatencies(index);
+        BOOST_CHECK(inferenceLatencies.size() == numberOfInferences);
+        std::sort(inferenceLatencies.begin(), inferenceLatencies.end());
+        BOOST_CHECK(gatordmock::GetPercentile(inferenceLatencies, 0) == 100);
+        BOOST_CHECK(gatordmock::GetPercentile(inferenceLatencies, 50) == 1000);
+        BOOST_CHECK(gatordmock::GetPercentile(inferenceLatencies, 90) == 1800);
+        BOOST_CHECK(gatordmock::GetPercentile(inferenceLatencies, 100) == 2000);
+
+        std::vector<gatordmock::WorkloadLatencies> workloadLatencies = gatordmock::GetWorkloadLatencies(index);
+        BOOST_REQUIRE(workloadLatencies.size() == 2);
+        for (size_t i = 0; i < workloadLatencies.size(); ++i)
+        {
+            BOOST_CHECK(workloadLatencies[i].m_WorkloadGuid == workloadGuids[i]);
+            BOOST_CHECK(workloadLatencies[i].m_LayerName == layerNames[i]);
+            BOOST_CHECK(workloadLatencies[i].m_BackendId == backendIds[i]);
+            BOOST_CHECK(workloadLatencies[i].m_Latencies.size() == numberOfInferences);
+        }
+        BOOST_CHECK(workloadLatencies[0].m_Latencies.front() == 10);
+        BOOST_CHECK(workloadLatencies[0].m_Latencies.back() == 200);
+        BOOST_CHECK(workloadLatencies[1].m_Latencies.front() == 50);
+        BOOST_CHECK(workloadLatencies[1].m_Latencies.back() == 1000);
+    }
+
+    boost::filesystem::remove(rawFileName);
+    boost::filesystem::remove(compressedFileName);
+}
+
 BOOST_AUTO_TEST_SUITE_END()